@@ -27,6 +27,7 @@
 #include "asio/associator.hpp"
 #include "asio/async_result.hpp"
 #include "asio/awaitable.hpp"
+#include "asio/basic_acceptor_group.hpp"
 #include "asio/basic_datagram_socket.hpp"
 #include "asio/basic_deadline_timer.hpp"
 #include "asio/basic_file.hpp"
@@ -69,6 +70,7 @@
 #include "asio/connect_pipe.hpp"
 #include "asio/consign.hpp"
 #include "asio/coroutine.hpp"
+#include "asio/datagram_message.hpp"
 #include "asio/deadline_timer.hpp"
 #include "asio/defer.hpp"
 #include "asio/deferred.hpp"
@@ -177,11 +179,14 @@
 #include "asio/registered_buffer.hpp"
 #include "asio/require.hpp"
 #include "asio/require_concept.hpp"
+#include "asio/sendfile.hpp"
 #include "asio/serial_port.hpp"
 #include "asio/serial_port_base.hpp"
 #include "asio/signal_set.hpp"
 #include "asio/signal_set_base.hpp"
+#include "asio/slack_wait_traits.hpp"
 #include "asio/socket_base.hpp"
+#include "asio/splice.hpp"
 #include "asio/static_thread_pool.hpp"
 #include "asio/steady_timer.hpp"
 #include "asio/strand.hpp"
@@ -200,6 +205,7 @@
 #include "asio/uses_executor.hpp"
 #include "asio/version.hpp"
 #include "asio/wait_traits.hpp"
+#include "asio/wheel_wait_traits.hpp"
 #include "asio/windows/basic_object_handle.hpp"
 #include "asio/windows/basic_overlapped_handle.hpp"
 #include "asio/windows/basic_random_access_handle.hpp"
@@ -212,5 +218,6 @@
 #include "asio/writable_pipe.hpp"
 #include "asio/write.hpp"
 #include "asio/write_at.hpp"
+#include "asio/zero_copy_receive_buffer.hpp"
 
 #endif // ASIO_HPP
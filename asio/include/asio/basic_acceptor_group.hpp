@@ -0,0 +1,266 @@
+//
+// basic_acceptor_group.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_BASIC_ACCEPTOR_GROUP_HPP
+#define ASIO_BASIC_ACCEPTOR_GROUP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_REUSEPORT_CBPF) \
+  || defined(GENERATING_DOCUMENTATION)
+
+#include <cstddef>
+#include <vector>
+#include "asio/any_io_executor.hpp"
+#include "asio/basic_socket_acceptor.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/detail/scoped_ptr.hpp"
+#include "asio/detail/socket_ops.hpp"
+#include "asio/detail/throw_error.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/error.hpp"
+#include "asio/execution_context.hpp"
+#include "asio/socket_base.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+/// Distributes incoming connections across acceptors by receiving CPU.
+/**
+ * The basic_acceptor_group class template manages a group of acceptors that
+ * are bound to the same endpoint using the @c SO_REUSEPORT socket option,
+ * typically one for each io_context in a program that runs an io_context per
+ * CPU. Rather than hashing connections across the group, a classic BPF program
+ * is attached with @c SO_ATTACH_REUSEPORT_CBPF so that a connection whose
+ * packets were received on CPU @c n is queued on acceptor <tt>n % size()</tt>.
+ * When the io_context that owns acceptor @c n runs on CPU @c n, each connection
+ * is then accepted and served on the CPU on which the network interface
+ * delivered it.
+ *
+ * Acceptors are added to the group and bound to the endpoint by add(), and
+ * the group is started by listen(). Acceptors should not be closed
+ * individually while the group is in use, as this changes the indexes of the
+ * remaining acceptors.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe. The acceptors may be used from the threads
+ * running their respective executors once the group has been started.
+ *
+ * @par Example
+ * @code
+ * std::vector<asio::io_context*> contexts = ...;
+ * asio::basic_acceptor_group<asio::ip::tcp> group(
+ *     asio::ip::tcp::endpoint(asio::ip::tcp::v4(), 8080));
+ * for (std::size_t i = 0; i < contexts.size(); ++i)
+ *   group.add(*contexts[i]);
+ * group.listen();
+ * for (std::size_t i = 0; i < group.size(); ++i)
+ *   start_accept(group[i]);
+ * @endcode
+ */
+template <typename Protocol, typename Executor = any_io_executor>
+class basic_acceptor_group
+  : private detail::noncopyable
+{
+public:
+  /// The type of the executor associated with the acceptors.
+  typedef Executor executor_type;
+
+  /// The protocol type.
+  typedef Protocol protocol_type;
+
+  /// The endpoint type.
+  typedef typename Protocol::endpoint endpoint_type;
+
+  /// The type of the acceptors in the group.
+  typedef basic_socket_acceptor<Protocol, Executor> acceptor_type;
+
+  /// Construct an empty acceptor group.
+  /**
+   * @param endpoint The endpoint to which the acceptors will be bound. If the
+   * port is zero, the port assigned to the first acceptor is used for the
+   * others.
+   */
+  explicit basic_acceptor_group(const endpoint_type& endpoint)
+    : endpoint_(endpoint)
+  {
+  }
+
+  /// Destroys the acceptor group.
+  /**
+   * This function destroys the acceptors in the group. Any outstanding
+   * asynchronous accept operations are cancelled.
+   */
+  ~basic_acceptor_group()
+  {
+    for (std::size_t i = 0; i < acceptors_.size(); ++i)
+      delete acceptors_[i];
+  }
+
+  /// Add an acceptor that uses the specified executor.
+  /**
+   * This function opens an acceptor, enables the @c SO_REUSEADDR and
+   * @c SO_REUSEPORT socket options, and binds it to the group's endpoint.
+   *
+   * @param ex The I/O executor that the acceptor will use, by default, to
+   * dispatch handlers for any asynchronous operations performed on it.
+   *
+   * @returns The new acceptor, which has index <tt>size() - 1</tt>.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  acceptor_type& add(const executor_type& ex)
+  {
+    detail::scoped_ptr<acceptor_type> acceptor(new acceptor_type(ex));
+    return add_acceptor(acceptor);
+  }
+
+  /// Add an acceptor that uses the specified execution context.
+  /**
+   * This function opens an acceptor, enables the @c SO_REUSEADDR and
+   * @c SO_REUSEPORT socket options, and binds it to the group's endpoint.
+   *
+   * @param context An execution context which provides the I/O executor that
+   * the acceptor will use, by default, to dispatch handlers for any
+   * asynchronous operations performed on it.
+   *
+   * @returns The new acceptor, which has index <tt>size() - 1</tt>.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  template <typename ExecutionContext>
+  acceptor_type& add(ExecutionContext& context,
+      typename constraint<
+        is_convertible<ExecutionContext&, execution_context&>::value
+      >::type = 0)
+  {
+    detail::scoped_ptr<acceptor_type> acceptor(new acceptor_type(context));
+    return add_acceptor(acceptor);
+  }
+
+  /// Start listening on all acceptors in the group.
+  /**
+   * This function puts the acceptors into the listening state, in index order,
+   * and then attaches the program that selects an acceptor by receiving CPU.
+   *
+   * @param backlog The maximum length of the queue of pending connections for
+   * each acceptor.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  void listen(int backlog = socket_base::max_listen_connections)
+  {
+    asio::error_code ec;
+    listen(backlog, ec);
+    asio::detail::throw_error(ec, "listen");
+  }
+
+  /// Start listening on all acceptors in the group.
+  /**
+   * This function puts the acceptors into the listening state, in index order,
+   * and then attaches the program that selects an acceptor by receiving CPU.
+   *
+   * @param backlog The maximum length of the queue of pending connections for
+   * each acceptor.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   */
+  ASIO_SYNC_OP_VOID listen(int backlog, asio::error_code& ec)
+  {
+    if (acceptors_.empty())
+    {
+      ec = asio::error::invalid_argument;
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+    }
+
+    // The kernel numbers the sockets in the group in the order in which they
+    // start listening.
+    for (std::size_t i = 0; i < acceptors_.size(); ++i)
+    {
+      acceptors_[i]->listen(backlog, ec);
+      if (ec)
+      {
+        ASIO_SYNC_OP_VOID_RETURN(ec);
+      }
+    }
+
+    detail::socket_ops::attach_reuse_port_cpu_filter(
+        acceptors_[0]->native_handle(), acceptors_.size(), ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Get the number of acceptors in the group.
+  std::size_t size() const ASIO_NOEXCEPT
+  {
+    return acceptors_.size();
+  }
+
+  /// Get the acceptor with the specified index.
+  /**
+   * Acceptor @c i accepts the connections received on the CPUs for which the
+   * CPU number modulo size() is equal to @c i.
+   */
+  acceptor_type& operator[](std::size_t i)
+  {
+    return *acceptors_[i];
+  }
+
+  /// Get the acceptor with the specified index.
+  const acceptor_type& operator[](std::size_t i) const
+  {
+    return *acceptors_[i];
+  }
+
+  /// Get the endpoint to which the acceptors are bound.
+  /**
+   * Once an acceptor has been added, this is the endpoint to which it was
+   * bound, including any port assigned by the operating system.
+   */
+  const endpoint_type& local_endpoint() const ASIO_NOEXCEPT
+  {
+    return endpoint_;
+  }
+
+private:
+  acceptor_type& add_acceptor(detail::scoped_ptr<acceptor_type>& acceptor)
+  {
+    acceptor->open(endpoint_.protocol());
+    acceptor->set_option(socket_base::reuse_address(true));
+    acceptor->set_option(socket_base::reuse_port(true));
+    acceptor->bind(endpoint_);
+    if (acceptors_.empty())
+      endpoint_ = acceptor->local_endpoint();
+
+    acceptors_.reserve(acceptors_.size() + 1);
+    acceptors_.push_back(acceptor.release());
+    return *acceptors_.back();
+  }
+
+  // The endpoint to which the acceptors are bound.
+  endpoint_type endpoint_;
+
+  // The acceptors, in the order in which they were added.
+  std::vector<acceptor_type*> acceptors_;
+};
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_REUSEPORT_CBPF)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_BASIC_ACCEPTOR_GROUP_HPP
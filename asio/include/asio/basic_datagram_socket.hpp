@@ -18,6 +18,7 @@
 #include "asio/detail/config.hpp"
 #include <cstddef>
 #include "asio/basic_socket.hpp"
+#include "asio/datagram_message.hpp"
 #include "asio/detail/handler_type_requirements.hpp"
 #include "asio/detail/non_const_lvalue.hpp"
 #include "asio/detail/throw_error.hpp"
@@ -62,6 +63,10 @@ private:
   class initiate_async_send_to;
   class initiate_async_receive;
   class initiate_async_receive_from;
+#if defined(ASIO_HAS_MMSG)
+  class initiate_async_send_many;
+  class initiate_async_receive_many;
+#endif // defined(ASIO_HAS_MMSG)
 
 public:
   /// The type of the executor associated with the object.
@@ -89,6 +94,9 @@ public:
   /// The endpoint type.
   typedef typename Protocol::endpoint endpoint_type;
 
+  /// The type of a message used with batched send and receive operations.
+  typedef datagram_message<endpoint_type> message_type;
+
   /// Construct a basic_datagram_socket without opening it.
   /**
    * This constructor creates a datagram socket without opening it. The open()
@@ -1246,6 +1254,461 @@ public:
         buffers, &sender_endpoint, flags);
   }
 
+#if defined(ASIO_HAS_MMSG) || defined(GENERATING_DOCUMENTATION)
+  /// Send a batch of datagrams to the specified endpoints.
+  /**
+   * This function is used to send a batch of datagrams, each to the endpoint
+   * given in its message, using a single system call where the platform
+   * supports it. The function call will block until at least one datagram
+   * has been sent or an error occurs. The size of each message that was sent
+   * is set to the number of bytes sent.
+   *
+   * @note A single operation transfers at most 64 messages. Messages that
+   * follow those that were transferred are left unmodified.
+   *
+   * @param begin An iterator to the first message.
+   *
+   * @param end An iterator one past the last message.
+   *
+   * @returns The number of messages sent.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  template <typename MessageIterator>
+  std::size_t send_many(MessageIterator begin, MessageIterator end)
+  {
+    asio::error_code ec;
+    std::size_t s = this->impl_.get_service().send_many(
+        this->impl_.get_implementation(), begin, end, 0, ec);
+    asio::detail::throw_error(ec, "send_many");
+    return s;
+  }
+
+  /// Send a batch of datagrams to the specified endpoints.
+  /**
+   * This function is used to send a batch of datagrams, each to the endpoint
+   * given in its message, using a single system call where the platform
+   * supports it. The function call will block until at least one datagram
+   * has been sent or an error occurs. The size of each message that was sent
+   * is set to the number of bytes sent.
+   *
+   * @note A single operation transfers at most 64 messages. Messages that
+   * follow those that were transferred are left unmodified.
+   *
+   * @param begin An iterator to the first message.
+   *
+   * @param end An iterator one past the last message.
+   *
+   * @param flags Flags specifying how the send call is to be made.
+   *
+   * @returns The number of messages sent.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  template <typename MessageIterator>
+  std::size_t send_many(MessageIterator begin, MessageIterator end,
+      socket_base::message_flags flags)
+  {
+    asio::error_code ec;
+    std::size_t s = this->impl_.get_service().send_many(
+        this->impl_.get_implementation(), begin, end, flags, ec);
+    asio::detail::throw_error(ec, "send_many");
+    return s;
+  }
+
+  /// Send a batch of datagrams to the specified endpoints.
+  /**
+   * This function is used to send a batch of datagrams, each to the endpoint
+   * given in its message, using a single system call where the platform
+   * supports it. The function call will block until at least one datagram
+   * has been sent or an error occurs. The size of each message that was sent
+   * is set to the number of bytes sent.
+   *
+   * @note A single operation transfers at most 64 messages. Messages that
+   * follow those that were transferred are left unmodified.
+   *
+   * @param begin An iterator to the first message.
+   *
+   * @param end An iterator one past the last message.
+   *
+   * @param flags Flags specifying how the send call is to be made.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @returns The number of messages sent.
+   */
+  template <typename MessageIterator>
+  std::size_t send_many(MessageIterator begin, MessageIterator end,
+      socket_base::message_flags flags, asio::error_code& ec)
+  {
+    return this->impl_.get_service().send_many(
+        this->impl_.get_implementation(), begin, end, flags, ec);
+  }
+
+  /// Start an asynchronous send of a batch of datagrams.
+  /**
+   * This function is used to asynchronously send a batch of datagrams, each
+   * to the endpoint given in its message. It is an initiating function for an
+   * @ref asynchronous_operation, and always returns immediately. The
+   * operation completes once at least one datagram has been sent, and the
+   * size of each message that was sent is set to the number of bytes sent.
+   *
+   * @note A single operation transfers at most 64 messages. Messages that
+   * follow those that were transferred are left unmodified.
+   *
+   * @param begin An iterator to the first message. Although the iterators may
+   * be copied as necessary, ownership of the messages and their buffers is
+   * retained by the caller, which must guarantee that they remain valid until
+   * the completion handler is called.
+   *
+   * @param end An iterator one past the last message.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the send completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t messages_transferred // Number of messages sent.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename MessageIterator,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken
+          ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(WriteToken,
+      void (asio::error_code, std::size_t))
+  async_send_many(MessageIterator begin, MessageIterator end,
+      ASIO_MOVE_ARG(WriteToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_send_many>(), token,
+          begin, end, socket_base::message_flags(0))))
+  {
+    return async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_send_many(this), token,
+        begin, end, socket_base::message_flags(0));
+  }
+
+  /// Start an asynchronous send of a batch of datagrams.
+  /**
+   * This function is used to asynchronously send a batch of datagrams, each
+   * to the endpoint given in its message. It is an initiating function for an
+   * @ref asynchronous_operation, and always returns immediately. The
+   * operation completes once at least one datagram has been sent, and the
+   * size of each message that was sent is set to the number of bytes sent.
+   *
+   * @note A single operation transfers at most 64 messages. Messages that
+   * follow those that were transferred are left unmodified.
+   *
+   * @param begin An iterator to the first message. Although the iterators may
+   * be copied as necessary, ownership of the messages and their buffers is
+   * retained by the caller, which must guarantee that they remain valid until
+   * the completion handler is called.
+   *
+   * @param end An iterator one past the last message.
+   *
+   * @param flags Flags specifying how the send call is to be made.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the send completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t messages_transferred // Number of messages sent.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename MessageIterator,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken
+          ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(WriteToken,
+      void (asio::error_code, std::size_t))
+  async_send_many(MessageIterator begin, MessageIterator end,
+      socket_base::message_flags flags,
+      ASIO_MOVE_ARG(WriteToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_send_many>(), token, begin, end, flags)))
+  {
+    return async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_send_many(this), token, begin, end, flags);
+  }
+
+  /// Receive a batch of datagrams with the endpoints of their senders.
+  /**
+   * This function is used to receive a batch of datagrams using a single
+   * system call where the platform supports it. The function call will block
+   * until at least one datagram has been received or an error occurs, and
+   * then also receives any datagrams that are already queued on the socket.
+   * The endpoint and size of each message that was received are set to the
+   * sender's endpoint and the number of bytes received.
+   *
+   * @note A single operation transfers at most 64 messages. Messages that
+   * follow those that were transferred are left unmodified.
+   *
+   * @param begin An iterator to the first message.
+   *
+   * @param end An iterator one past the last message.
+   *
+   * @returns The number of messages received.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  template <typename MessageIterator>
+  std::size_t receive_many(MessageIterator begin, MessageIterator end)
+  {
+    asio::error_code ec;
+    std::size_t s = this->impl_.get_service().receive_many(
+        this->impl_.get_implementation(), begin, end, 0, ec);
+    asio::detail::throw_error(ec, "receive_many");
+    return s;
+  }
+
+  /// Receive a batch of datagrams with the endpoints of their senders.
+  /**
+   * This function is used to receive a batch of datagrams using a single
+   * system call where the platform supports it. The function call will block
+   * until at least one datagram has been received or an error occurs, and
+   * then also receives any datagrams that are already queued on the socket.
+   * The endpoint and size of each message that was received are set to the
+   * sender's endpoint and the number of bytes received.
+   *
+   * @note A single operation transfers at most 64 messages. Messages that
+   * follow those that were transferred are left unmodified.
+   *
+   * @param begin An iterator to the first message.
+   *
+   * @param end An iterator one past the last message.
+   *
+   * @param flags Flags specifying how the receive call is to be made.
+   *
+   * @returns The number of messages received.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  template <typename MessageIterator>
+  std::size_t receive_many(MessageIterator begin, MessageIterator end,
+      socket_base::message_flags flags)
+  {
+    asio::error_code ec;
+    std::size_t s = this->impl_.get_service().receive_many(
+        this->impl_.get_implementation(), begin, end, flags, ec);
+    asio::detail::throw_error(ec, "receive_many");
+    return s;
+  }
+
+  /// Receive a batch of datagrams with the endpoints of their senders.
+  /**
+   * This function is used to receive a batch of datagrams using a single
+   * system call where the platform supports it. The function call will block
+   * until at least one datagram has been received or an error occurs, and
+   * then also receives any datagrams that are already queued on the socket.
+   * The endpoint and size of each message that was received are set to the
+   * sender's endpoint and the number of bytes received.
+   *
+   * @note A single operation transfers at most 64 messages. Messages that
+   * follow those that were transferred are left unmodified.
+   *
+   * @param begin An iterator to the first message.
+   *
+   * @param end An iterator one past the last message.
+   *
+   * @param flags Flags specifying how the receive call is to be made.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @returns The number of messages received.
+   */
+  template <typename MessageIterator>
+  std::size_t receive_many(MessageIterator begin, MessageIterator end,
+      socket_base::message_flags flags, asio::error_code& ec)
+  {
+    return this->impl_.get_service().receive_many(
+        this->impl_.get_implementation(), begin, end, flags, ec);
+  }
+
+  /// Start an asynchronous receive of a batch of datagrams.
+  /**
+   * This function is used to asynchronously receive a batch of datagrams. It
+   * is an initiating function for an @ref asynchronous_operation, and always
+   * returns immediately. The operation completes once at least one datagram
+   * has been received, and also receives any other datagrams that are already
+   * queued on the socket. The endpoint and size of each message that was
+   * received are set to the sender's endpoint and the number of bytes
+   * received.
+   *
+   * @note A single operation transfers at most 64 messages. Messages that
+   * follow those that were transferred are left unmodified.
+   *
+   * @param begin An iterator to the first message. Although the iterators may
+   * be copied as necessary, ownership of the messages and their buffers is
+   * retained by the caller, which must guarantee that they remain valid until
+   * the completion handler is called.
+   *
+   * @param end An iterator one past the last message.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t messages_transferred // Number of messages received.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename MessageIterator,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) ReadToken
+          ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(ReadToken,
+      void (asio::error_code, std::size_t))
+  async_receive_many(MessageIterator begin, MessageIterator end,
+      ASIO_MOVE_ARG(ReadToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<ReadToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_receive_many>(), token,
+          begin, end, socket_base::message_flags(0))))
+  {
+    return async_initiate<ReadToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_receive_many(this), token,
+        begin, end, socket_base::message_flags(0));
+  }
+
+  /// Start an asynchronous receive of a batch of datagrams.
+  /**
+   * This function is used to asynchronously receive a batch of datagrams. It
+   * is an initiating function for an @ref asynchronous_operation, and always
+   * returns immediately. The operation completes once at least one datagram
+   * has been received, and also receives any other datagrams that are already
+   * queued on the socket. The endpoint and size of each message that was
+   * received are set to the sender's endpoint and the number of bytes
+   * received.
+   *
+   * @note A single operation transfers at most 64 messages. Messages that
+   * follow those that were transferred are left unmodified.
+   *
+   * @param begin An iterator to the first message. Although the iterators may
+   * be copied as necessary, ownership of the messages and their buffers is
+   * retained by the caller, which must guarantee that they remain valid until
+   * the completion handler is called.
+   *
+   * @param end An iterator one past the last message.
+   *
+   * @param flags Flags specifying how the receive call is to be made.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t messages_transferred // Number of messages received.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename MessageIterator,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) ReadToken
+          ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(ReadToken,
+      void (asio::error_code, std::size_t))
+  async_receive_many(MessageIterator begin, MessageIterator end,
+      socket_base::message_flags flags,
+      ASIO_MOVE_ARG(ReadToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<ReadToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_receive_many>(), token, begin, end, flags)))
+  {
+    return async_initiate<ReadToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_receive_many(this), token, begin, end, flags);
+  }
+#endif // defined(ASIO_HAS_MMSG) || defined(GENERATING_DOCUMENTATION)
+
 private:
   // Disallow copying and assignment.
   basic_datagram_socket(const basic_datagram_socket&) ASIO_DELETED;
@@ -1387,6 +1850,76 @@ private:
   private:
     basic_datagram_socket* self_;
   };
+
+#if defined(ASIO_HAS_MMSG)
+  class initiate_async_send_many
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_send_many(basic_datagram_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename WriteHandler, typename MessageIterator>
+    void operator()(ASIO_MOVE_ARG(WriteHandler) handler,
+        MessageIterator begin, MessageIterator end,
+        socket_base::message_flags flags) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+      detail::non_const_lvalue<WriteHandler> handler2(handler);
+      self_->impl_.get_service().async_send_many(
+          self_->impl_.get_implementation(), begin, end,
+          flags, handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_datagram_socket* self_;
+  };
+
+  class initiate_async_receive_many
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_receive_many(basic_datagram_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename ReadHandler, typename MessageIterator>
+    void operator()(ASIO_MOVE_ARG(ReadHandler) handler,
+        MessageIterator begin, MessageIterator end,
+        socket_base::message_flags flags) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ReadHandler.
+      ASIO_READ_HANDLER_CHECK(ReadHandler, handler) type_check;
+
+      detail::non_const_lvalue<ReadHandler> handler2(handler);
+      self_->impl_.get_service().async_receive_many(
+          self_->impl_.get_implementation(), begin, end,
+          flags, handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_datagram_socket* self_;
+  };
+#endif // defined(ASIO_HAS_MMSG)
 };
 
 } // namespace asio
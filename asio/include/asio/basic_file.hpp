@@ -69,6 +69,14 @@ template <typename Executor>
 class basic_file
   : public file_base
 {
+private:
+  class initiate_async_open;
+  class initiate_async_close;
+  class initiate_async_size;
+  class initiate_async_resize;
+  class initiate_async_sync_all;
+  class initiate_async_sync_data;
+
 public:
   /// The type of the executor associated with the object.
   typedef Executor executor_type;
@@ -456,6 +464,74 @@ public:
     ASIO_SYNC_OP_VOID_RETURN(ec);
   }
 
+  /// Start an asynchronous operation to open the file.
+  /**
+   * This function is used to asynchronously open the file using the specified
+   * path. It is an initiating function for an @ref asynchronous_operation, and
+   * always returns immediately.
+   *
+   * @param path The path name identifying the file to be opened. A copy of the
+   * path is made as required.
+   *
+   * @param open_flags A set of flags that determine how the file should be
+   * opened.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the open completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error // Result of operation.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code) @endcode
+   *
+   * @note The open is performed on an internal thread, and the file object is
+   * updated only when the completion handler is invoked. If the file object
+   * is destroyed, or its @c cancel or @c close function is called, before
+   * then, the open is abandoned. The handler is passed the
+   * asio::error::operation_aborted error, and any file that was opened is
+   * closed.
+   *
+   * @par Example
+   * @code
+   * void open_handler(const asio::error_code& error)
+   * {
+   *   if (!error)
+   *   {
+   *     // Open succeeded.
+   *   }
+   * }
+   *
+   * ...
+   *
+   * asio::stream_file file(my_context);
+   * file.async_open("/path/to/my/file",
+   *     asio::stream_file::read_only, open_handler);
+   * @endcode
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code))
+        OpenToken ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(OpenToken,
+      void (asio::error_code))
+  async_open(const std::string& path, file_base::flags open_flags,
+      ASIO_MOVE_ARG(OpenToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<OpenToken, void (asio::error_code)>(
+          declval<initiate_async_open>(), token, path, open_flags)))
+  {
+    return async_initiate<OpenToken, void (asio::error_code)>(
+        initiate_async_open(this), token, path, open_flags);
+  }
+
   /// Assign an existing native file to the file.
   /*
    * This function opens the file to hold an existing native file.
@@ -537,6 +613,52 @@ public:
     ASIO_SYNC_OP_VOID_RETURN(ec);
   }
 
+  /// Start an asynchronous operation to close the file.
+  /**
+   * This function is used to asynchronously close the file. It is an
+   * initiating function for an @ref asynchronous_operation, and always returns
+   * immediately. Any outstanding asynchronous read or write operations will be
+   * cancelled, and will complete with the asio::error::operation_aborted
+   * error.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the close completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error // Result of operation.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code) @endcode
+   *
+   * @note The underlying file is detached from the file object immediately,
+   * so the object may be reopened or destroyed before the operation
+   * completes. The close is performed on an internal thread, and so cannot be
+   * cancelled. Even if the operation completes with an error, the underlying
+   * file is closed.
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code))
+        CloseToken ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(CloseToken,
+      void (asio::error_code))
+  async_close(
+      ASIO_MOVE_ARG(CloseToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<CloseToken, void (asio::error_code)>(
+          declval<initiate_async_close>(), token)))
+  {
+    return async_initiate<CloseToken, void (asio::error_code)>(
+        initiate_async_close(this), token);
+  }
+
   /// Release ownership of the underlying native file.
   /**
    * This function causes all outstanding asynchronous read and write
@@ -708,6 +830,45 @@ public:
     return impl_.get_service().size(impl_.get_implementation(), ec);
   }
 
+  /// Start an asynchronous operation to get the size of the file.
+  /**
+   * This function is used to asynchronously determine the size of the file, in
+   * bytes. It is an initiating function for an @ref asynchronous_operation,
+   * and always returns immediately.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the operation completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   uint64_t size // The size of the file, in bytes.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, uint64_t) @endcode
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code, uint64_t))
+        SizeToken ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(SizeToken,
+      void (asio::error_code, uint64_t))
+  async_size(
+      ASIO_MOVE_ARG(SizeToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<SizeToken, void (asio::error_code, uint64_t)>(
+          declval<initiate_async_size>(), token)))
+  {
+    return async_initiate<SizeToken, void (asio::error_code, uint64_t)>(
+        initiate_async_size(this), token);
+  }
+
   /// Alter the size of the file.
   /**
    * This function resizes the file to the specified size, in bytes. If the
@@ -743,6 +904,51 @@ public:
     ASIO_SYNC_OP_VOID_RETURN(ec);
   }
 
+  /// Start an asynchronous operation to alter the size of the file.
+  /**
+   * This function is used to asynchronously resize the file to the specified
+   * size, in bytes. It is an initiating function for an @ref
+   * asynchronous_operation, and always returns immediately. If the current
+   * file size exceeds @c n then any extra data is discarded. If the current
+   * size is less than @c n then the file is extended and filled with zeroes.
+   *
+   * @param n The new size for the file.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the operation completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error // Result of operation.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code) @endcode
+   *
+   * @note The resize is performed on an internal thread, and so cannot be
+   * cancelled.
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code))
+        ResizeToken ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(ResizeToken,
+      void (asio::error_code))
+  async_resize(uint64_t n,
+      ASIO_MOVE_ARG(ResizeToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<ResizeToken, void (asio::error_code)>(
+          declval<initiate_async_resize>(), token, n)))
+  {
+    return async_initiate<ResizeToken, void (asio::error_code)>(
+        initiate_async_resize(this), token, n);
+  }
+
   /// Synchronise the file to disk.
   /**
    * This function synchronises the file data and metadata to disk. Note that
@@ -770,6 +976,45 @@ public:
     ASIO_SYNC_OP_VOID_RETURN(ec);
   }
 
+  /// Start an asynchronous operation to synchronise the file to disk.
+  /**
+   * This function is used to asynchronously synchronise the file data and
+   * metadata to disk. It is an initiating function for an @ref
+   * asynchronous_operation, and always returns immediately. Note that the
+   * semantics of this synchronisation vary between operation systems.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the operation completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error // Result of operation.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code) @endcode
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code))
+        SyncToken ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(SyncToken,
+      void (asio::error_code))
+  async_sync_all(
+      ASIO_MOVE_ARG(SyncToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<SyncToken, void (asio::error_code)>(
+          declval<initiate_async_sync_all>(), token)))
+  {
+    return async_initiate<SyncToken, void (asio::error_code)>(
+        initiate_async_sync_all(this), token);
+  }
+
   /// Synchronise the file data to disk.
   /**
    * This function synchronises the file data to disk. Note that the semantics
@@ -797,6 +1042,45 @@ public:
     ASIO_SYNC_OP_VOID_RETURN(ec);
   }
 
+  /// Start an asynchronous operation to synchronise the file data to disk.
+  /**
+   * This function is used to asynchronously synchronise the file data to disk.
+   * It is an initiating function for an @ref asynchronous_operation, and
+   * always returns immediately. Note that the semantics of this
+   * synchronisation vary between operation systems.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the operation completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error // Result of operation.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code) @endcode
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code))
+        SyncToken ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(SyncToken,
+      void (asio::error_code))
+  async_sync_data(
+      ASIO_MOVE_ARG(SyncToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<SyncToken, void (asio::error_code)>(
+          declval<initiate_async_sync_data>(), token)))
+  {
+    return async_initiate<SyncToken, void (asio::error_code)>(
+        initiate_async_sync_data(this), token);
+  }
+
 protected:
   /// Protected destructor to prevent deletion through this type.
   /**
@@ -817,6 +1101,175 @@ private:
   // Disallow copying and assignment.
   basic_file(const basic_file&) ASIO_DELETED;
   basic_file& operator=(const basic_file&) ASIO_DELETED;
+
+  class initiate_async_open
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_open(basic_file* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename Handler>
+    void operator()(ASIO_MOVE_ARG(Handler) handler,
+        const std::string& path, file_base::flags open_flags) const
+    {
+      detail::non_const_lvalue<Handler> handler2(handler);
+      self_->impl_.get_service().async_open(
+          self_->impl_.get_implementation(), path, open_flags,
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_file* self_;
+  };
+
+  class initiate_async_close
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_close(basic_file* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename Handler>
+    void operator()(ASIO_MOVE_ARG(Handler) handler) const
+    {
+      detail::non_const_lvalue<Handler> handler2(handler);
+      self_->impl_.get_service().async_close(
+          self_->impl_.get_implementation(),
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_file* self_;
+  };
+
+  class initiate_async_size
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_size(basic_file* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename Handler>
+    void operator()(ASIO_MOVE_ARG(Handler) handler) const
+    {
+      detail::non_const_lvalue<Handler> handler2(handler);
+      self_->impl_.get_service().async_size(
+          self_->impl_.get_implementation(),
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_file* self_;
+  };
+
+  class initiate_async_resize
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_resize(basic_file* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename Handler>
+    void operator()(ASIO_MOVE_ARG(Handler) handler, uint64_t n) const
+    {
+      detail::non_const_lvalue<Handler> handler2(handler);
+      self_->impl_.get_service().async_resize(
+          self_->impl_.get_implementation(), n,
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_file* self_;
+  };
+
+  class initiate_async_sync_all
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_sync_all(basic_file* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename Handler>
+    void operator()(ASIO_MOVE_ARG(Handler) handler) const
+    {
+      detail::non_const_lvalue<Handler> handler2(handler);
+      self_->impl_.get_service().async_sync_all(
+          self_->impl_.get_implementation(),
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_file* self_;
+  };
+
+  class initiate_async_sync_data
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_sync_data(basic_file* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename Handler>
+    void operator()(ASIO_MOVE_ARG(Handler) handler) const
+    {
+      detail::non_const_lvalue<Handler> handler2(handler);
+      self_->impl_.get_service().async_sync_data(
+          self_->impl_.get_implementation(),
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_file* self_;
+  };
 };
 
 } // namespace asio
@@ -28,6 +28,11 @@
 #include "asio/post.hpp"
 #include "asio/socket_base.hpp"
 
+#if defined(ASIO_HAS_SO_TIMESTAMPING)
+# include "asio/detail/cstdint.hpp"
+# include "asio/detail/socket_ops.hpp"
+#endif // defined(ASIO_HAS_SO_TIMESTAMPING)
+
 #if defined(ASIO_WINDOWS_RUNTIME)
 # include "asio/detail/null_socket_service.hpp"
 #elif defined(ASIO_HAS_IOCP)
@@ -772,6 +777,78 @@ public:
     return impl_.get_service().available(impl_.get_implementation(), ec);
   }
 
+#if defined(ASIO_HAS_SO_TIMESTAMPING) || defined(GENERATING_DOCUMENTATION)
+  /// Read a transmit timestamp from the socket's error queue.
+  /**
+   * This function reads the next transmit timestamp that was generated for
+   * data sent on the socket, as selected by the socket_base::timestamping
+   * option. The function does not block. An asynchronous wait for
+   * socket_base::wait_error may be used to learn when timestamps are queued.
+   *
+   * @param id Set to the identifier of the send to which the timestamp
+   * belongs. When the socket_base::timestamp_opt_id flag is set, datagram
+   * sends are numbered from zero and stream sends are identified by the
+   * number of bytes sent up to and including the timestamped byte, less one.
+   *
+   * @param timestamp Set to the time at which the data was sent, in
+   * nanoseconds since the epoch of the system clock or, for hardware
+   * timestamps, of the network interface's clock.
+   *
+   * @returns @c true if a timestamp was read, or @c false if none was queued.
+   *
+   * @throws asio::system_error Thrown on failure.
+   *
+   * @note Other entries on the error queue, such as the notifications used by
+   * zero-copy sends, are discarded.
+   */
+  bool receive_send_timestamp(uint32_t& id, uint64_t& timestamp)
+  {
+    asio::error_code ec;
+    bool result = receive_send_timestamp(id, timestamp, ec);
+    asio::detail::throw_error(ec, "receive_send_timestamp");
+    return result;
+  }
+
+  /// Read a transmit timestamp from the socket's error queue.
+  /**
+   * This function reads the next transmit timestamp that was generated for
+   * data sent on the socket, as selected by the socket_base::timestamping
+   * option. The function does not block. An asynchronous wait for
+   * socket_base::wait_error may be used to learn when timestamps are queued.
+   *
+   * @param id Set to the identifier of the send to which the timestamp
+   * belongs.
+   *
+   * @param timestamp Set to the time at which the data was sent.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @returns @c true if a timestamp was read, or @c false if none was queued
+   * or an error occurred.
+   */
+  bool receive_send_timestamp(uint32_t& id,
+      uint64_t& timestamp, asio::error_code& ec)
+  {
+    for (;;)
+    {
+      if (detail::socket_ops::recv_send_timestamp(
+            native_handle(), id, timestamp, ec) == 0)
+        return true;
+
+      // Retry operation if interrupted by signal.
+      if (ec == asio::error::interrupted)
+        continue;
+
+      // An empty queue is not an error.
+      if (ec == asio::error::would_block
+          || ec == asio::error::try_again)
+        ec = asio::error_code();
+      return false;
+    }
+  }
+#endif // defined(ASIO_HAS_SO_TIMESTAMPING)
+       //   || defined(GENERATING_DOCUMENTATION)
+
   /// Bind the socket to the given local endpoint.
   /**
    * This function binds the socket to the specified endpoint on the local
@@ -87,6 +87,9 @@ class basic_socket_acceptor
 private:
   class initiate_async_wait;
   class initiate_async_accept;
+#if !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
+  class initiate_async_accept_some;
+#endif // !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
   class initiate_async_move_accept;
 
 public:
@@ -1540,6 +1543,162 @@ public:
   }
 #endif // !defined(ASIO_NO_EXTENSIONS)
 
+#if (!defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)) \
+  || defined(GENERATING_DOCUMENTATION)
+  /// Accept a batch of new connections.
+  /**
+   * This function is used to accept the connections that are queued on the
+   * acceptor into a range of sockets. The function call will block until a
+   * new connection has been accepted successfully or an error occurs, and then
+   * also accepts any other connections that are already queued, without
+   * waiting for more to arrive.
+   *
+   * @note A single operation accepts at most 64 connections. Sockets that
+   * follow those into which connections were accepted are left unmodified.
+   *
+   * @param begin An iterator to the first socket. The sockets must not be
+   * open.
+   *
+   * @param end An iterator one past the last socket.
+   *
+   * @returns The number of connections accepted, which were placed in the
+   * sockets at the start of the range.
+   *
+   * @throws asio::system_error Thrown on failure.
+   *
+   * @par Example
+   * @code
+   * asio::ip::tcp::acceptor acceptor(my_context);
+   * ...
+   * asio::ip::tcp::socket sockets[16] = { ... };
+   * std::size_t n = acceptor.accept_some(sockets, sockets + 16);
+   * @endcode
+   */
+  template <typename SocketIterator>
+  std::size_t accept_some(SocketIterator begin, SocketIterator end)
+  {
+    asio::error_code ec;
+    std::size_t n = impl_.get_service().accept_some(
+        impl_.get_implementation(), begin, end, ec);
+    asio::detail::throw_error(ec, "accept_some");
+    return n;
+  }
+
+  /// Accept a batch of new connections.
+  /**
+   * This function is used to accept the connections that are queued on the
+   * acceptor into a range of sockets. The function call will block until a
+   * new connection has been accepted successfully or an error occurs, and then
+   * also accepts any other connections that are already queued, without
+   * waiting for more to arrive.
+   *
+   * @note A single operation accepts at most 64 connections. Sockets that
+   * follow those into which connections were accepted are left unmodified.
+   *
+   * @param begin An iterator to the first socket. The sockets must not be
+   * open.
+   *
+   * @param end An iterator one past the last socket.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @returns The number of connections accepted, which were placed in the
+   * sockets at the start of the range.
+   */
+  template <typename SocketIterator>
+  std::size_t accept_some(SocketIterator begin,
+      SocketIterator end, asio::error_code& ec)
+  {
+    return impl_.get_service().accept_some(
+        impl_.get_implementation(), begin, end, ec);
+  }
+
+  /// Start an asynchronous accept of a batch of new connections.
+  /**
+   * This function is used to asynchronously accept the connections that are
+   * queued on the acceptor into a range of sockets. It is an initiating
+   * function for an @ref asynchronous_operation, and always returns
+   * immediately. The operation completes once at least one connection has been
+   * accepted, and also accepts any other connections that are already queued,
+   * so that a burst of connections is taken with a single wait for readiness.
+   *
+   * @note A single operation accepts at most 64 connections. Sockets that
+   * follow those into which connections were accepted are left unmodified.
+   *
+   * @param begin An iterator to the first socket. The sockets must not be
+   * open. Although the iterators may be copied as necessary, ownership of the
+   * sockets is retained by the caller, which must guarantee that they remain
+   * valid until the completion handler is called.
+   *
+   * @param end An iterator one past the last socket.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the accept completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t sockets_accepted // Number of connections accepted.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @par Example
+   * @code
+   * void accept_handler(const asio::error_code& error, std::size_t n)
+   * {
+   *   if (!error)
+   *   {
+   *     // Accept succeeded. The first n sockets are connected.
+   *   }
+   * }
+   *
+   * ...
+   *
+   * asio::ip::tcp::acceptor acceptor(my_context);
+   * ...
+   * std::vector<asio::ip::tcp::socket> sockets = ...;
+   * acceptor.async_accept_some(sockets.begin(), sockets.end(),
+   *     accept_handler);
+   * @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX operating systems, this asynchronous operation supports
+   * cancellation for the following asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename SocketIterator,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) AcceptToken
+          ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(AcceptToken,
+      void (asio::error_code, std::size_t))
+  async_accept_some(SocketIterator begin, SocketIterator end,
+      ASIO_MOVE_ARG(AcceptToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<AcceptToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_accept_some>(), token, begin, end)))
+  {
+    return async_initiate<AcceptToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_accept_some(this), token, begin, end);
+  }
+#endif // (!defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME))
+       //   || defined(GENERATING_DOCUMENTATION)
+
 #if defined(ASIO_HAS_MOVE) || defined(GENERATING_DOCUMENTATION)
   /// Accept a new connection.
   /**
@@ -2699,6 +2858,42 @@ private:
     basic_socket_acceptor* self_;
   };
 
+#if !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
+  class initiate_async_accept_some
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_accept_some(basic_socket_acceptor* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename AcceptHandler, typename SocketIterator>
+    void operator()(ASIO_MOVE_ARG(AcceptHandler) handler,
+        SocketIterator begin, SocketIterator end) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ReadHandler,
+      // which has the same signature.
+      ASIO_READ_HANDLER_CHECK(AcceptHandler, handler) type_check;
+
+      detail::non_const_lvalue<AcceptHandler> handler2(handler);
+      self_->impl_.get_service().async_accept_some(
+          self_->impl_.get_implementation(), begin, end,
+          handler2.value, self_->impl_.get_executor());
+    }
+
+  private:
+    basic_socket_acceptor* self_;
+  };
+#endif // !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
+
   class initiate_async_move_accept
   {
   public:
@@ -19,9 +19,12 @@
 #include <cstddef>
 #include "asio/async_result.hpp"
 #include "asio/basic_socket.hpp"
+#include "asio/detail/chrono.hpp"
+#include "asio/detail/connect_and_send_op.hpp"
 #include "asio/detail/handler_type_requirements.hpp"
 #include "asio/detail/non_const_lvalue.hpp"
 #include "asio/detail/throw_error.hpp"
+#include "asio/detail/zero_copy_receive_op.hpp"
 #include "asio/error.hpp"
 
 #include "asio/detail/push_options.hpp"
@@ -63,6 +66,13 @@ class basic_stream_socket
 private:
   class initiate_async_send;
   class initiate_async_receive;
+  class initiate_async_connect_and_send;
+#if defined(ASIO_HAS_MSG_ZEROCOPY)
+  class initiate_async_send_zero_copy;
+#endif // defined(ASIO_HAS_MSG_ZEROCOPY)
+#if defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+  class initiate_async_receive_zero_copy;
+#endif // defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
 
 public:
   /// The type of the executor associated with the object.
@@ -585,6 +595,194 @@ public:
         initiate_async_send(this), token, buffers, flags);
   }
 
+  /// Start an asynchronous connect that sends data with the handshake.
+  /**
+   * This function is used to asynchronously connect the socket to the
+   * specified remote endpoint and then send data on it. It is an initiating
+   * function for an @ref asynchronous_operation, and always returns
+   * immediately.
+   *
+   * Where TCP Fast Open is supported, the socket is enabled for it using the
+   * @c TCP_FASTOPEN_CONNECT option. If a Fast Open cookie for the peer is
+   * cached from an earlier connection, the data is carried in the SYN, and the
+   * peer may respond one round trip sooner than after a separate connect and
+   * send. Otherwise, or if the peer does not accept the data in the SYN, the
+   * data is sent once the connection is established.
+   *
+   * The socket is automatically opened if it is not already open. If the
+   * operation fails, and the socket was automatically opened, the socket is
+   * not returned to the closed state.
+   *
+   * @param peer_endpoint The remote endpoint to which the socket will be
+   * connected. Copies will be made of the endpoint object as required.
+   *
+   * @param buffers One or more data buffers to be sent on the socket. Although
+   * the buffers object may be copied as necessary, ownership of the underlying
+   * memory blocks is retained by the caller, which must guarantee that they
+   * remain valid until the completion handler is called.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the send completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes sent.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @note As with async_send, the operation may not transmit all of the data
+   * to the peer. Consider using the @ref async_write function to send the
+   * remainder.
+   *
+   * @note When the data is carried in the SYN, the operation completes once
+   * the data has been queued, and a failure to connect is reported by the next
+   * operation on the socket.
+   *
+   * @par Example
+   * @code
+   * asio::ip::tcp::socket socket(my_context);
+   * socket.async_connect_and_send(endpoint, asio::buffer(request),
+   *     [](asio::error_code ec, std::size_t n)
+   *     {
+   *       ...
+   *     });
+   * @endcode
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   */
+  template <typename ConstBufferSequence,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken
+          ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(WriteToken,
+      void (asio::error_code, std::size_t))
+  async_connect_and_send(const endpoint_type& peer_endpoint,
+      const ConstBufferSequence& buffers,
+      ASIO_MOVE_ARG(WriteToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_connect_and_send>(), token,
+          peer_endpoint, buffers, declval<asio::error_code&>())))
+  {
+    asio::error_code open_ec;
+    if (!this->is_open())
+    {
+      const protocol_type protocol = peer_endpoint.protocol();
+      this->impl_.get_service().open(
+          this->impl_.get_implementation(), protocol, open_ec);
+    }
+
+#if defined(ASIO_HAS_TCP_FAST_OPEN)
+    // A deferred connect is only completed by a send, so Fast Open is not
+    // used when there is no data. The option is unsupported for protocols
+    // other than TCP, which then connect as usual.
+    if (!open_ec && asio::buffer_size(buffers) > 0)
+    {
+      asio::error_code ignored_ec;
+      this->impl_.get_service().set_option(
+          this->impl_.get_implementation(),
+          detail::socket_option::boolean<ASIO_OS_DEF(IPPROTO_TCP),
+            ASIO_OS_DEF(TCP_FASTOPEN_CONNECT)>(true), ignored_ec);
+    }
+#endif // defined(ASIO_HAS_TCP_FAST_OPEN)
+
+    return async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_connect_and_send(this), token,
+        peer_endpoint, buffers, open_ec);
+  }
+
+#if defined(ASIO_HAS_MSG_ZEROCOPY) || defined(GENERATING_DOCUMENTATION)
+  /// Start an asynchronous zero-copy send.
+  /**
+   * This function is used to asynchronously send data on the stream socket
+   * without copying it into the kernel's socket buffers. On first use the
+   * socket is enabled for zero-copy sends using the @c SO_ZEROCOPY option, and
+   * the data is then sent with the @c MSG_ZEROCOPY flag. The operation does not
+   * complete until the kernel notifies, through the socket's error queue, that
+   * it has released the pages of the data being sent. This function always
+   * returns immediately.
+   *
+   * Zero-copy sends have a fixed cost for pinning and releasing pages, and
+   * benefit only large writes, typically of 10KB or more. Where the kernel
+   * cannot avoid copying, such as on the loopback interface, the operation
+   * still completes normally.
+   *
+   * @param buffers One or more data buffers to be sent on the socket. Although
+   * the buffers object may be copied as necessary, ownership of the underlying
+   * memory blocks is retained by the caller, which must guarantee that they
+   * remain valid, and are not modified, until the completion handler is
+   * called.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the send completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes sent.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @note The send operation may not transmit all of the data to the peer.
+   * Subsequent writes on the socket are not started until the operation
+   * completes.
+   *
+   * @note If the operation is cancelled after the data has been sent, the
+   * kernel may still refer to the buffers when the completion handler is
+   * called with the asio::error::operation_aborted error.
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename ConstBufferSequence,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken
+          ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(WriteToken,
+      void (asio::error_code, std::size_t))
+  async_send_zero_copy(const ConstBufferSequence& buffers,
+      ASIO_MOVE_ARG(WriteToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_send_zero_copy>(), token, buffers)))
+  {
+    return async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_send_zero_copy(this), token, buffers);
+  }
+#endif // defined(ASIO_HAS_MSG_ZEROCOPY) || defined(GENERATING_DOCUMENTATION)
+
   /// Receive some data on the socket.
   /**
    * This function is used to receive data on the stream socket. The function
@@ -839,6 +1037,82 @@ public:
         initiate_async_receive(this), token, buffers, flags);
   }
 
+#if defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE) \
+  || defined(GENERATING_DOCUMENTATION)
+  /// Start an asynchronous zero-copy receive.
+  /**
+   * This function is used to asynchronously receive data from a TCP socket
+   * without copying it from the kernel's socket buffers. Whole pages of
+   * received data are mapped read-only into the @c buffer object using the
+   * @c TCP_ZEROCOPY_RECEIVE socket option, and any remainder is copied. This
+   * function always returns immediately.
+   *
+   * @param buffer The buffer that will hold the received data. Ownership of
+   * the buffer is retained by the caller, which must guarantee that it remains
+   * valid until the completion handler is called. On completion, the data is
+   * available from the buffer's @c data() function until the next receive
+   * operation using the buffer is started.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes received.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @note Mapping avoids a copy only for payloads that the network interface
+   * delivers as whole pages, which typically requires a large MTU and header
+   * splitting. Other data is received through the copy buffer.
+   *
+   * @par Example
+   * @code
+   * asio::zero_copy_receive_buffer buffer(2 * 1024 * 1024);
+   * ...
+   * socket.async_receive_zero_copy(buffer,
+   *     [&](asio::error_code ec, std::size_t n)
+   *     {
+   *       if (!ec)
+   *         consume(buffer.data());
+   *     });
+   * @endcode
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) ReadToken
+          ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(ReadToken,
+      void (asio::error_code, std::size_t))
+  async_receive_zero_copy(zero_copy_receive_buffer& buffer,
+      ASIO_MOVE_ARG(ReadToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<ReadToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_receive_zero_copy>(), token, &buffer)))
+  {
+    return async_initiate<ReadToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_receive_zero_copy(this), token, &buffer);
+  }
+#endif // defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+       //   || defined(GENERATING_DOCUMENTATION)
+
   /// Write some data to the socket.
   /**
    * This function is used to write data to the stream socket. The function call
@@ -972,6 +1246,74 @@ public:
         buffers, socket_base::message_flags(0));
   }
 
+#if defined(ASIO_HAS_CHRONO) || defined(GENERATING_DOCUMENTATION)
+  /// Start an asynchronous write with a deadline.
+  /**
+   * This function is used to asynchronously write data to the stream socket,
+   * failing with asio::error::timed_out if no data has been written by the
+   * specified expiry time. It is an initiating function for an
+   * @ref asynchronous_operation, and always returns immediately.
+   *
+   * @param buffers One or more data buffers to be written to the socket.
+   * Although the buffers object may be copied as necessary, ownership of the
+   * underlying memory blocks is retained by the caller, which must guarantee
+   * that they remain valid until the completion handler is called.
+   *
+   * @param expiry The time at which the operation is abandoned.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the write completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes written.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @note When io_uring is the default backend, the deadline is enforced by the
+   * kernel using a linked timeout. Otherwise an internal timer is used.
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX or Windows operating systems, this asynchronous operation supports
+   * cancellation for the following asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename ConstBufferSequence,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken
+          ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(WriteToken,
+      void (asio::error_code, std::size_t))
+  async_write_some(const ConstBufferSequence& buffers,
+      const chrono::steady_clock::time_point& expiry,
+      ASIO_MOVE_ARG(WriteToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_send>(), token,
+          buffers, socket_base::message_flags(0), expiry)))
+  {
+    return async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_send(this), token,
+        buffers, socket_base::message_flags(0), expiry);
+  }
+#endif // defined(ASIO_HAS_CHRONO) || defined(GENERATING_DOCUMENTATION)
+
   /// Read some data from the socket.
   /**
    * This function is used to read data from the stream socket. The function
@@ -1108,6 +1450,81 @@ public:
         buffers, socket_base::message_flags(0));
   }
 
+#if defined(ASIO_HAS_CHRONO) || defined(GENERATING_DOCUMENTATION)
+  /// Start an asynchronous read with a deadline.
+  /**
+   * This function is used to asynchronously read data from the stream socket,
+   * failing with asio::error::timed_out if no data has been read by the
+   * specified expiry time. It is an initiating function for an
+   * @ref asynchronous_operation, and always returns immediately.
+   *
+   * @param buffers One or more buffers into which the data will be read.
+   * Although the buffers object may be copied as necessary, ownership of the
+   * underlying memory blocks is retained by the caller, which must guarantee
+   * that they remain valid until the completion handler is called.
+   *
+   * @param expiry The time at which the operation is abandoned.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the read completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes read.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @note When io_uring is the default backend, the deadline is enforced by the
+   * kernel using a linked timeout. Otherwise an internal timer is used.
+   *
+   * @par Example
+   * @code
+   * socket.async_read_some(asio::buffer(data, size),
+   *     asio::chrono::steady_clock::now() + asio::chrono::seconds(5),
+   *     handler);
+   * @endcode
+   *
+   * @par Per-Operation Cancellation
+   * On POSIX or Windows operating systems, this asynchronous operation supports
+   * cancellation for the following asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * @li @c cancellation_type::total
+   */
+  template <typename MutableBufferSequence,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) ReadToken
+          ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(ReadToken,
+      void (asio::error_code, std::size_t))
+  async_read_some(const MutableBufferSequence& buffers,
+      const chrono::steady_clock::time_point& expiry,
+      ASIO_MOVE_ARG(ReadToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<ReadToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_receive>(), token,
+          buffers, socket_base::message_flags(0), expiry)))
+  {
+    return async_initiate<ReadToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_receive(this), token,
+        buffers, socket_base::message_flags(0), expiry);
+  }
+#endif // defined(ASIO_HAS_CHRONO) || defined(GENERATING_DOCUMENTATION)
+
 private:
   // Disallow copying and assignment.
   basic_stream_socket(const basic_stream_socket&) ASIO_DELETED;
@@ -1143,9 +1560,129 @@ private:
           handler2.value, self_->impl_.get_executor());
     }
 
+#if defined(ASIO_HAS_CHRONO)
+    template <typename WriteHandler, typename ConstBufferSequence>
+    void operator()(ASIO_MOVE_ARG(WriteHandler) handler,
+        const ConstBufferSequence& buffers,
+        socket_base::message_flags flags,
+        const chrono::steady_clock::time_point& expiry) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+      detail::non_const_lvalue<WriteHandler> handler2(handler);
+      self_->impl_.get_service().async_send(
+          self_->impl_.get_implementation(), buffers, flags,
+          expiry, handler2.value, self_->impl_.get_executor());
+    }
+#endif // defined(ASIO_HAS_CHRONO)
+
+  private:
+    basic_stream_socket* self_;
+  };
+
+  class initiate_async_connect_and_send
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_connect_and_send(basic_stream_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename WriteHandler, typename ConstBufferSequence>
+    void operator()(ASIO_MOVE_ARG(WriteHandler) handler,
+        const endpoint_type& peer_endpoint,
+        const ConstBufferSequence& buffers,
+        const asio::error_code& open_ec) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+      detail::non_const_lvalue<WriteHandler> handler2(handler);
+      detail::start_connect_and_send_op(*self_,
+          peer_endpoint, buffers, open_ec, handler2.value);
+    }
+
+  private:
+    basic_stream_socket* self_;
+  };
+
+#if defined(ASIO_HAS_MSG_ZEROCOPY)
+  class initiate_async_send_zero_copy
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_send_zero_copy(basic_stream_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename WriteHandler, typename ConstBufferSequence>
+    void operator()(ASIO_MOVE_ARG(WriteHandler) handler,
+        const ConstBufferSequence& buffers) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+      detail::non_const_lvalue<WriteHandler> handler2(handler);
+      self_->impl_.get_service().async_send_zero_copy(
+          self_->impl_.get_implementation(), buffers,
+          handler2.value, self_->impl_.get_executor());
+    }
+
   private:
     basic_stream_socket* self_;
   };
+#endif // defined(ASIO_HAS_MSG_ZEROCOPY)
+
+#if defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+  class initiate_async_receive_zero_copy
+  {
+  public:
+    typedef Executor executor_type;
+
+    explicit initiate_async_receive_zero_copy(basic_stream_socket* self)
+      : self_(self)
+    {
+    }
+
+    const executor_type& get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename ReadHandler>
+    void operator()(ASIO_MOVE_ARG(ReadHandler) handler,
+        zero_copy_receive_buffer* buffer) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ReadHandler.
+      ASIO_READ_HANDLER_CHECK(ReadHandler, handler) type_check;
+
+      detail::non_const_lvalue<ReadHandler> handler2(handler);
+      detail::start_zero_copy_receive_op(*self_, *buffer, handler2.value);
+    }
+
+  private:
+    basic_stream_socket* self_;
+  };
+#endif // defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
 
   class initiate_async_receive
   {
@@ -1177,6 +1714,24 @@ private:
           handler2.value, self_->impl_.get_executor());
     }
 
+#if defined(ASIO_HAS_CHRONO)
+    template <typename ReadHandler, typename MutableBufferSequence>
+    void operator()(ASIO_MOVE_ARG(ReadHandler) handler,
+        const MutableBufferSequence& buffers,
+        socket_base::message_flags flags,
+        const chrono::steady_clock::time_point& expiry) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ReadHandler.
+      ASIO_READ_HANDLER_CHECK(ReadHandler, handler) type_check;
+
+      detail::non_const_lvalue<ReadHandler> handler2(handler);
+      self_->impl_.get_service().async_receive(
+          self_->impl_.get_implementation(), buffers, flags,
+          expiry, handler2.value, self_->impl_.get_executor());
+    }
+#endif // defined(ASIO_HAS_CHRONO)
+
   private:
     basic_stream_socket* self_;
   };
@@ -0,0 +1,200 @@
+//
+// datagram_message.hpp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DATAGRAM_MESSAGE_HPP
+#define ASIO_DATAGRAM_MESSAGE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include "asio/buffer.hpp"
+#include "asio/detail/cstdint.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+/// Describes one datagram in a batched send or receive operation.
+/**
+ * The datagram_message class template associates a buffer with the endpoint
+ * of the datagram's peer and the number of bytes transferred. A range of
+ * these messages is passed to basic_datagram_socket::receive_many,
+ * basic_datagram_socket::send_many and their asynchronous counterparts.
+ *
+ * When receiving, the buffer determines where the datagram's payload is
+ * written and the endpoint is set to the sender's address. When sending, the
+ * buffer holds the payload and the endpoint gives the destination. In both
+ * cases the size is set to the number of bytes transferred.
+ *
+ * Where UDP segmentation offload is supported, a non-zero segment size on a
+ * message being sent asks for its buffer to be split into datagrams of that
+ * size. On receipt, the segment size is set when the buffer holds several
+ * datagrams that were coalesced by the ip::udp::receive_offload option, and
+ * is otherwise zero.
+ *
+ * Where kernel timestamping is supported and has been enabled using the
+ * socket_base::receive_timestamps or socket_base::timestamping options, a
+ * message that is received also records the time at which the datagram
+ * arrived, in nanoseconds since the epoch. Comparing this with the time at
+ * which the completion handler runs separates the network latency from the
+ * time spent queued for the application.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ */
+template <typename Endpoint, typename Buffer = mutable_buffer>
+class datagram_message
+{
+public:
+  /// The type of the endpoint.
+  typedef Endpoint endpoint_type;
+
+  /// The type of the buffer.
+  typedef Buffer buffer_type;
+
+  /// Default constructor.
+  datagram_message()
+    : buffer_(),
+      endpoint_(),
+      size_(0),
+      segment_size_(0),
+      timestamp_(0),
+      hardware_timestamp_(0)
+  {
+  }
+
+  /// Construct a message for a receive operation.
+  explicit datagram_message(const Buffer& b)
+    : buffer_(b),
+      endpoint_(),
+      size_(0),
+      segment_size_(0),
+      timestamp_(0),
+      hardware_timestamp_(0)
+  {
+  }
+
+  /// Construct a message for a send operation.
+  datagram_message(const Buffer& b, const Endpoint& e)
+    : buffer_(b),
+      endpoint_(e),
+      size_(0),
+      segment_size_(0),
+      timestamp_(0),
+      hardware_timestamp_(0)
+  {
+  }
+
+  /// Get the buffer.
+  const Buffer& buffer() const ASIO_NOEXCEPT
+  {
+    return buffer_;
+  }
+
+  /// Set the buffer.
+  void buffer(const Buffer& b) ASIO_NOEXCEPT
+  {
+    buffer_ = b;
+  }
+
+  /// Get the endpoint.
+  Endpoint& endpoint() ASIO_NOEXCEPT
+  {
+    return endpoint_;
+  }
+
+  /// Get the endpoint.
+  const Endpoint& endpoint() const ASIO_NOEXCEPT
+  {
+    return endpoint_;
+  }
+
+  /// Set the endpoint.
+  void endpoint(const Endpoint& e)
+  {
+    endpoint_ = e;
+  }
+
+  /// Get the number of bytes transferred by the last operation.
+  std::size_t size() const ASIO_NOEXCEPT
+  {
+    return size_;
+  }
+
+  /// Set the number of bytes transferred.
+  void size(std::size_t n) ASIO_NOEXCEPT
+  {
+    size_ = n;
+  }
+
+  /// Get the segment size.
+  std::size_t segment_size() const ASIO_NOEXCEPT
+  {
+    return segment_size_;
+  }
+
+  /// Set the segment size.
+  void segment_size(std::size_t n) ASIO_NOEXCEPT
+  {
+    segment_size_ = n;
+  }
+
+  /// Get the software receive timestamp.
+  /**
+   * @returns The time at which the kernel received the datagram, in
+   * nanoseconds since the epoch of the system clock, or zero if no software
+   * timestamp was reported.
+   */
+  uint64_t timestamp() const ASIO_NOEXCEPT
+  {
+    return timestamp_;
+  }
+
+  /// Set the software receive timestamp.
+  void timestamp(uint64_t t) ASIO_NOEXCEPT
+  {
+    timestamp_ = t;
+  }
+
+  /// Get the hardware receive timestamp.
+  /**
+   * @returns The time at which the network interface received the datagram,
+   * in nanoseconds since the epoch of the interface's clock, or zero if no
+   * hardware timestamp was reported.
+   */
+  uint64_t hardware_timestamp() const ASIO_NOEXCEPT
+  {
+    return hardware_timestamp_;
+  }
+
+  /// Set the hardware receive timestamp.
+  void hardware_timestamp(uint64_t t) ASIO_NOEXCEPT
+  {
+    hardware_timestamp_ = t;
+  }
+
+private:
+  Buffer buffer_;
+  Endpoint endpoint_;
+  std::size_t size_;
+  std::size_t segment_size_;
+  uint64_t timestamp_;
+  uint64_t hardware_timestamp_;
+};
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DATAGRAM_MESSAGE_HPP
@@ -0,0 +1,481 @@
+//
+// detail/background_file_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_BACKGROUND_FILE_OP_HPP
+#define ASIO_DETAIL_BACKGROUND_FILE_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_FILE)
+
+#include <string>
+#include "asio/error.hpp"
+#include "asio/file_base.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/cstdint.hpp"
+#include "asio/detail/fenced_block.hpp"
+#include "asio/detail/handler_alloc_helpers.hpp"
+#include "asio/detail/handler_work.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/detail/operation.hpp"
+
+#if defined(ASIO_HAS_IOCP)
+# include "asio/detail/win_iocp_io_context.hpp"
+#else // defined(ASIO_HAS_IOCP)
+# include "asio/detail/scheduler.hpp"
+#endif // defined(ASIO_HAS_IOCP)
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+class background_file_op_base : public operation
+{
+public:
+  // The error code to be passed to the completion handler.
+  asio::error_code ec_;
+
+protected:
+  background_file_op_base(func_type complete_func)
+    : operation(complete_func)
+  {
+  }
+};
+
+// Selects the binder used to deliver the result of a background operation.
+template <typename Handler, typename Function,
+    typename Result = typename Function::result_type>
+struct background_file_op_binder
+{
+  typedef binder2<Handler, asio::error_code, Result> type;
+
+  static type make(Handler& handler,
+      const asio::error_code& ec, const Function& function)
+  {
+    return type(handler, ec, function.result());
+  }
+};
+
+template <typename Handler, typename Function>
+struct background_file_op_binder<Handler, Function, void>
+{
+  typedef binder1<Handler, asio::error_code> type;
+
+  static type make(Handler& handler,
+      const asio::error_code& ec, const Function&)
+  {
+    return type(handler, ec);
+  }
+};
+
+// Commits the result of a background operation to the I/O object, and then
+// invokes the completion handler. This runs as part of the completion handler,
+// so that the I/O object's implementation is only changed by the thread that
+// owns it.
+template <typename Function, typename Binder>
+class background_file_completion
+{
+public:
+  background_file_completion(const Function& function, Binder& binder)
+    : function_(function),
+      binder_(ASIO_MOVE_CAST(Binder)(binder))
+  {
+  }
+
+  void operator()()
+  {
+    function_.commit(binder_.arg1_);
+    binder_();
+  }
+
+//private:
+  Function function_;
+  Binder binder_;
+};
+
+// An operation that runs a blocking file function on a background thread and
+// then delivers the result to the handler via the main scheduler.
+template <typename Function, typename Handler, typename IoExecutor>
+class background_file_op : public background_file_op_base
+{
+public:
+  ASIO_DEFINE_HANDLER_PTR(background_file_op);
+
+#if defined(ASIO_HAS_IOCP)
+  typedef class win_iocp_io_context scheduler_impl;
+#else
+  typedef class scheduler scheduler_impl;
+#endif
+
+  background_file_op(const Function& function, scheduler_impl& sched,
+      Handler& handler, const IoExecutor& io_ex)
+    : background_file_op_base(&background_file_op::do_complete),
+      function_(function),
+      scheduler_(sched),
+      handler_(ASIO_MOVE_CAST(Handler)(handler)),
+      work_(handler_, io_ex)
+  {
+  }
+
+  static void do_complete(void* owner, operation* base,
+      const asio::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the operation object.
+    ASIO_ASSUME(base != 0);
+    background_file_op* o(static_cast<background_file_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+
+    if (owner && owner != &o->scheduler_)
+    {
+      // The operation is being run on the background thread. Time to perform
+      // the blocking file operation.
+      o->function_(o->ec_);
+
+      // Pass operation back to main scheduler for completion.
+      o->scheduler_.post_deferred_completion(o);
+      p.v = p.p = 0;
+    }
+    else
+    {
+      // The operation has been returned to the main scheduler. The completion
+      // handler is ready to be delivered.
+
+      ASIO_HANDLER_COMPLETION((*o));
+
+      // Take ownership of the operation's outstanding work.
+      handler_work<Handler, IoExecutor> w(
+          ASIO_MOVE_CAST2(handler_work<Handler, IoExecutor>)(
+            o->work_));
+
+      ASIO_ERROR_LOCATION(o->ec_);
+
+      // Make a copy of the handler so that the memory can be deallocated
+      // before the upcall is made. Even if we're not about to make an upcall,
+      // a sub-object of the handler may be the true owner of the memory
+      // associated with the handler. Consequently, a local copy of the handler
+      // is required to ensure that any owning sub-object remains valid until
+      // after we have deallocated the memory here.
+      typedef background_file_op_binder<Handler, Function> binder_type;
+      typename binder_type::type handler(
+          binder_type::make(o->handler_, o->ec_, o->function_));
+      background_file_completion<Function, typename binder_type::type>
+        completion(o->function_, handler);
+      p.h = asio::detail::addressof(completion.binder_.handler_);
+      p.reset();
+
+      if (owner)
+      {
+        fenced_block b(fenced_block::half);
+        ASIO_HANDLER_INVOCATION_BEGIN((completion.binder_.arg1_));
+        w.complete(completion, completion.binder_.handler_);
+        ASIO_HANDLER_INVOCATION_END;
+      }
+    }
+  }
+
+private:
+  Function function_;
+  scheduler_impl& scheduler_;
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+};
+
+// An open that is being performed on the background thread. The I/O object's
+// implementation refers to it, so that the open can be abandoned if the
+// implementation is cancelled, closed, moved from or destroyed first. All
+// functions must be called from the thread that owns the I/O object.
+class background_file_pending_open
+  : private noncopyable
+{
+public:
+  background_file_pending_open()
+    : impl_(0),
+      link_(0)
+  {
+  }
+
+  ~background_file_pending_open()
+  {
+    abandon();
+  }
+
+  // Link the open to an implementation, abandoning any earlier open that is
+  // linked to it.
+  void link(void* impl, background_file_pending_open*& link)
+  {
+    abandon(link);
+    link = this;
+    impl_ = impl;
+    link_ = &link;
+  }
+
+  // Get the implementation, or null if the open has been abandoned.
+  void* impl() const
+  {
+    return impl_;
+  }
+
+  // Unlink the open from its implementation.
+  void abandon()
+  {
+    if (link_)
+      *link_ = 0;
+    impl_ = 0;
+    link_ = 0;
+  }
+
+  // Abandon the open that is linked to an implementation, if any.
+  static void abandon(background_file_pending_open* link)
+  {
+    if (link)
+      link->abandon();
+  }
+
+  // Transfer the open that is linked to one implementation to another.
+  static void move(void* impl, background_file_pending_open*& link,
+      background_file_pending_open*& other_link)
+  {
+    abandon(link);
+    link = other_link;
+    other_link = 0;
+    if (link)
+    {
+      link->impl_ = impl;
+      link->link_ = &link;
+    }
+  }
+
+private:
+  void* impl_;
+  background_file_pending_open** link_;
+};
+
+// A file implementation owned by a background open or close. The file is
+// opened into, or closed from, this temporary implementation.
+template <typename Service>
+class background_file_temporary
+  : private noncopyable
+{
+public:
+  explicit background_file_temporary(Service& service)
+    : service_(service)
+  {
+    service_.construct(impl_);
+  }
+
+  ~background_file_temporary()
+  {
+    service_.destroy(impl_);
+  }
+
+  Service& service_;
+  typename Service::implementation_type impl_;
+  background_file_pending_open pending_;
+};
+
+// Function objects used to perform file operations on the background thread.
+// The commit function is called by the thread that owns the I/O object, before
+// the completion handler is invoked.
+
+template <typename Service>
+class background_file_open
+{
+public:
+  typedef void result_type;
+
+  background_file_open(Service& service, const std::string& path,
+      file_base::flags open_flags, bool is_stream)
+    : temporary_(new background_file_temporary<Service>(service)),
+      path_(path),
+      open_flags_(open_flags)
+  {
+    service.set_is_stream(temporary_->impl_, is_stream);
+  }
+
+  // Get the link used to commit the open to the I/O object's implementation.
+  background_file_pending_open& pending()
+  {
+    return temporary_->pending_;
+  }
+
+  void operator()(asio::error_code& ec)
+  {
+    temporary_->service_.open(temporary_->impl_,
+        path_.c_str(), open_flags_, ec);
+  }
+
+  void commit(asio::error_code& ec)
+  {
+    typedef typename Service::implementation_type implementation_type;
+    implementation_type* impl = static_cast<implementation_type*>(
+        temporary_->pending_.impl());
+    temporary_->pending_.abandon();
+
+    // A file that is opened but not committed is closed when the temporary
+    // implementation is destroyed.
+    if (!impl)
+      ec = asio::error::operation_aborted;
+    else if (!ec && temporary_->service_.is_open(*impl))
+      ec = asio::error::already_open;
+    else if (!ec)
+      temporary_->service_.move_assign(*impl,
+          temporary_->service_, temporary_->impl_);
+  }
+
+private:
+  shared_ptr<background_file_temporary<Service> > temporary_;
+  std::string path_;
+  file_base::flags open_flags_;
+};
+
+template <typename Service>
+class background_file_close
+{
+public:
+  typedef void result_type;
+
+  explicit background_file_close(Service& service)
+    : temporary_(new background_file_temporary<Service>(service))
+  {
+  }
+
+  // Get the implementation into which the I/O object's file is moved.
+  typename Service::implementation_type& impl()
+  {
+    return temporary_->impl_;
+  }
+
+  void operator()(asio::error_code& ec)
+  {
+    temporary_->service_.close(temporary_->impl_, ec);
+  }
+
+  void commit(asio::error_code&)
+  {
+  }
+
+private:
+  shared_ptr<background_file_temporary<Service> > temporary_;
+};
+
+// The following function objects hold references to the service and to the
+// I/O object's implementation, which must remain valid until the operation
+// completes.
+
+template <typename Service>
+class background_file_resize
+{
+public:
+  typedef void result_type;
+
+  background_file_resize(Service& service,
+      typename Service::implementation_type& impl, uint64_t n)
+    : service_(&service),
+      impl_(&impl),
+      n_(n)
+  {
+  }
+
+  void operator()(asio::error_code& ec)
+  {
+    service_->resize(*impl_, n_, ec);
+  }
+
+  void commit(asio::error_code&)
+  {
+  }
+
+private:
+  Service* service_;
+  typename Service::implementation_type* impl_;
+  uint64_t n_;
+};
+
+template <typename Service>
+class background_file_sync
+{
+public:
+  typedef void result_type;
+
+  background_file_sync(Service& service,
+      typename Service::implementation_type& impl, bool data_only)
+    : service_(&service),
+      impl_(&impl),
+      data_only_(data_only)
+  {
+  }
+
+  void operator()(asio::error_code& ec)
+  {
+    if (data_only_)
+      service_->sync_data(*impl_, ec);
+    else
+      service_->sync_all(*impl_, ec);
+  }
+
+  void commit(asio::error_code&)
+  {
+  }
+
+private:
+  Service* service_;
+  typename Service::implementation_type* impl_;
+  bool data_only_;
+};
+
+template <typename Service>
+class background_file_size
+{
+public:
+  typedef uint64_t result_type;
+
+  background_file_size(Service& service,
+      typename Service::implementation_type& impl)
+    : service_(&service),
+      impl_(&impl),
+      size_(0)
+  {
+  }
+
+  void operator()(asio::error_code& ec)
+  {
+    size_ = service_->size(*impl_, ec);
+  }
+
+  void commit(asio::error_code&)
+  {
+  }
+
+  uint64_t result() const
+  {
+    return size_;
+  }
+
+private:
+  Service* service_;
+  typename Service::implementation_type* impl_;
+  uint64_t size_;
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_FILE)
+
+#endif // ASIO_DETAIL_BACKGROUND_FILE_OP_HPP
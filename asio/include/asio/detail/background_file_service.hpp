@@ -0,0 +1,118 @@
+//
+// detail/background_file_service.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_BACKGROUND_FILE_SERVICE_HPP
+#define ASIO_DETAIL_BACKGROUND_FILE_SERVICE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_FILE)
+
+#include "asio/execution_context.hpp"
+#include "asio/detail/background_file_op.hpp"
+#include "asio/detail/handler_cont_helpers.hpp"
+#include "asio/detail/handler_tracking.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/mutex.hpp"
+#include "asio/detail/scoped_ptr.hpp"
+#include "asio/detail/thread.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Runs file operations that have no asynchronous system interface on a private
+// background thread, in the same manner as asynchronous host resolution.
+class background_file_service :
+  public execution_context_service_base<background_file_service>
+{
+public:
+#if defined(ASIO_HAS_IOCP)
+  typedef class win_iocp_io_context scheduler_impl;
+#else
+  typedef class scheduler scheduler_impl;
+#endif
+
+  // Constructor.
+  ASIO_DECL background_file_service(execution_context& context);
+
+  // Destructor.
+  ASIO_DECL ~background_file_service();
+
+  // Destroy all user-defined handler objects owned by the service.
+  ASIO_DECL void shutdown();
+
+  // Perform any fork-related housekeeping.
+  ASIO_DECL void notify_fork(execution_context::fork_event fork_ev);
+
+  // Start an asynchronous operation that performs the given function on the
+  // background thread.
+  template <typename Function, typename Handler, typename IoExecutor>
+  void async_perform(const Function& function, Handler& handler,
+      const IoExecutor& io_ex, void* impl, const char* op_name)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef background_file_op<Function, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(function, scheduler_, handler, io_ex);
+
+    ASIO_HANDLER_CREATION((scheduler_.context(),
+          *p.p, "file", impl, 0, op_name));
+    (void)impl;
+    (void)op_name;
+
+    start_op(p.p, is_continuation);
+    p.v = p.p = 0;
+  }
+
+private:
+  // Helper function to start a background operation.
+  ASIO_DECL void start_op(background_file_op_base* op, bool is_continuation);
+
+  // Helper class to run the work scheduler in a thread.
+  class work_scheduler_runner;
+
+  // Start the work scheduler if it's not already running.
+  ASIO_DECL void start_work_thread();
+
+  // The scheduler implementation used to post completions.
+  scheduler_impl& scheduler_;
+
+  // Mutex to protect access to internal data.
+  asio::detail::mutex mutex_;
+
+  // Private scheduler used for performing blocking file operations.
+  asio::detail::scoped_ptr<scheduler_impl> work_scheduler_;
+
+  // Thread used for running the work scheduler's run loop.
+  asio::detail::scoped_ptr<asio::detail::thread> work_thread_;
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#if defined(ASIO_HEADER_ONLY)
+# include "asio/detail/impl/background_file_service.ipp"
+#endif // defined(ASIO_HEADER_ONLY)
+
+#endif // defined(ASIO_HAS_FILE)
+
+#endif // ASIO_DETAIL_BACKGROUND_FILE_SERVICE_HPP
@@ -16,6 +16,7 @@
 #endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
 
 #include "asio/detail/cstdint.hpp"
+#include "asio/detail/type_traits.hpp"
 
 #include "asio/detail/push_options.hpp"
 
@@ -29,6 +30,26 @@ struct gcd { enum { value = gcd<v2, v1 % v2>::value }; };
 template <int64_t v1>
 struct gcd<v1, 0> { enum { value = v1 }; };
 
+// Helper template to detect whether wait traits allow timers some slack.
+template <typename T, T>
+struct timer_slack_check
+{
+};
+
+template <typename, typename>
+char (&timer_slack_helper(...))[2];
+
+template <typename WaitTraits, typename Duration>
+char timer_slack_helper(
+    timer_slack_check<Duration (*)(), &WaitTraits::timer_slack>*);
+
+template <typename WaitTraits, typename Duration>
+struct has_timer_slack
+  : integral_constant<bool,
+      sizeof(timer_slack_helper<WaitTraits, Duration>(0)) == 1>
+{
+};
+
 // Adapts std::chrono clocks for use with a deadline timer.
 template <typename Clock, typename WaitTraits>
 struct chrono_time_traits
@@ -180,6 +201,37 @@ struct chrono_time_traits
   {
     return posix_time_duration(WaitTraits::to_wait_duration(d));
   }
+
+  // Get the time at which the scheduler should wake up for a timer that
+  // expires at the given time. When the wait traits allow timers some slack,
+  // the latest acceptable time is rounded down to a multiple of the slack so
+  // that timers which expire close together share a single wake-up.
+  static time_type to_wake_time(const time_type& t)
+  {
+    return to_wake_time(t, has_timer_slack<WaitTraits, duration_type>());
+  }
+
+private:
+  static time_type to_wake_time(const time_type& t, false_type)
+  {
+    return t;
+  }
+
+  static time_type to_wake_time(const time_type& t, true_type)
+  {
+    const duration_type slack = WaitTraits::timer_slack();
+    if (slack <= duration_type::zero())
+      return t;
+
+    const time_type latest = add(t, slack);
+    if (latest == (time_type::max)())
+      return t;
+
+    duration_type offset = latest.time_since_epoch() % slack;
+    if (offset < duration_type::zero())
+      offset += slack;
+    return latest - offset;
+  }
 };
 
 } // namespace detail
@@ -127,6 +127,12 @@ public:
       mutex_.lock();
   }
 
+  // Try to lock the mutex without blocking.
+  bool try_lock()
+  {
+    return enabled_ ? mutex_.try_lock() : true;
+  }
+
   // Unlock the mutex.
   void unlock()
   {
@@ -1706,7 +1706,7 @@
 # include <unistd.h>
 #endif // defined(ASIO_HAS_UNISTD_H)
 
-// Linux: epoll, eventfd, timerfd and io_uring.
+// Linux: epoll, eventfd, timerfd, splice, sendfile and io_uring.
 #if defined(__linux__)
 # include <linux/version.h>
 # if !defined(ASIO_HAS_EPOLL)
@@ -1730,6 +1730,66 @@
 #   endif // (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 8)
 #  endif // defined(ASIO_HAS_EPOLL)
 # endif // !defined(ASIO_HAS_TIMERFD)
+# if !defined(ASIO_HAS_SPLICE)
+#  if !defined(ASIO_DISABLE_SPLICE)
+#   if LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,17)
+#    if (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 5)
+#     define ASIO_HAS_SPLICE 1
+#    endif // (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 5)
+#   endif // LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,17)
+#  endif // !defined(ASIO_DISABLE_SPLICE)
+# endif // !defined(ASIO_HAS_SPLICE)
+# if !defined(ASIO_HAS_SENDFILE)
+#  if !defined(ASIO_DISABLE_SENDFILE)
+#   if LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,33)
+#    define ASIO_HAS_SENDFILE 1
+#   endif // LINUX_VERSION_CODE >= KERNEL_VERSION(2,6,33)
+#  endif // !defined(ASIO_DISABLE_SENDFILE)
+# endif // !defined(ASIO_HAS_SENDFILE)
+# if !defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+#  if !defined(ASIO_DISABLE_TCP_ZEROCOPY_RECEIVE)
+#   if LINUX_VERSION_CODE >= KERNEL_VERSION(4,18,0)
+#    define ASIO_HAS_TCP_ZEROCOPY_RECEIVE 1
+#   endif // LINUX_VERSION_CODE >= KERNEL_VERSION(4,18,0)
+#  endif // !defined(ASIO_DISABLE_TCP_ZEROCOPY_RECEIVE)
+# endif // !defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+# if !defined(ASIO_HAS_TCP_FAST_OPEN)
+#  if !defined(ASIO_DISABLE_TCP_FAST_OPEN)
+#   if LINUX_VERSION_CODE >= KERNEL_VERSION(4,11,0)
+#    define ASIO_HAS_TCP_FAST_OPEN 1
+#   endif // LINUX_VERSION_CODE >= KERNEL_VERSION(4,11,0)
+#  endif // !defined(ASIO_DISABLE_TCP_FAST_OPEN)
+# endif // !defined(ASIO_HAS_TCP_FAST_OPEN)
+# if !defined(ASIO_HAS_REUSEPORT_CBPF)
+#  if !defined(ASIO_DISABLE_REUSEPORT_CBPF)
+#   if LINUX_VERSION_CODE >= KERNEL_VERSION(4,6,0)
+#    define ASIO_HAS_REUSEPORT_CBPF 1
+#   endif // LINUX_VERSION_CODE >= KERNEL_VERSION(4,6,0)
+#  endif // !defined(ASIO_DISABLE_REUSEPORT_CBPF)
+# endif // !defined(ASIO_HAS_REUSEPORT_CBPF)
+# if !defined(ASIO_HAS_SO_TIMESTAMPING)
+#  if !defined(ASIO_DISABLE_SO_TIMESTAMPING)
+#   if LINUX_VERSION_CODE >= KERNEL_VERSION(3,17,0)
+#    define ASIO_HAS_SO_TIMESTAMPING 1
+#   endif // LINUX_VERSION_CODE >= KERNEL_VERSION(3,17,0)
+#  endif // !defined(ASIO_DISABLE_SO_TIMESTAMPING)
+# endif // !defined(ASIO_HAS_SO_TIMESTAMPING)
+# if !defined(ASIO_HAS_MMSG)
+#  if !defined(ASIO_DISABLE_MMSG)
+#   if LINUX_VERSION_CODE >= KERNEL_VERSION(3,0,0)
+#    if (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 14)
+#     define ASIO_HAS_MMSG 1
+#    endif // (__GLIBC__ > 2) || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 14)
+#   endif // LINUX_VERSION_CODE >= KERNEL_VERSION(3,0,0)
+#  endif // !defined(ASIO_DISABLE_MMSG)
+# endif // !defined(ASIO_HAS_MMSG)
+# if !defined(ASIO_HAS_UDP_GSO)
+#  if !defined(ASIO_DISABLE_UDP_GSO)
+#   if LINUX_VERSION_CODE >= KERNEL_VERSION(5,0,0)
+#    define ASIO_HAS_UDP_GSO 1
+#   endif // LINUX_VERSION_CODE >= KERNEL_VERSION(5,0,0)
+#  endif // !defined(ASIO_DISABLE_UDP_GSO)
+# endif // !defined(ASIO_HAS_UDP_GSO)
 # if defined(ASIO_HAS_IO_URING)
 #  if LINUX_VERSION_CODE < KERNEL_VERSION(5,10,0)
 #   error Linux kernel 5.10 or later is required to support io_uring
@@ -1744,6 +1804,28 @@
 # endif // !defined(ASIO_HAS_EPOLL) && defined(ASIO_HAS_IO_URING)
 #endif // !defined(ASIO_HAS_IO_URING_AS_DEFAULT)
 
+// Linux: io_uring rings may message one another to post across io_contexts.
+#if !defined(ASIO_HAS_IO_URING_MSG_RING)
+# if !defined(ASIO_DISABLE_IO_URING_MSG_RING)
+#  if defined(ASIO_HAS_IO_URING_AS_DEFAULT) && defined(ASIO_HAS_STD_ATOMIC)
+#   if LINUX_VERSION_CODE >= KERNEL_VERSION(5,18,0)
+#    define ASIO_HAS_IO_URING_MSG_RING 1
+#   endif // LINUX_VERSION_CODE >= KERNEL_VERSION(5,18,0)
+#  endif // defined(ASIO_HAS_IO_URING_AS_DEFAULT) && defined(ASIO_HAS_STD_ATOMIC)
+# endif // !defined(ASIO_DISABLE_IO_URING_MSG_RING)
+#endif // !defined(ASIO_HAS_IO_URING_MSG_RING)
+
+// Linux: stream sockets may send with MSG_ZEROCOPY when using epoll.
+#if !defined(ASIO_HAS_MSG_ZEROCOPY)
+# if !defined(ASIO_DISABLE_MSG_ZEROCOPY)
+#  if defined(ASIO_HAS_EPOLL)
+#   if LINUX_VERSION_CODE >= KERNEL_VERSION(4,14,0)
+#    define ASIO_HAS_MSG_ZEROCOPY 1
+#   endif // LINUX_VERSION_CODE >= KERNEL_VERSION(4,14,0)
+#  endif // defined(ASIO_HAS_EPOLL)
+# endif // !defined(ASIO_DISABLE_MSG_ZEROCOPY)
+#endif // !defined(ASIO_HAS_MSG_ZEROCOPY)
+
 // Mac OS X, FreeBSD, NetBSD, OpenBSD: kqueue.
 #if (defined(__MACH__) && defined(__APPLE__)) \
   || defined(__FreeBSD__) \
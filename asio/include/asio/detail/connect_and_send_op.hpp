@@ -0,0 +1,251 @@
+//
+// detail/connect_and_send_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_CONNECT_AND_SEND_OP_HPP
+#define ASIO_DETAIL_CONNECT_AND_SEND_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include "asio/associator.hpp"
+#include "asio/detail/base_from_cancellation_state.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/handler_alloc_helpers.hpp"
+#include "asio/detail/handler_cont_helpers.hpp"
+#include "asio/detail/handler_invoke_helpers.hpp"
+#include "asio/detail/handler_tracking.hpp"
+#include "asio/post.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+template <typename Socket, typename ConstBufferSequence, typename WriteHandler>
+class connect_and_send_op
+  : public base_from_cancellation_state<WriteHandler>
+{
+public:
+  typedef typename Socket::endpoint_type endpoint_type;
+
+  connect_and_send_op(Socket& socket, const endpoint_type& peer_endpoint,
+      const ConstBufferSequence& buffers, WriteHandler& handler)
+    : base_from_cancellation_state<WriteHandler>(handler),
+      socket_(socket),
+      peer_endpoint_(peer_endpoint),
+      buffers_(buffers),
+      start_(0),
+      connected_(false),
+      handler_(ASIO_MOVE_CAST(WriteHandler)(handler))
+  {
+  }
+
+#if defined(ASIO_HAS_MOVE)
+  connect_and_send_op(const connect_and_send_op& other)
+    : base_from_cancellation_state<WriteHandler>(other),
+      socket_(other.socket_),
+      peer_endpoint_(other.peer_endpoint_),
+      buffers_(other.buffers_),
+      start_(other.start_),
+      connected_(other.connected_),
+      handler_(other.handler_)
+  {
+  }
+
+  connect_and_send_op(connect_and_send_op&& other)
+    : base_from_cancellation_state<WriteHandler>(
+        ASIO_MOVE_CAST(base_from_cancellation_state<
+          WriteHandler>)(other)),
+      socket_(other.socket_),
+      peer_endpoint_(other.peer_endpoint_),
+      buffers_(ASIO_MOVE_CAST(ConstBufferSequence)(other.buffers_)),
+      start_(other.start_),
+      connected_(other.connected_),
+      handler_(ASIO_MOVE_CAST(WriteHandler)(other.handler_))
+  {
+  }
+#endif // defined(ASIO_HAS_MOVE)
+
+  void operator()(asio::error_code ec,
+      std::size_t bytes_transferred = 0, int start = 0)
+  {
+    switch (start_ = start)
+    {
+      case 1:
+      {
+        ASIO_HANDLER_LOCATION((__FILE__, __LINE__,
+              "async_connect_and_send"));
+        socket_.async_connect(peer_endpoint_,
+            ASIO_MOVE_CAST(connect_and_send_op)(*this));
+      }
+      return; default:
+      if (!ec && start_ != 2 && !connected_)
+      {
+        if (this->cancelled() != cancellation_type::none)
+        {
+          ec = error::operation_aborted;
+        }
+        else
+        {
+          // When a Fast Open cookie for the peer is cached the connect has
+          // completed without a handshake, and this send carries the data in
+          // the SYN.
+          connected_ = true;
+          ASIO_HANDLER_LOCATION((__FILE__, __LINE__,
+                "async_connect_and_send"));
+          socket_.async_send(buffers_,
+              ASIO_MOVE_CAST(connect_and_send_op)(*this));
+          return;
+        }
+      }
+
+      ASIO_MOVE_OR_LVALUE(WriteHandler)(handler_)(
+          static_cast<const asio::error_code&>(ec),
+          static_cast<const std::size_t&>(bytes_transferred));
+    }
+  }
+
+//private:
+  Socket& socket_;
+  endpoint_type peer_endpoint_;
+  ConstBufferSequence buffers_;
+  int start_;
+  bool connected_;
+  WriteHandler handler_;
+};
+
+template <typename Socket, typename ConstBufferSequence, typename WriteHandler>
+inline asio_handler_allocate_is_deprecated
+asio_handler_allocate(std::size_t size,
+    connect_and_send_op<Socket, ConstBufferSequence,
+      WriteHandler>* this_handler)
+{
+#if defined(ASIO_NO_DEPRECATED)
+  asio_handler_alloc_helpers::allocate(size, this_handler->handler_);
+  return asio_handler_allocate_is_no_longer_used();
+#else // defined(ASIO_NO_DEPRECATED)
+  return asio_handler_alloc_helpers::allocate(
+      size, this_handler->handler_);
+#endif // defined(ASIO_NO_DEPRECATED)
+}
+
+template <typename Socket, typename ConstBufferSequence, typename WriteHandler>
+inline asio_handler_deallocate_is_deprecated
+asio_handler_deallocate(void* pointer, std::size_t size,
+    connect_and_send_op<Socket, ConstBufferSequence,
+      WriteHandler>* this_handler)
+{
+  asio_handler_alloc_helpers::deallocate(
+      pointer, size, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+  return asio_handler_deallocate_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+}
+
+template <typename Socket, typename ConstBufferSequence, typename WriteHandler>
+inline bool asio_handler_is_continuation(
+    connect_and_send_op<Socket, ConstBufferSequence,
+      WriteHandler>* this_handler)
+{
+  return this_handler->start_ == 0 ? true
+    : asio_handler_cont_helpers::is_continuation(
+        this_handler->handler_);
+}
+
+template <typename Function, typename Socket,
+    typename ConstBufferSequence, typename WriteHandler>
+inline asio_handler_invoke_is_deprecated
+asio_handler_invoke(Function& function,
+    connect_and_send_op<Socket, ConstBufferSequence,
+      WriteHandler>* this_handler)
+{
+  asio_handler_invoke_helpers::invoke(
+      function, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+  return asio_handler_invoke_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+}
+
+template <typename Function, typename Socket,
+    typename ConstBufferSequence, typename WriteHandler>
+inline asio_handler_invoke_is_deprecated
+asio_handler_invoke(const Function& function,
+    connect_and_send_op<Socket, ConstBufferSequence,
+      WriteHandler>* this_handler)
+{
+  asio_handler_invoke_helpers::invoke(
+      function, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+  return asio_handler_invoke_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+}
+
+template <typename Socket, typename ConstBufferSequence, typename WriteHandler>
+inline void start_connect_and_send_op(Socket& socket,
+    const typename Socket::endpoint_type& peer_endpoint,
+    const ConstBufferSequence& buffers, const asio::error_code& open_ec,
+    WriteHandler& handler)
+{
+  typedef connect_and_send_op<Socket,
+    ConstBufferSequence, WriteHandler> op_type;
+  op_type op(socket, peer_endpoint, buffers, handler);
+
+  if (open_ec)
+  {
+    ASIO_HANDLER_LOCATION((__FILE__, __LINE__, "async_connect_and_send"));
+    asio::post(socket.get_executor(),
+        detail::bind_handler(ASIO_MOVE_CAST(op_type)(op), open_ec, 0, 2));
+  }
+  else
+  {
+    op(asio::error_code(), 0, 1);
+  }
+}
+
+} // namespace detail
+
+#if !defined(GENERATING_DOCUMENTATION)
+
+template <template <typename, typename> class Associator,
+    typename Socket, typename ConstBufferSequence,
+    typename WriteHandler, typename DefaultCandidate>
+struct associator<Associator,
+    detail::connect_and_send_op<Socket, ConstBufferSequence, WriteHandler>,
+    DefaultCandidate>
+  : Associator<WriteHandler, DefaultCandidate>
+{
+  static typename Associator<WriteHandler, DefaultCandidate>::type
+  get(const detail::connect_and_send_op<Socket,
+        ConstBufferSequence, WriteHandler>& h) ASIO_NOEXCEPT
+  {
+    return Associator<WriteHandler, DefaultCandidate>::get(h.handler_);
+  }
+
+  static ASIO_AUTO_RETURN_TYPE_PREFIX2(
+      typename Associator<WriteHandler, DefaultCandidate>::type)
+  get(const detail::connect_and_send_op<Socket,
+        ConstBufferSequence, WriteHandler>& h,
+      const DefaultCandidate& c) ASIO_NOEXCEPT
+    ASIO_AUTO_RETURN_TYPE_SUFFIX((
+      Associator<WriteHandler, DefaultCandidate>::get(h.handler_, c)))
+  {
+    return Associator<WriteHandler, DefaultCandidate>::get(h.handler_, c);
+  }
+};
+
+#endif // !defined(GENERATING_DOCUMENTATION)
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_CONNECT_AND_SEND_OP_HPP
@@ -0,0 +1,221 @@
+//
+// detail/datagram_message_batch.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_DATAGRAM_MESSAGE_BATCH_HPP
+#define ASIO_DETAIL_DATAGRAM_MESSAGE_BATCH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_MMSG)
+
+#include <cstring>
+#include "asio/buffer.hpp"
+#include "asio/detail/cstdint.hpp"
+#include "asio/detail/socket_ops.hpp"
+#include "asio/detail/socket_types.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Adapts a range of datagram_message objects to the array of message headers
+// used by recvmmsg and sendmmsg. Messages beyond the first max_messages are
+// left for a subsequent operation.
+template <typename MessageIterator>
+class datagram_message_batch
+{
+public:
+  enum { max_messages = 64 };
+
+  datagram_message_batch(MessageIterator begin, MessageIterator end)
+    : begin_(begin),
+      count_(0)
+  {
+    for (MessageIterator iter = begin;
+        iter != end && count_ < max_messages; ++iter)
+      ++count_;
+  }
+
+  // Initialise the message headers to receive into the messages.
+  void prepare_receive()
+  {
+    MessageIterator iter = begin_;
+    for (std::size_t i = 0; i < count_; ++i, ++iter)
+    {
+      asio::mutable_buffer buffer(iter->buffer());
+      socket_ops::init_buf(bufs_[i], buffer.data(), buffer.size());
+      init_header(i, iter->endpoint().data(), iter->endpoint().capacity());
+#if defined(ASIO_HAS_UDP_GSO) || defined(ASIO_HAS_SO_TIMESTAMPING)
+      msgs_[i].msg_hdr.msg_control = control_[i].data;
+      msgs_[i].msg_hdr.msg_controllen = sizeof(control_[i].data);
+#endif // defined(ASIO_HAS_UDP_GSO) || defined(ASIO_HAS_SO_TIMESTAMPING)
+    }
+  }
+
+  // Initialise the message headers to send the messages.
+  void prepare_send()
+  {
+    MessageIterator iter = begin_;
+    for (std::size_t i = 0; i < count_; ++i, ++iter)
+    {
+      asio::const_buffer buffer(iter->buffer());
+      socket_ops::init_buf(bufs_[i], buffer.data(), buffer.size());
+      init_header(i, iter->endpoint().data(), iter->endpoint().size());
+#if defined(ASIO_HAS_UDP_GSO)
+      if (iter->segment_size() != 0)
+      {
+        msgs_[i].msg_hdr.msg_control = control_[i].data;
+        msgs_[i].msg_hdr.msg_controllen = CMSG_SPACE(sizeof(uint16_t));
+        cmsghdr* cmsg = CMSG_FIRSTHDR(&msgs_[i].msg_hdr);
+        cmsg->cmsg_level = ASIO_OS_DEF(IPPROTO_UDP);
+        cmsg->cmsg_type = ASIO_OS_DEF(UDP_SEGMENT);
+        cmsg->cmsg_len = CMSG_LEN(sizeof(uint16_t));
+        uint16_t segment_size = static_cast<uint16_t>(iter->segment_size());
+        std::memcpy(CMSG_DATA(cmsg), &segment_size, sizeof(segment_size));
+      }
+#endif // defined(ASIO_HAS_UDP_GSO)
+    }
+  }
+
+  // Get the message headers.
+  mmsghdr_type* messages()
+  {
+    return msgs_;
+  }
+
+  // Get the number of messages in the batch.
+  std::size_t count() const
+  {
+    return count_;
+  }
+
+  // Record the results of receiving the first n messages of the batch.
+  void complete_receive(std::size_t n)
+  {
+    MessageIterator iter = begin_;
+    for (std::size_t i = 0; i < n; ++i, ++iter)
+    {
+      iter->endpoint().resize(msgs_[i].msg_hdr.msg_namelen);
+      iter->size(msgs_[i].msg_len);
+      iter->segment_size(received_segment_size(msgs_[i].msg_hdr));
+      record_timestamps(msgs_[i].msg_hdr, *iter);
+    }
+  }
+
+  // Record the results of sending the first n messages of the batch.
+  void complete_send(std::size_t n)
+  {
+    MessageIterator iter = begin_;
+    for (std::size_t i = 0; i < n; ++i, ++iter)
+      iter->size(msgs_[i].msg_len);
+  }
+
+private:
+  // Get the segment size reported for a datagram that was coalesced on
+  // receipt, or zero if it was received as is.
+  static std::size_t received_segment_size(msghdr& hdr)
+  {
+#if defined(ASIO_HAS_UDP_GSO)
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr);
+        cmsg; cmsg = CMSG_NXTHDR(&hdr, cmsg))
+    {
+      if (cmsg->cmsg_level == ASIO_OS_DEF(IPPROTO_UDP)
+          && cmsg->cmsg_type == ASIO_OS_DEF(UDP_GRO))
+      {
+        int segment_size = 0;
+        std::memcpy(&segment_size, CMSG_DATA(cmsg), sizeof(segment_size));
+        return segment_size;
+      }
+    }
+#else // defined(ASIO_HAS_UDP_GSO)
+    (void)hdr;
+#endif // defined(ASIO_HAS_UDP_GSO)
+    return 0;
+  }
+
+  // Record the receive timestamps reported for a datagram, if any.
+  template <typename Message>
+  static void record_timestamps(msghdr& hdr, Message& message)
+  {
+    uint64_t software_time = 0;
+    uint64_t hardware_time = 0;
+#if defined(ASIO_HAS_SO_TIMESTAMPING)
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&hdr);
+        cmsg; cmsg = CMSG_NXTHDR(&hdr, cmsg))
+    {
+      if (cmsg->cmsg_level != ASIO_OS_DEF(SOL_SOCKET))
+        continue;
+
+      // The control message types are the same as the option names.
+      if (cmsg->cmsg_type == ASIO_OS_DEF(SO_TIMESTAMPNS))
+      {
+        timespec ts;
+        std::memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+        software_time = socket_ops::timestamp_to_nanoseconds(ts);
+      }
+      else if (cmsg->cmsg_type == ASIO_OS_DEF(SO_TIMESTAMPING))
+      {
+        scm_timestamping stamps;
+        std::memcpy(&stamps, CMSG_DATA(cmsg), sizeof(stamps));
+        if (software_time == 0)
+          software_time = socket_ops::timestamp_to_nanoseconds(stamps.ts[0]);
+        hardware_time = socket_ops::timestamp_to_nanoseconds(stamps.ts[2]);
+      }
+    }
+#else // defined(ASIO_HAS_SO_TIMESTAMPING)
+    (void)hdr;
+#endif // defined(ASIO_HAS_SO_TIMESTAMPING)
+    message.timestamp(software_time);
+    message.hardware_timestamp(hardware_time);
+  }
+
+  void init_header(std::size_t i, const void* addr, std::size_t addrlen)
+  {
+    msgs_[i].msg_hdr = msghdr();
+    msgs_[i].msg_hdr.msg_name = const_cast<void*>(addr);
+    msgs_[i].msg_hdr.msg_namelen = static_cast<socklen_t>(addrlen);
+    msgs_[i].msg_hdr.msg_iov = &bufs_[i];
+    msgs_[i].msg_hdr.msg_iovlen = 1;
+    msgs_[i].msg_len = 0;
+  }
+
+  MessageIterator begin_;
+  std::size_t count_;
+  mmsghdr_type msgs_[max_messages];
+  socket_ops::buf bufs_[max_messages];
+
+#if defined(ASIO_HAS_UDP_GSO) || defined(ASIO_HAS_SO_TIMESTAMPING)
+  // Space for the segment size and timestamps carried by each message.
+  union control_type
+  {
+    cmsghdr header;
+    char data[CMSG_SPACE(sizeof(int))
+#if defined(ASIO_HAS_SO_TIMESTAMPING)
+      + CMSG_SPACE(sizeof(timespec))
+      + CMSG_SPACE(sizeof(scm_timestamping))
+#endif // defined(ASIO_HAS_SO_TIMESTAMPING)
+      ];
+  } control_[max_messages];
+#endif // defined(ASIO_HAS_UDP_GSO) || defined(ASIO_HAS_SO_TIMESTAMPING)
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_MMSG)
+
+#endif // ASIO_DETAIL_DATAGRAM_MESSAGE_BATCH_HPP
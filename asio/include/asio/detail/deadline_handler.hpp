@@ -0,0 +1,306 @@
+//
+// detail/deadline_handler.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_DEADLINE_HANDLER_HPP
+#define ASIO_DETAIL_DEADLINE_HANDLER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_CHRONO)
+
+#include "asio/associated_allocator.hpp"
+#include "asio/associated_cancellation_slot.hpp"
+#include "asio/associator.hpp"
+#include "asio/basic_waitable_timer.hpp"
+#include "asio/cancellation_signal.hpp"
+#include "asio/cancellation_type.hpp"
+#include "asio/error.hpp"
+#include "asio/detail/atomic_count.hpp"
+#include "asio/detail/chrono.hpp"
+#include "asio/detail/handler_cont_helpers.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/mutex.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/detail/type_traits.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// State shared between an operation's completion handler and the internal
+// timer used to enforce the operation's deadline. The operation is cancelled
+// through a cancellation signal owned by the state when the timer expires.
+template <typename Handler, typename IoExecutor>
+class deadline_state
+  : private noncopyable
+{
+public:
+  typedef basic_waitable_timer<chrono::steady_clock,
+      wait_traits<chrono::steady_clock>, IoExecutor> timer_type;
+
+  typedef typename associated_cancellation_slot<Handler>::type slot_type;
+
+  typedef typename associated_allocator<Handler>::type handler_allocator_type;
+
+  typedef ASIO_REBIND_ALLOC(handler_allocator_type,
+      deadline_state) allocator_type;
+
+  // Create a new state object using the handler's associated allocator. The
+  // returned object has a single reference.
+  static deadline_state* create(const Handler& handler,
+      const IoExecutor& io_ex, const chrono::steady_clock::time_point& expiry)
+  {
+    allocator_type alloc((get_associated_allocator)(handler));
+    deadline_state* s = alloc.allocate(1);
+    return new (s) deadline_state(alloc, handler, io_ex, expiry);
+  }
+
+  void add_ref()
+  {
+    ref_count_up(ref_count_);
+  }
+
+  void release()
+  {
+    if (ref_count_down(ref_count_))
+    {
+      allocator_type alloc(allocator_);
+      this->~deadline_state();
+      alloc.deallocate(this, 1);
+    }
+  }
+
+  // Start the timer. Must be called once, before the operation is started.
+  void start()
+  {
+    add_ref();
+    timer_.async_wait(timer_handler(this));
+  }
+
+  // Mark the operation as complete, stop the timer and detach from the
+  // handler's own slot. Must be called before the handler is invoked, as the
+  // handler may install another cancellation handler into the slot. Returns
+  // true if the operation was cancelled because the deadline expired.
+  bool complete()
+  {
+    bool expired;
+    {
+      mutex::scoped_lock lock(mutex_);
+      completed_ = true;
+      expired = expired_;
+    }
+    if (user_slot_.is_connected())
+      user_slot_.clear();
+    if (!expired)
+      timer_.cancel();
+    return expired;
+  }
+
+  cancellation_slot slot()
+  {
+    return signal_.slot();
+  }
+
+private:
+  // Forwards cancellation requests from the handler's own slot, if any.
+  class cancellation_proxy
+  {
+  public:
+    explicit cancellation_proxy(deadline_state* s)
+      : state_(s)
+    {
+    }
+
+    void operator()(cancellation_type_t type)
+    {
+      mutex::scoped_lock lock(state_->mutex_);
+      if (!state_->completed_)
+        state_->signal_.emit(type);
+    }
+
+  private:
+    deadline_state* state_;
+  };
+
+  // Handler used for the internal timer wait.
+  class timer_handler
+  {
+  public:
+    explicit timer_handler(deadline_state* s)
+      : state_(s)
+    {
+    }
+
+    timer_handler(const timer_handler& other)
+      : state_(other.state_)
+    {
+      state_->add_ref();
+    }
+
+    ~timer_handler()
+    {
+      state_->release();
+    }
+
+    void operator()(const asio::error_code& ec)
+    {
+      if (!ec)
+      {
+        mutex::scoped_lock lock(state_->mutex_);
+        if (!state_->completed_)
+        {
+          state_->expired_ = true;
+          state_->signal_.emit(cancellation_type::terminal);
+        }
+      }
+    }
+
+  private:
+    timer_handler& operator=(const timer_handler&);
+
+    deadline_state* state_;
+  };
+
+  deadline_state(const allocator_type& alloc, const Handler& handler,
+      const IoExecutor& io_ex, const chrono::steady_clock::time_point& expiry)
+    : allocator_(alloc),
+      timer_(io_ex, expiry),
+      user_slot_((get_associated_cancellation_slot)(handler)),
+      ref_count_(1),
+      expired_(false),
+      completed_(false)
+  {
+    if (user_slot_.is_connected())
+      user_slot_.template emplace<cancellation_proxy>(this);
+  }
+
+  allocator_type allocator_;
+  timer_type timer_;
+  cancellation_signal signal_;
+  slot_type user_slot_;
+  atomic_count ref_count_;
+  mutex mutex_;
+  bool expired_;
+  bool completed_;
+};
+
+// Completion handler wrapper that maps cancellation due to an expired deadline
+// to the timed_out error. Used to implement per-operation deadlines on
+// backends that have no native support for them.
+template <typename Handler, typename IoExecutor>
+class deadline_handler
+{
+public:
+  typedef deadline_state<Handler, IoExecutor> state_type;
+
+  typedef cancellation_slot cancellation_slot_type;
+
+  deadline_handler(Handler& handler, const IoExecutor& io_ex,
+      const chrono::steady_clock::time_point& expiry)
+    : state_(state_type::create(handler, io_ex, expiry)),
+      handler_(ASIO_MOVE_CAST(Handler)(handler))
+  {
+    state_->start();
+  }
+
+  deadline_handler(const deadline_handler& other)
+    : state_(other.state_),
+      handler_(other.handler_)
+  {
+    if (state_)
+      state_->add_ref();
+  }
+
+#if defined(ASIO_HAS_MOVE)
+  deadline_handler(deadline_handler&& other)
+    : state_(other.state_),
+      handler_(ASIO_MOVE_CAST(Handler)(other.handler_))
+  {
+    other.state_ = 0;
+  }
+#endif // defined(ASIO_HAS_MOVE)
+
+  ~deadline_handler()
+  {
+    if (state_)
+      state_->release();
+  }
+
+  cancellation_slot_type get_cancellation_slot() const ASIO_NOEXCEPT
+  {
+    return state_->slot();
+  }
+
+  void operator()(asio::error_code ec, std::size_t bytes_transferred)
+  {
+    if (state_->complete() && ec == asio::error::operation_aborted)
+      ec = asio::error::timed_out;
+    state_->release();
+    state_ = 0;
+    ASIO_MOVE_OR_LVALUE(Handler)(handler_)(ec, bytes_transferred);
+  }
+
+//private:
+  state_type* state_;
+  Handler handler_;
+
+private:
+  deadline_handler& operator=(const deadline_handler&);
+};
+
+template <typename Handler, typename IoExecutor>
+inline bool asio_handler_is_continuation(
+    deadline_handler<Handler, IoExecutor>* this_handler)
+{
+  return asio_handler_cont_helpers::is_continuation(
+      this_handler->handler_);
+}
+
+} // namespace detail
+
+#if !defined(GENERATING_DOCUMENTATION)
+
+template <template <typename, typename> class Associator,
+    typename Handler, typename IoExecutor, typename DefaultCandidate>
+struct associator<Associator,
+    detail::deadline_handler<Handler, IoExecutor>, DefaultCandidate>
+  : Associator<Handler, DefaultCandidate>
+{
+  static typename Associator<Handler, DefaultCandidate>::type
+  get(const detail::deadline_handler<Handler, IoExecutor>& h) ASIO_NOEXCEPT
+  {
+    return Associator<Handler, DefaultCandidate>::get(h.handler_);
+  }
+
+  static ASIO_AUTO_RETURN_TYPE_PREFIX2(
+      typename Associator<Handler, DefaultCandidate>::type)
+  get(const detail::deadline_handler<Handler, IoExecutor>& h,
+      const DefaultCandidate& c) ASIO_NOEXCEPT
+    ASIO_AUTO_RETURN_TYPE_SUFFIX((
+      Associator<Handler, DefaultCandidate>::get(h.handler_, c)))
+  {
+    return Associator<Handler, DefaultCandidate>::get(h.handler_, c);
+  }
+};
+
+#endif // !defined(GENERATING_DOCUMENTATION)
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_CHRONO)
+
+#endif // ASIO_DETAIL_DEADLINE_HANDLER_HPP
@@ -29,6 +29,7 @@
 #include "asio/detail/socket_types.hpp"
 #include "asio/detail/timer_queue.hpp"
 #include "asio/detail/timer_queue_ptime.hpp"
+#include "asio/detail/timer_queue_wheel.hpp"
 #include "asio/detail/timer_scheduler.hpp"
 #include "asio/detail/wait_handler.hpp"
 #include "asio/detail/wait_op.hpp"
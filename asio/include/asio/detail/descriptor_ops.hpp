@@ -145,6 +145,20 @@ ASIO_DECL bool non_blocking_write_at1(int d,
 
 #endif // defined(ASIO_HAS_FILE)
 
+#if defined(ASIO_HAS_SPLICE)
+
+ASIO_DECL int pipe(int fds[2], asio::error_code& ec);
+
+ASIO_DECL bool is_pipe(int d);
+
+ASIO_DECL bool non_blocking_splice(int in, int out, std::size_t size,
+    asio::error_code& ec, std::size_t& bytes_transferred);
+
+ASIO_DECL bool non_blocking_tee(int in, int out, std::size_t size,
+    asio::error_code& ec, std::size_t& bytes_transferred);
+
+#endif // defined(ASIO_HAS_SPLICE)
+
 ASIO_DECL int ioctl(int d, state_type& state, long cmd,
     ioctl_arg_type* arg, asio::error_code& ec);
 
@@ -70,6 +70,9 @@ public:
     op_queue<reactor_op> op_queue_[max_ops];
     bool try_speculative_[max_ops];
     bool shutdown_;
+#if defined(ASIO_HAS_MSG_ZEROCOPY)
+    uint32_t zero_copy_sequence_;
+#endif // defined(ASIO_HAS_MSG_ZEROCOPY)
 
     ASIO_DECL descriptor_state(bool locking);
     void set_ready_events(uint32_t events) { task_result_ = events; }
@@ -78,6 +81,14 @@ public:
     ASIO_DECL static void do_complete(
         void* owner, operation* base,
         const asio::error_code& ec, std::size_t bytes_transferred);
+
+#if defined(ASIO_HAS_MSG_ZEROCOPY)
+  public:
+    // Allocate the sequence number the kernel will use to report completion
+    // of a zero-copy send. Called only while performing an operation on the
+    // descriptor, when the descriptor's mutex is held.
+    uint32_t allocate_zero_copy_sequence() { return zero_copy_sequence_++; }
+#endif // defined(ASIO_HAS_MSG_ZEROCOPY)
   };
 
   // Per-descriptor data.
@@ -20,6 +20,11 @@
 #include "asio/detail/descriptor_ops.hpp"
 #include "asio/error.hpp"
 
+#if defined(ASIO_HAS_SPLICE)
+# include <fcntl.h>
+# include <sys/stat.h>
+#endif // defined(ASIO_HAS_SPLICE)
+
 #if !defined(ASIO_WINDOWS) \
   && !defined(ASIO_WINDOWS_RUNTIME) \
   && !defined(__CYGWIN__)
@@ -829,6 +834,102 @@ bool non_blocking_write_at1(int d, uint64_t offset,
 
 #endif // defined(ASIO_HAS_FILE)
 
+#if defined(ASIO_HAS_SPLICE)
+
+int pipe(int fds[2], asio::error_code& ec)
+{
+  int result = ::pipe2(fds, O_CLOEXEC | O_NONBLOCK);
+  get_last_error(ec, result != 0);
+  return result;
+}
+
+bool is_pipe(int d)
+{
+  struct stat st;
+  return ::fstat(d, &st) == 0 && S_ISFIFO(st.st_mode);
+}
+
+bool non_blocking_splice(int in, int out, std::size_t size,
+    asio::error_code& ec, std::size_t& bytes_transferred)
+{
+  for (;;)
+  {
+    // Move some data between the descriptors.
+    signed_size_type bytes = ::splice(in, 0, out, 0,
+        size, SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    get_last_error(ec, bytes < 0);
+
+    // Check for EOF.
+    if (bytes == 0 && size > 0)
+    {
+      ec = asio::error::eof;
+      bytes_transferred = 0;
+      return true;
+    }
+
+    // Check if operation succeeded.
+    if (bytes >= 0)
+    {
+      bytes_transferred = bytes;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == asio::error::would_block
+        || ec == asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    bytes_transferred = 0;
+    return true;
+  }
+}
+
+bool non_blocking_tee(int in, int out, std::size_t size,
+    asio::error_code& ec, std::size_t& bytes_transferred)
+{
+  for (;;)
+  {
+    // Duplicate some data between the pipes.
+    signed_size_type bytes = ::tee(in, out, size, SPLICE_F_NONBLOCK);
+    get_last_error(ec, bytes < 0);
+
+    // Check for EOF.
+    if (bytes == 0 && size > 0)
+    {
+      ec = asio::error::eof;
+      bytes_transferred = 0;
+      return true;
+    }
+
+    // Check if operation succeeded.
+    if (bytes >= 0)
+    {
+      bytes_transferred = bytes;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == asio::error::would_block
+        || ec == asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    bytes_transferred = 0;
+    return true;
+  }
+}
+
+#endif // defined(ASIO_HAS_SPLICE)
+
 int ioctl(int d, state_type& state, long cmd,
     ioctl_arg_type* arg, asio::error_code& ec)
 {
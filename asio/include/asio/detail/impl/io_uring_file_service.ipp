@@ -32,7 +32,8 @@ namespace detail {
 io_uring_file_service::io_uring_file_service(
     execution_context& context)
   : execution_context_service_base<io_uring_file_service>(context),
-    descriptor_service_(context)
+    descriptor_service_(context),
+    background_service_(asio::use_service<background_file_service>(context))
 {
 }
 
@@ -20,6 +20,7 @@
 #if defined(ASIO_HAS_IO_URING)
 
 #include <cstddef>
+#include <cstring>
 #include <sys/eventfd.h>
 #include "asio/detail/io_uring_service.hpp"
 #include "asio/detail/reactor_op.hpp"
@@ -37,10 +38,18 @@ io_uring_service::io_uring_service(asio::execution_context& ctx)
     scheduler_(use_service<scheduler>(ctx)),
     mutex_(ASIO_CONCURRENCY_HINT_IS_LOCKING(
           REACTOR_REGISTRATION, scheduler_.concurrency_hint())),
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+    msg_ring_supported_(false),
+    messages_in_flight_(0),
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
     outstanding_work_(0),
     submit_sqes_op_(this),
     pending_sqes_(0),
     pending_submit_sqes_op_(false),
+    direct_sqes_(0),
+    sqe_stage_(ASIO_CONCURRENCY_HINT_IS_LOCKING(
+          REACTOR_REGISTRATION, scheduler_.concurrency_hint())),
+    flush_sqe_stage_op_(this),
     shutdown_(false),
     timeout_(),
     registration_mutex_(mutex_.enabled()),
@@ -67,6 +76,11 @@ void io_uring_service::shutdown()
   shutdown_ = true;
   lock.unlock();
 
+  // Staged entries are discarded, as their operations are cancelled below.
+  mutex::scoped_lock stage_lock(sqe_stage_.mutex_);
+  sqe_stage_.count_ = 0;
+  stage_lock.unlock();
+
   op_queue<operation> ops;
 
   // Cancel all outstanding operations.
@@ -90,12 +104,19 @@ void io_uring_service::shutdown()
     ::io_uring_prep_cancel(sqe, &timeout_, IOSQE_IO_DRAIN);
   submit_sqes();
 
-  // Wait for all completions to come back.
-  for (; outstanding_work_ > 0; --outstanding_work_)
+  // Wait for the completions to come back.
+  for (bool first = true; outstanding_work_ > 0;
+      --outstanding_work_, first = false)
   {
     ::io_uring_cqe* cqe = 0;
-    if (::io_uring_wait_cqe(&ring_, &cqe) != 0)
+    if (!get_drained_cqe(&cqe, first))
       break;
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+    void* ptr = ::io_uring_cqe_get_data(cqe);
+    if (is_message(ptr))
+      complete_message(ptr, cqe->res, ops);
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
+    ::io_uring_cqe_seen(&ring_, cqe);
   }
 
   timer_queues_.get_all_timers(ops);
@@ -142,13 +163,21 @@ void io_uring_service::notify_fork(
       // completed, or were explicitly cancelled. All others will be
       // automatically restarted.
       op_queue<operation> ops;
-      for (; outstanding_work_ > 0; --outstanding_work_)
+      for (bool first = true; outstanding_work_ > 0;
+          --outstanding_work_, first = false)
       {
         ::io_uring_cqe* cqe = 0;
-        if (::io_uring_wait_cqe(&ring_, &cqe) != 0)
+        if (!get_drained_cqe(&cqe, first))
           break;
         if (void* ptr = ::io_uring_cqe_get_data(cqe))
         {
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+          if (is_message(ptr))
+          {
+            complete_message(ptr, cqe->res, ops);
+          }
+          else
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
           if (ptr != this && ptr != &timer_queues_ && ptr != &timeout_)
           {
             io_queue* io_q = static_cast<io_queue*>(ptr);
@@ -156,6 +185,7 @@ void io_uring_service::notify_fork(
             ops.push(io_q);
           }
         }
+        ::io_uring_cqe_seen(&ring_, cqe);
       }
       scheduler_.post_deferred_completions(ops);
 
@@ -201,6 +231,7 @@ void io_uring_service::register_io_object(
   {
     io_obj->queues_[i].io_object_ = io_obj;
     io_obj->queues_[i].cancel_requested_ = false;
+    io_obj->queues_[i].staged_ = false;
   }
 }
 
@@ -218,6 +249,7 @@ void io_uring_service::register_internal_io_object(
   {
     io_obj->queues_[i].io_object_ = io_obj;
     io_obj->queues_[i].cancel_requested_ = false;
+    io_obj->queues_[i].staged_ = false;
   }
 
   io_obj->queues_[op_type].op_queue_.push(op);
@@ -283,12 +315,16 @@ void io_uring_service::start_op(int op_type,
     else
     {
       io_obj->queues_[op_type].op_queue_.push(op);
+      if (!lock_or_stage_sqes(op, &io_obj->queues_[op_type]))
+      {
+        scheduler_.work_started();
+        return;
+      }
+
       io_object_lock.unlock();
-      mutex::scoped_lock lock(mutex_);
-      if (::io_uring_sqe* sqe = get_sqe())
+      mutex::scoped_lock lock(mutex_, mutex::scoped_lock::adopt_lock);
+      if (prepare_sqes(op, &io_obj->queues_[op_type]))
       {
-        op->prepare(sqe);
-        ::io_uring_sqe_set_data(sqe, &io_obj->queues_[op_type]);
         scheduler_.work_started();
         post_submit_sqes_op(lock);
       }
@@ -341,9 +377,14 @@ void io_uring_service::cancel_ops_by_key(
         other_ops.push(op);
         if (!io_obj->queues_[op_type].cancel_requested_)
         {
-          io_obj->queues_[op_type].cancel_requested_ = true;
           mutex::scoped_lock lock(mutex_);
-          if (::io_uring_sqe* sqe = get_sqe())
+          io_obj->queues_[op_type].cancel_requested_ = true;
+          if (io_obj->queues_[op_type].staged_)
+          {
+            // The entry has not reached the ring yet. It will be cancelled
+            // when the stage is flushed.
+          }
+          else if (::io_uring_sqe* sqe = get_sqe())
           {
             ::io_uring_prep_cancel(sqe, &io_obj->queues_[op_type], 0);
             submit_sqes();
@@ -476,6 +517,12 @@ void io_uring_service::run(long usec, op_queue<operation>& ops)
         {
           --local_ops;
         }
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+        else if (is_message(ptr))
+        {
+          complete_message(ptr, cqe->res, ops);
+        }
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
         else
         {
           io_queue* io_q = static_cast<io_queue*>(ptr);
@@ -520,6 +567,113 @@ void io_uring_service::interrupt()
   submit_sqes();
 }
 
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+bool io_uring_service::post_message(io_uring_service& target, operation* op)
+{
+  if (!msg_ring_supported_ || !target.msg_ring_supported_)
+    return false;
+
+  mutex::scoped_lock lock(mutex_);
+  if (shutdown_)
+    return false;
+
+  // The target's thread may be posting back to this ring, so its lock is only
+  // tried. Holding it while the message is counted means the target's shutdown
+  // either refuses the message here or waits for it to complete.
+  if (!target.mutex_.try_lock())
+    return false;
+  mutex::scoped_lock target_lock(target.mutex_, mutex::scoped_lock::adopt_lock);
+  if (target.shutdown_)
+    return false;
+
+  ::io_uring_sqe* sqe = get_sqe();
+  if (!sqe)
+    return false;
+
+  // The message's completion on the target ring is not the result of an entry
+  // submitted there, so the target's work is accounted for here.
+  target.scheduler_.work_started();
+  increment(target.outstanding_work_, 1);
+  increment(target.messages_in_flight_, 1);
+  target_lock.unlock();
+  increment(messages_in_flight_, 1);
+
+  // While the message is in flight the operation is not on any queue, so its
+  // link is used to remember the target in case the message cannot be sent.
+  op_queue_access::next(op, reinterpret_cast<operation*>(&target));
+
+  std::size_t data = reinterpret_cast<std::size_t>(op);
+  ::io_uring_prep_msg_ring(sqe, target.ring_.ring_fd,
+      0, static_cast<__u64>(data | message_delivery), 0);
+  ::io_uring_sqe_set_data(sqe, reinterpret_cast<void*>(data | message_sent));
+  post_submit_sqes_op(lock);
+  return true;
+}
+
+void io_uring_service::complete_message(void* ptr,
+    int result, op_queue<operation>& ops)
+{
+  std::size_t data = reinterpret_cast<std::size_t>(ptr);
+  operation* op = reinterpret_cast<operation*>(
+      data & ~static_cast<std::size_t>(message_tag_mask));
+
+  if ((data & message_tag_mask) == message_delivery)
+  {
+    // The operation was posted to this ring's scheduler by another ring.
+    decrement(messages_in_flight_, 1);
+    ops.push(op);
+  }
+  else
+  {
+    decrement(messages_in_flight_, 1);
+    if (result < 0)
+    {
+      // The message could not be delivered, so fall back to posting the
+      // operation through the target scheduler's queue.
+      io_uring_service* target = reinterpret_cast<io_uring_service*>(
+          op_queue_access::next(op));
+      op_queue_access::next(op, static_cast<operation*>(0));
+      // The target's shutdown waits for its messages in flight, so the
+      // operation is queued before the count is released.
+      target->scheduler_.post_deferred_completion(op);
+      decrement(target->outstanding_work_, 1);
+      decrement(target->messages_in_flight_, 1);
+    }
+  }
+}
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
+
+bool io_uring_service::get_drained_cqe(::io_uring_cqe** cqe, bool first)
+{
+  // The outstanding work may include entries that produce no completion once
+  // cancelled, so only the first wait blocks and the remaining completions are
+  // drained while they are available.
+  if (first)
+    return ::io_uring_wait_cqe(&ring_, cqe) == 0;
+  if (::io_uring_peek_cqe(&ring_, cqe) == 0)
+    return true;
+
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+  // Messages always complete, and their operations would be lost if the drain
+  // stopped early, so keep waiting while any are in flight. A message that
+  // cannot be delivered is settled by the sending ring without a completion on
+  // this one, so the wait is bounded and the count checked again.
+  while (messages_in_flight_ > 0)
+  {
+    __kernel_timespec ts;
+    ts.tv_sec = 0;
+    ts.tv_nsec = 1000000;
+    int result = ::io_uring_wait_cqe_timeout(&ring_, cqe, &ts);
+    if (result == 0)
+      return true;
+    if (result != -ETIME)
+      return false;
+  }
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
+
+  return false;
+}
+
 void io_uring_service::init_ring()
 {
   int result = ::io_uring_queue_init(ring_size, &ring_, 0);
@@ -531,6 +685,15 @@ void io_uring_service::init_ring()
     asio::detail::throw_error(ec, "io_uring_queue_init");
   }
 
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+  if (::io_uring_probe* probe = ::io_uring_get_probe_ring(&ring_))
+  {
+    msg_ring_supported_ =
+      ::io_uring_opcode_supported(probe, IORING_OP_MSG_RING) != 0;
+    ::io_uring_free_probe(probe);
+  }
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
+
 #if !defined(ASIO_HAS_IO_URING_AS_DEFAULT)
   event_fd_ = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
   if (event_fd_ < 0)
@@ -653,7 +816,12 @@ bool io_uring_service::do_cancel_ops(
           && !io_obj->queues_[i].cancel_requested_)
       {
         io_obj->queues_[i].cancel_requested_ = true;
-        if (::io_uring_sqe* sqe = get_sqe())
+        if (io_obj->queues_[i].staged_)
+        {
+          // The entry has not reached the ring yet. It will be cancelled
+          // when the stage is flushed.
+        }
+        else if (::io_uring_sqe* sqe = get_sqe())
           ::io_uring_prep_cancel(sqe, &io_obj->queues_[i], 0);
       }
     }
@@ -722,6 +890,150 @@ void io_uring_service::submit_sqes()
   }
 }
 
+bool io_uring_service::prepare_sqes(io_uring_operation* op, void* data)
+{
+  // A linked pair of entries must be submitted together, so make sure that
+  // the queue will not be flushed between them.
+  if (op->has_expiry() && ::io_uring_sq_space_left(&ring_) < 2)
+  {
+    submit_sqes();
+    if (::io_uring_sq_space_left(&ring_) < 2)
+      return false;
+  }
+
+  ::io_uring_sqe* sqe = get_sqe();
+  if (!sqe)
+    return false;
+
+  prepare_op_sqes(op, data, sqe, op->has_expiry() ? get_sqe() : 0);
+  ++direct_sqes_;
+
+  return true;
+}
+
+void io_uring_service::prepare_op_sqes(io_uring_operation* op,
+    void* data, ::io_uring_sqe* sqe, ::io_uring_sqe* timeout_sqe)
+{
+  op->prepare(sqe);
+  ::io_uring_sqe_set_data(sqe, data);
+
+  if (op->has_expiry())
+  {
+    // The timeout's own completion carries no user data and is ignored. If the
+    // timeout fires first, the operation completes with ECANCELED.
+    sqe->flags |= IOSQE_IO_LINK;
+    ::io_uring_prep_link_timeout(timeout_sqe, &op->expiry_, IORING_TIMEOUT_ABS);
+    ::io_uring_sqe_set_data(timeout_sqe, 0);
+  }
+}
+
+bool io_uring_service::lock_or_stage_sqes(
+    io_uring_operation* op, io_queue* io_q)
+{
+  if (mutex_.try_lock())
+    return true;
+
+  if (stage_sqes(op, io_q))
+    return false;
+
+  // The stage is full, so there is no choice but to wait.
+  mutex_.lock();
+  return true;
+}
+
+bool io_uring_service::stage_sqes(io_uring_operation* op, io_queue* io_q)
+{
+  mutex::scoped_lock stage_lock(sqe_stage_.mutex_);
+  ++sqe_stage_.lock_contentions_;
+
+  int count = op->has_expiry() ? 2 : 1;
+  if (sqe_stage_.count_ + count > io_uring_sqe_stage::max_sqes)
+    return false;
+
+  ::io_uring_sqe* sqe = &sqe_stage_.sqes_[sqe_stage_.count_];
+  std::memset(sqe, 0, count * sizeof(::io_uring_sqe));
+  prepare_op_sqes(op, io_q, sqe, op->has_expiry() ? sqe + 1 : 0);
+  sqe_stage_.count_ += count;
+  sqe_stage_.staged_sqes_ += count;
+  io_q->staged_ = true;
+
+  // The entries are submitted by whichever thread next runs the scheduler, so
+  // they are not held back if this thread goes on to block.
+  if (!sqe_stage_.flush_pending_)
+  {
+    sqe_stage_.flush_pending_ = true;
+    stage_lock.unlock();
+    scheduler_.post_immediate_completion(&flush_sqe_stage_op_, false);
+  }
+
+  return true;
+}
+
+void io_uring_service::flush_sqe_stage()
+{
+  op_queue<operation> ops;
+  mutex::scoped_lock lock(mutex_);
+  mutex::scoped_lock stage_lock(sqe_stage_.mutex_);
+
+  for (int i = 0; i < sqe_stage_.count_;)
+  {
+    ::io_uring_sqe* staged = &sqe_stage_.sqes_[i];
+    int count = (staged->flags & IOSQE_IO_LINK) ? 2 : 1;
+    io_queue* io_q = reinterpret_cast<io_queue*>(
+        static_cast<std::size_t>(staged->user_data));
+    io_q->staged_ = false;
+
+    if (io_q->cancel_requested_)
+    {
+      // The operation was cancelled before its entry reached the ring.
+      io_q->set_result(-ECANCELED);
+      ops.push(io_q);
+    }
+    else
+    {
+      if (::io_uring_sq_space_left(&ring_) < static_cast<unsigned>(count))
+        submit_sqes();
+
+      if (::io_uring_sq_space_left(&ring_) >= static_cast<unsigned>(count))
+      {
+        for (int j = 0; j < count; ++j)
+          *get_sqe() = staged[j];
+      }
+      else
+      {
+        io_q->set_result(-ENOBUFS);
+        ops.push(io_q);
+      }
+    }
+
+    i += count;
+  }
+
+  if (sqe_stage_.count_ > 0)
+    ++sqe_stage_.flushes_;
+  sqe_stage_.count_ = 0;
+  sqe_stage_.flush_pending_ = false;
+  stage_lock.unlock();
+
+  submit_sqes();
+  lock.unlock();
+
+  scheduler_.post_deferred_completions(ops);
+}
+
+io_uring_service::submission_statistics
+io_uring_service::get_submission_statistics()
+{
+  mutex::scoped_lock lock(mutex_);
+  mutex::scoped_lock stage_lock(sqe_stage_.mutex_);
+  submission_statistics statistics;
+  statistics.direct_sqes = direct_sqes_;
+  statistics.lock_contentions = sqe_stage_.lock_contentions_;
+  statistics.staged_sqes = sqe_stage_.staged_sqes_;
+  statistics.staged_flushes = sqe_stage_.flushes_;
+  return statistics;
+}
+
 void io_uring_service::post_submit_sqes_op(mutex::scoped_lock& lock)
 {
   if (pending_sqes_ >= submit_batch_size)
@@ -767,6 +1079,23 @@ void io_uring_service::submit_sqes_op::do_complete(void* owner, operation* base,
   }
 }
 
+io_uring_service::flush_sqe_stage_op::flush_sqe_stage_op(io_uring_service* s)
+  : operation(&io_uring_service::flush_sqe_stage_op::do_complete),
+    service_(s)
+{
+}
+
+void io_uring_service::flush_sqe_stage_op::do_complete(void* owner,
+    operation* base, const asio::error_code& /*ec*/,
+    std::size_t /*bytes_transferred*/)
+{
+  if (owner)
+  {
+    flush_sqe_stage_op* o = static_cast<flush_sqe_stage_op*>(base);
+    o->service_->flush_sqe_stage();
+  }
+}
+
 io_uring_service::io_queue::io_queue()
   : operation(&io_uring_service::io_queue::do_complete)
 {
@@ -817,7 +1146,22 @@ operation* io_uring_service::io_queue::perform_io(int result)
   perform_io_cleanup_on_block_exit io_cleanup(io_object_->service_);
   mutex::scoped_lock io_object_lock(io_object_->mutex_);
 
-  if (result != -ECANCELED || cancel_requested_)
+  if (result == -ECANCELED && !cancel_requested_)
+  {
+    // The kernel cancelled the operation without a request from us. Unless
+    // this is due to the operation's linked timeout, it will be restarted.
+    if (io_uring_operation* op = op_queue_.front())
+    {
+      if (op->has_expired())
+      {
+        op->ec_ = asio::error::timed_out;
+        op->bytes_transferred_ = 0;
+        op_queue_.pop();
+        io_cleanup.ops_.push(op);
+      }
+    }
+  }
+  else
   {
     if (io_uring_operation* op = op_queue_.front())
     {
@@ -847,14 +1191,13 @@ operation* io_uring_service::io_queue::perform_io(int result)
 
   cancel_requested_ = false;
 
-  if (!op_queue_.empty())
+  io_uring_service* service = io_object_->service_;
+  if (!op_queue_.empty()
+      && service->lock_or_stage_sqes(op_queue_.front(), this))
   {
-    io_uring_service* service = io_object_->service_;
-    mutex::scoped_lock lock(service->mutex_);
-    if (::io_uring_sqe* sqe = service->get_sqe())
+    mutex::scoped_lock lock(service->mutex_, mutex::scoped_lock::adopt_lock);
+    if (service->prepare_sqes(op_queue_.front(), this))
     {
-      op_queue_.front()->prepare(sqe);
-      ::io_uring_sqe_set_data(sqe, this);
       service->post_submit_sqes_op(lock);
     }
     else
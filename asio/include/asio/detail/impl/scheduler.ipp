@@ -24,11 +24,13 @@
 #include "asio/detail/scheduler_thread_info.hpp"
 #include "asio/detail/signal_blocker.hpp"
 
-#if defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+#if defined(ASIO_HAS_IO_URING)
 # include "asio/detail/io_uring_service.hpp"
-#else // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+#endif // defined(ASIO_HAS_IO_URING)
+
+#if !defined(ASIO_HAS_IO_URING_AS_DEFAULT)
 # include "asio/detail/reactor.hpp"
-#endif // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+#endif // !defined(ASIO_HAS_IO_URING_AS_DEFAULT)
 
 #include "asio/detail/push_options.hpp"
 
@@ -120,6 +122,9 @@ scheduler::scheduler(asio::execution_context& ctx,
           SCHEDULER, concurrency_hint)),
     task_(0),
     get_task_(get_task),
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+    message_service_(0),
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
     task_interrupted_(true),
     outstanding_work_(0),
     stopped_(false),
@@ -177,6 +182,9 @@ void scheduler::shutdown()
 
   // Reset to initial state.
   task_ = 0;
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+  message_service_.store(0, std::memory_order_release);
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
 }
 
 void scheduler::init_task()
@@ -185,6 +193,13 @@ void scheduler::init_task()
   if (!shutdown_ && !task_)
   {
     task_ = get_task_(this->context());
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+    if (get_task_ == &scheduler::get_default_task)
+    {
+      message_service_.store(static_cast<io_uring_service*>(task_),
+          std::memory_order_release);
+    }
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
     op_queue_.push(&task_operation_);
     wake_one_thread_and_unlock(lock);
   }
@@ -359,6 +374,11 @@ void scheduler::post_immediate_completion(
   (void)is_continuation;
 #endif // defined(ASIO_HAS_THREADS)
 
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+  if (post_message(op))
+    return;
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
+
   work_started();
   mutex::scoped_lock lock(mutex_);
   op_queue_.push(op);
@@ -658,6 +678,26 @@ void scheduler::wake_one_thread_and_unlock(
   }
 }
 
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+bool scheduler::post_message(scheduler::operation* op)
+{
+  // Schedulers are the only thread contexts in this configuration, so the top
+  // of the call stack identifies the scheduler running on the current thread.
+  thread_context* top = thread_call_stack::top_key();
+  if (!top || top == this)
+    return false;
+
+  io_uring_service* source = static_cast<scheduler*>(top)
+    ->message_service_.load(std::memory_order_acquire);
+  io_uring_service* target =
+    message_service_.load(std::memory_order_acquire);
+  if (!source || !target)
+    return false;
+
+  return source->post_message(*target, op);
+}
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
+
 scheduler_task* scheduler::get_default_task(asio::execution_context& ctx)
 {
 #if defined(ASIO_HAS_IO_URING_AS_DEFAULT)
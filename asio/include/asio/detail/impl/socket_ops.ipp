@@ -27,6 +27,18 @@
 #include "asio/detail/socket_ops.hpp"
 #include "asio/error.hpp"
 
+#if defined(ASIO_HAS_SENDFILE)
+# include <sys/sendfile.h>
+#endif // defined(ASIO_HAS_SENDFILE)
+
+#if defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+# include <sys/mman.h>
+#endif // defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+
+#if defined(ASIO_HAS_REUSEPORT_CBPF)
+# include <linux/filter.h>
+#endif // defined(ASIO_HAS_REUSEPORT_CBPF)
+
 #if defined(ASIO_WINDOWS_RUNTIME)
 # include <codecvt>
 # include <locale>
@@ -1805,6 +1817,500 @@ bool non_blocking_sendto1(socket_type s,
 
 #endif // !defined(ASIO_HAS_IOCP)
 
+#if defined(ASIO_HAS_MMSG)
+
+signed_size_type recvmmsg(socket_type s, mmsghdr_type* msgs,
+    size_t count, int flags, asio::error_code& ec)
+{
+  int result = ::recvmmsg(s, msgs, static_cast<unsigned int>(count), flags, 0);
+  get_last_error(ec, result < 0);
+  return result;
+}
+
+size_t sync_recvmmsg(socket_type s, state_type state,
+    mmsghdr_type* msgs, size_t count, int flags, asio::error_code& ec)
+{
+  if (s == invalid_socket)
+  {
+    ec = asio::error::bad_descriptor;
+    return 0;
+  }
+
+  // A blocking call waits for the first datagram only, and then returns with
+  // whatever other datagrams are already queued.
+  flags |= MSG_WAITFORONE;
+
+  // Read some messages.
+  for (;;)
+  {
+    // Try to complete the operation without blocking.
+    signed_size_type messages = socket_ops::recvmmsg(
+        s, msgs, count, flags, ec);
+
+    // Check if operation succeeded.
+    if (messages >= 0)
+      return messages;
+
+    // Operation failed.
+    if ((state & user_set_non_blocking)
+        || (ec != asio::error::would_block
+          && ec != asio::error::try_again))
+      return 0;
+
+    // Wait for socket to become ready.
+    if (socket_ops::poll_read(s, 0, -1, ec) < 0)
+      return 0;
+  }
+}
+
+bool non_blocking_recvmmsg(socket_type s, mmsghdr_type* msgs,
+    size_t count, int flags, asio::error_code& ec,
+    size_t& messages_transferred)
+{
+  // The socket may not be in non-blocking mode when the operation is
+  // attempted speculatively, and a blocking recvmmsg waits for every message.
+  flags |= MSG_DONTWAIT;
+
+  for (;;)
+  {
+    // Read some messages.
+    signed_size_type messages = socket_ops::recvmmsg(
+        s, msgs, count, flags, ec);
+
+    // Check if operation succeeded.
+    if (messages >= 0)
+    {
+      messages_transferred = messages;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == asio::error::would_block
+        || ec == asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    messages_transferred = 0;
+    return true;
+  }
+}
+
+signed_size_type sendmmsg(socket_type s, mmsghdr_type* msgs,
+    size_t count, int flags, asio::error_code& ec)
+{
+#if defined(ASIO_HAS_MSG_NOSIGNAL)
+  flags |= MSG_NOSIGNAL;
+#endif // defined(ASIO_HAS_MSG_NOSIGNAL)
+  int result = ::sendmmsg(s, msgs, static_cast<unsigned int>(count), flags);
+  get_last_error(ec, result < 0);
+  return result;
+}
+
+size_t sync_sendmmsg(socket_type s, state_type state,
+    mmsghdr_type* msgs, size_t count, int flags, asio::error_code& ec)
+{
+  if (s == invalid_socket)
+  {
+    ec = asio::error::bad_descriptor;
+    return 0;
+  }
+
+  // Write some messages.
+  for (;;)
+  {
+    // Try to complete the operation without blocking.
+    signed_size_type messages = socket_ops::sendmmsg(
+        s, msgs, count, flags, ec);
+
+    // Check if operation succeeded.
+    if (messages >= 0)
+      return messages;
+
+    // Operation failed.
+    if ((state & user_set_non_blocking)
+        || (ec != asio::error::would_block
+          && ec != asio::error::try_again))
+      return 0;
+
+    // Wait for socket to become ready.
+    if (socket_ops::poll_write(s, 0, -1, ec) < 0)
+      return 0;
+  }
+}
+
+bool non_blocking_sendmmsg(socket_type s, mmsghdr_type* msgs,
+    size_t count, int flags, asio::error_code& ec,
+    size_t& messages_transferred)
+{
+  // The socket may not be in non-blocking mode when the operation is
+  // attempted speculatively.
+  flags |= MSG_DONTWAIT;
+
+  for (;;)
+  {
+    // Write some messages.
+    signed_size_type messages = socket_ops::sendmmsg(
+        s, msgs, count, flags, ec);
+
+    // Check if operation succeeded.
+    if (messages >= 0)
+    {
+      messages_transferred = messages;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == asio::error::would_block
+        || ec == asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    messages_transferred = 0;
+    return true;
+  }
+}
+
+#endif // defined(ASIO_HAS_MMSG)
+
+#if defined(ASIO_HAS_MSG_ZEROCOPY)
+
+int recv_zero_copy_notification(socket_type s,
+    uint32_t& first, uint32_t& last, asio::error_code& ec)
+{
+  union
+  {
+    cmsghdr header;
+    char data[CMSG_SPACE(sizeof(sock_extended_err))];
+  } control;
+
+  for (;;)
+  {
+    // Read the next entry from the socket's error queue. This never blocks.
+    msghdr msg = msghdr();
+    msg.msg_control = control.data;
+    msg.msg_controllen = sizeof(control.data);
+    signed_size_type result = ::recvmsg(s, &msg, MSG_ERRQUEUE | MSG_DONTWAIT);
+    get_last_error(ec, result < 0);
+    if (result < 0)
+      return socket_error_retval;
+
+    // Entries that are not zero-copy notifications are discarded.
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    {
+      if ((cmsg->cmsg_level == ASIO_OS_DEF(IPPROTO_IP)
+            && cmsg->cmsg_type == IP_RECVERR)
+          || (cmsg->cmsg_level == ASIO_OS_DEF(IPPROTO_IPV6)
+            && cmsg->cmsg_type == IPV6_RECVERR))
+      {
+        sock_extended_err err;
+        std::memcpy(&err, CMSG_DATA(cmsg), sizeof(err));
+        if (err.ee_errno == 0 && err.ee_origin == SO_EE_ORIGIN_ZEROCOPY)
+        {
+          first = err.ee_info;
+          last = err.ee_data;
+          return 0;
+        }
+      }
+    }
+  }
+}
+
+bool non_blocking_recv_zero_copy_notification(socket_type s,
+    uint32_t sequence, asio::error_code& ec)
+{
+  for (;;)
+  {
+    // Read the next notification. Each one covers an inclusive range of the
+    // sequence numbers that were allocated to sends, one per call.
+    uint32_t first = 0;
+    uint32_t last = 0;
+    if (socket_ops::recv_zero_copy_notification(s, first, last, ec) == 0)
+    {
+      // Sequence numbers wrap around, as may the range.
+      if (sequence - first <= last - first)
+        return true;
+      continue;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == asio::error::would_block
+        || ec == asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    return true;
+  }
+}
+
+#endif // defined(ASIO_HAS_MSG_ZEROCOPY)
+
+#if defined(ASIO_HAS_SO_TIMESTAMPING)
+
+uint64_t timestamp_to_nanoseconds(const timespec& ts)
+{
+  return static_cast<uint64_t>(ts.tv_sec) * 1000000000
+    + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+int recv_send_timestamp(socket_type s, uint32_t& id,
+    uint64_t& timestamp, asio::error_code& ec)
+{
+  union
+  {
+    cmsghdr header;
+    char data[CMSG_SPACE(sizeof(scm_timestamping))
+      + CMSG_SPACE(sizeof(sock_extended_err) + sizeof(sockaddr_in6))];
+  } control;
+
+  for (;;)
+  {
+    // Read the next entry from the socket's error queue. This never blocks.
+    // Any copy of the data that was sent is truncated.
+    msghdr msg = msghdr();
+    msg.msg_control = control.data;
+    msg.msg_controllen = sizeof(control.data);
+    signed_size_type result = ::recvmsg(s, &msg, MSG_ERRQUEUE | MSG_DONTWAIT);
+    get_last_error(ec, result < 0);
+    if (result < 0)
+      return socket_error_retval;
+
+    // The timestamps precede the error that identifies them. Entries that are
+    // not timestamps are discarded.
+    uint64_t software_time = 0;
+    uint64_t hardware_time = 0;
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg; cmsg = CMSG_NXTHDR(&msg, cmsg))
+    {
+      if (cmsg->cmsg_level == ASIO_OS_DEF(SOL_SOCKET)
+          && cmsg->cmsg_type == ASIO_OS_DEF(SO_TIMESTAMPING))
+      {
+        scm_timestamping stamps;
+        std::memcpy(&stamps, CMSG_DATA(cmsg), sizeof(stamps));
+        software_time = timestamp_to_nanoseconds(stamps.ts[0]);
+        hardware_time = timestamp_to_nanoseconds(stamps.ts[2]);
+      }
+      else if ((cmsg->cmsg_level == ASIO_OS_DEF(IPPROTO_IP)
+            && cmsg->cmsg_type == IP_RECVERR)
+          || (cmsg->cmsg_level == ASIO_OS_DEF(IPPROTO_IPV6)
+            && cmsg->cmsg_type == IPV6_RECVERR))
+      {
+        sock_extended_err err;
+        std::memcpy(&err, CMSG_DATA(cmsg), sizeof(err));
+        if (err.ee_errno == ENOMSG
+            && err.ee_origin == SO_EE_ORIGIN_TIMESTAMPING)
+        {
+          id = err.ee_data;
+          timestamp = software_time ? software_time : hardware_time;
+          return 0;
+        }
+      }
+    }
+  }
+}
+
+#endif // defined(ASIO_HAS_SO_TIMESTAMPING)
+
+#if defined(ASIO_HAS_SENDFILE)
+
+signed_size_type sendfile(socket_type s, int fd,
+    uint64_t offset, size_t size, asio::error_code& ec)
+{
+  off_t off = static_cast<off_t>(offset);
+  signed_size_type result = ::sendfile(s, fd, &off, size);
+  get_last_error(ec, result < 0);
+  return result;
+}
+
+bool non_blocking_sendfile(socket_type s, int fd,
+    uint64_t offset, size_t size, asio::error_code& ec,
+    size_t& bytes_transferred)
+{
+  for (;;)
+  {
+    // Write some data from the file.
+    signed_size_type bytes = socket_ops::sendfile(s, fd, offset, size, ec);
+
+    // Check for end of file.
+    if (bytes == 0 && size > 0)
+    {
+      ec = asio::error::eof;
+      bytes_transferred = 0;
+      return true;
+    }
+
+    // Check if operation succeeded.
+    if (bytes >= 0)
+    {
+      bytes_transferred = bytes;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == asio::error::would_block
+        || ec == asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    bytes_transferred = 0;
+    return true;
+  }
+}
+
+#endif // defined(ASIO_HAS_SENDFILE)
+
+#if defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+
+void* map_receive_queue(socket_type s,
+    size_t size, asio::error_code& ec)
+{
+  void* addr = ::mmap(0, size, PROT_READ, MAP_SHARED, s, 0);
+  get_last_error(ec, addr == MAP_FAILED);
+  return addr == MAP_FAILED ? 0 : addr;
+}
+
+void unmap_receive_queue(void* addr, size_t size)
+{
+  if (addr)
+    ::munmap(addr, size);
+}
+
+bool non_blocking_recv_zero_copy(socket_type s,
+    void* map_addr, size_t map_size, void* copy_addr, size_t copy_size,
+    const void*& data, asio::error_code& ec, size_t& bytes_transferred)
+{
+  // The leading members of the kernel's tcp_zerocopy_receive structure, which
+  // are all that the earliest supporting kernels accept.
+  struct zerocopy_receive_type
+  {
+    uint64_t address;
+    uint32_t length;
+    uint32_t recv_skip_hint;
+  };
+
+  for (;;)
+  {
+    size_t copy_hint = copy_size;
+    if (map_addr)
+    {
+      // Map whole pages of the receive queue. The kernel first unmaps the
+      // pages left from any previous call.
+      zerocopy_receive_type zc = zerocopy_receive_type();
+      zc.address = reinterpret_cast<uintptr_t>(map_addr);
+      zc.length = static_cast<uint32_t>(map_size);
+      socklen_t len = sizeof(zc);
+      int result = ::getsockopt(s, ASIO_OS_DEF(IPPROTO_TCP),
+          ASIO_OS_DEF(TCP_ZEROCOPY_RECEIVE), &zc, &len);
+      get_last_error(ec, result != 0);
+
+      if (result == 0 && zc.length > 0)
+      {
+        data = map_addr;
+        bytes_transferred = zc.length;
+        return true;
+      }
+
+      // Data that cannot be mapped, such as a tail that does not fill a
+      // page, must be copied.
+      if (result == 0 && zc.recv_skip_hint > 0)
+        copy_hint = zc.recv_skip_hint < copy_size
+          ? zc.recv_skip_hint : copy_size;
+      else if (ec == asio::error::interrupted)
+        continue;
+    }
+
+    signed_size_type bytes = ::recv(s,
+        static_cast<char*>(copy_addr), copy_hint, MSG_DONTWAIT);
+    get_last_error(ec, bytes < 0);
+
+    // Check for EOF.
+    if (bytes == 0 && copy_hint > 0)
+    {
+      ec = asio::error::eof;
+      bytes_transferred = 0;
+      return true;
+    }
+
+    // Check if operation succeeded.
+    if (bytes >= 0)
+    {
+      data = copy_addr;
+      bytes_transferred = bytes;
+      return true;
+    }
+
+    // Retry operation if interrupted by signal.
+    if (ec == asio::error::interrupted)
+      continue;
+
+    // Check if we need to run the operation again.
+    if (ec == asio::error::would_block
+        || ec == asio::error::try_again)
+      return false;
+
+    // Operation failed.
+    bytes_transferred = 0;
+    return true;
+  }
+}
+
+#endif // defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+
+#if defined(ASIO_HAS_REUSEPORT_CBPF)
+
+int attach_reuse_port_cpu_filter(socket_type s,
+    size_t group_size, asio::error_code& ec)
+{
+  if (s == invalid_socket)
+  {
+    ec = asio::error::bad_descriptor;
+    return socket_error_retval;
+  }
+
+  if (group_size == 0)
+  {
+    ec = asio::error::invalid_argument;
+    return socket_error_retval;
+  }
+
+  // Select the socket at the index given by the receiving CPU, modulo the
+  // number of sockets in the group.
+  ::sock_filter code[] =
+  {
+    { BPF_LD | BPF_W | BPF_ABS, 0, 0,
+      static_cast<uint32_t>(SKF_AD_OFF + SKF_AD_CPU) },
+    { BPF_ALU | BPF_MOD | BPF_K, 0, 0, static_cast<uint32_t>(group_size) },
+    { BPF_RET | BPF_A, 0, 0, 0 }
+  };
+
+  ::sock_fprog program;
+  program.len = sizeof(code) / sizeof(code[0]);
+  program.filter = code;
+
+  int result = ::setsockopt(s, ASIO_OS_DEF(SOL_SOCKET),
+      ASIO_OS_DEF(SO_ATTACH_REUSEPORT_CBPF), &program, sizeof(program));
+  get_last_error(ec, result != 0);
+  return result;
+}
+
+#endif // defined(ASIO_HAS_REUSEPORT_CBPF)
+
 socket_type socket(int af, int type, int protocol,
     asio::error_code& ec)
 {
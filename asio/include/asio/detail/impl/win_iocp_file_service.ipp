@@ -33,6 +33,7 @@ win_iocp_file_service::win_iocp_file_service(
     execution_context& context)
   : execution_context_service_base<win_iocp_file_service>(context),
     handle_service_(context),
+    background_service_(asio::use_service<background_file_service>(context)),
     nt_flush_buffers_file_ex_(0)
 {
   if (FARPROC nt_flush_buffers_file_ex_ptr = ::GetProcAddress(
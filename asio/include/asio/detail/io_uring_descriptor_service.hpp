@@ -25,8 +25,10 @@
 #include "asio/execution_context.hpp"
 #include "asio/detail/buffer_sequence_adapter.hpp"
 #include "asio/detail/descriptor_ops.hpp"
+#include "asio/detail/io_uring_descriptor_fsync_op.hpp"
 #include "asio/detail/io_uring_descriptor_read_at_op.hpp"
 #include "asio/detail/io_uring_descriptor_read_op.hpp"
+#include "asio/detail/io_uring_descriptor_statx_op.hpp"
 #include "asio/detail/io_uring_descriptor_write_at_op.hpp"
 #include "asio/detail/io_uring_descriptor_write_op.hpp"
 #include "asio/detail/io_uring_null_buffers_op.hpp"
@@ -632,6 +634,74 @@ public:
     return async_read_some(impl, buffers, handler, io_ex);
   }
 
+  // Asynchronously flush the descriptor's data, and optionally its metadata,
+  // to the underlying storage device.
+  template <typename Handler, typename IoExecutor>
+  void async_sync(implementation_type& impl, bool data_only,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    typename associated_cancellation_slot<Handler>::type slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_descriptor_fsync_op<Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.descriptor_,
+        data_only, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::write_op);
+    }
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p, "descriptor",
+          &impl, impl.descriptor_, data_only ? "async_sync_data"
+          : "async_sync_all"));
+
+    start_op(impl, io_uring_service::write_op, p.p, is_continuation, false);
+    p.v = p.p = 0;
+  }
+
+  // Asynchronously determine the size of the object referred to by the
+  // descriptor.
+  template <typename Handler, typename IoExecutor>
+  void async_size(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    typename associated_cancellation_slot<Handler>::type slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_descriptor_statx_op<Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.descriptor_, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::except_op);
+    }
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "descriptor", &impl, impl.descriptor_, "async_size"));
+
+    start_op(impl, io_uring_service::except_op, p.p, is_continuation, false);
+    p.v = p.p = 0;
+  }
+
 private:
   // Start the asynchronous operation.
   ASIO_DECL void start_op(implementation_type& impl, int op_type,
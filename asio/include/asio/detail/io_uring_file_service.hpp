@@ -21,6 +21,7 @@
   && defined(ASIO_HAS_IO_URING)
 
 #include <string>
+#include "asio/detail/background_file_service.hpp"
 #include "asio/detail/cstdint.hpp"
 #include "asio/detail/descriptor_ops.hpp"
 #include "asio/detail/io_uring_descriptor_service.hpp"
@@ -51,6 +52,7 @@ public:
     friend class io_uring_file_service;
 
     bool is_stream_;
+    background_file_pending_open* pending_open_;
   };
 
   ASIO_DECL io_uring_file_service(execution_context& context);
@@ -63,6 +65,7 @@ public:
   {
     descriptor_service_.construct(impl);
     impl.is_stream_ = false;
+    impl.pending_open_ = 0;
   }
 
   // Move-construct a new file implementation.
@@ -71,6 +74,9 @@ public:
   {
     descriptor_service_.move_construct(impl, other_impl);
     impl.is_stream_ = other_impl.is_stream_;
+    impl.pending_open_ = 0;
+    background_file_pending_open::move(&impl,
+        impl.pending_open_, other_impl.pending_open_);
   }
 
   // Move-assign from another file implementation.
@@ -81,11 +87,14 @@ public:
     descriptor_service_.move_assign(impl,
         other_service.descriptor_service_, other_impl);
     impl.is_stream_ = other_impl.is_stream_;
+    background_file_pending_open::move(&impl,
+        impl.pending_open_, other_impl.pending_open_);
   }
 
   // Destroy a file implementation.
   void destroy(implementation_type& impl)
   {
+    background_file_pending_open::abandon(impl.pending_open_);
     descriptor_service_.destroy(impl);
   }
 
@@ -94,6 +103,18 @@ public:
       const char* path, file_base::flags open_flags,
       asio::error_code& ec);
 
+  // Start an asynchronous open. The open is performed on a background thread.
+  template <typename Handler, typename IoExecutor>
+  void async_open(implementation_type& impl, const std::string& path,
+      file_base::flags open_flags, Handler& handler, const IoExecutor& io_ex)
+  {
+    background_file_open<io_uring_file_service> function(
+        *this, path, open_flags, impl.is_stream_);
+    function.pending().link(&impl, impl.pending_open_);
+    background_service_.async_perform(
+        function, handler, io_ex, &impl, "async_open");
+  }
+
   // Assign a native descriptor to a file implementation.
   asio::error_code assign(implementation_type& impl,
       const native_handle_type& native_descriptor,
@@ -118,9 +139,23 @@ public:
   asio::error_code close(implementation_type& impl,
       asio::error_code& ec)
   {
+    background_file_pending_open::abandon(impl.pending_open_);
     return descriptor_service_.close(impl, ec);
   }
 
+  // Start an asynchronous close. The file is moved out of the implementation
+  // immediately, and closed on a background thread.
+  template <typename Handler, typename IoExecutor>
+  void async_close(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    background_file_close<io_uring_file_service> function(*this);
+    background_file_pending_open::abandon(impl.pending_open_);
+    move_assign(function.impl(), *this, impl);
+    background_service_.async_perform(
+        function, handler, io_ex, &impl, "async_close");
+  }
+
   // Get the native file representation.
   native_handle_type native_handle(const implementation_type& impl) const
   {
@@ -138,6 +173,15 @@ public:
   asio::error_code cancel(implementation_type& impl,
       asio::error_code& ec)
   {
+    if (impl.pending_open_ && !descriptor_service_.is_open(impl))
+    {
+      // Only the open is outstanding, and abandoning it cancels it.
+      background_file_pending_open::abandon(impl.pending_open_);
+      ec = asio::error_code();
+      return ec;
+    }
+
+    background_file_pending_open::abandon(impl.pending_open_);
     return descriptor_service_.cancel(impl, ec);
   }
 
@@ -145,18 +189,54 @@ public:
   ASIO_DECL uint64_t size(const implementation_type& impl,
       asio::error_code& ec) const;
 
+  // Start an asynchronous operation to get the size of the file.
+  template <typename Handler, typename IoExecutor>
+  void async_size(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    descriptor_service_.async_size(impl, handler, io_ex);
+  }
+
   // Alter the size of the file.
   ASIO_DECL asio::error_code resize(implementation_type& impl,
       uint64_t n, asio::error_code& ec);
 
+  // Start an asynchronous operation to alter the size of the file. The resize
+  // is performed on a background thread, as there is no ring operation that
+  // both extends and truncates a file.
+  template <typename Handler, typename IoExecutor>
+  void async_resize(implementation_type& impl, uint64_t n,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    background_service_.async_perform(
+        background_file_resize<io_uring_file_service>(*this, impl, n),
+        handler, io_ex, &impl, "async_resize");
+  }
+
   // Synchronise the file to disk.
   ASIO_DECL asio::error_code sync_all(implementation_type& impl,
       asio::error_code& ec);
 
+  // Start an asynchronous operation to synchronise the file to disk.
+  template <typename Handler, typename IoExecutor>
+  void async_sync_all(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    descriptor_service_.async_sync(impl, false, handler, io_ex);
+  }
+
   // Synchronise the file data to disk.
   ASIO_DECL asio::error_code sync_data(implementation_type& impl,
       asio::error_code& ec);
 
+  // Start an asynchronous operation to synchronise the file data to disk.
+  template <typename Handler, typename IoExecutor>
+  void async_sync_data(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    descriptor_service_.async_sync(impl, true, handler, io_ex);
+  }
+
   // Seek to a position in the file.
   ASIO_DECL uint64_t seek(implementation_type& impl, int64_t offset,
       file_base::seek_basis whence, asio::error_code& ec);
@@ -242,6 +322,9 @@ private:
   // The implementation used for initiating asynchronous operations.
   descriptor_service descriptor_service_;
 
+  // The service used to run operations that have no ring equivalent.
+  background_file_service& background_service_;
+
   // Cached success value to avoid accessing category singleton.
   const asio::error_code success_ec_;
 };
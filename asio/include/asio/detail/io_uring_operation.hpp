@@ -20,6 +20,7 @@
 #if defined(ASIO_HAS_IO_URING)
 
 #include <liburing.h>
+#include <time.h>
 #include "asio/detail/cstdint.hpp"
 #include "asio/detail/operation.hpp"
 
@@ -41,6 +42,27 @@ public:
   // The operation key used for targeted cancellation.
   void* cancellation_key_;
 
+  // The absolute CLOCK_MONOTONIC time at which the operation expires, if it
+  // has a per-operation deadline. A zero value means there is no deadline.
+  __kernel_timespec expiry_;
+
+  // Whether the operation has a per-operation deadline.
+  bool has_expiry() const
+  {
+    return expiry_.tv_sec != 0 || expiry_.tv_nsec != 0;
+  }
+
+  // Whether the operation's deadline has passed.
+  bool has_expired() const
+  {
+    if (!has_expiry())
+      return false;
+    ::timespec now = { 0, 0 };
+    ::clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec > expiry_.tv_sec
+      || (now.tv_sec == expiry_.tv_sec && now.tv_nsec >= expiry_.tv_nsec);
+  }
+
   // Prepare the operation.
   void prepare(::io_uring_sqe* sqe)
   {
@@ -64,6 +86,7 @@ protected:
       ec_(success_ec),
       bytes_transferred_(0),
       cancellation_key_(0),
+      expiry_(),
       prepare_func_(prepare_func),
       perform_func_(perform_func)
   {
@@ -24,6 +24,7 @@
 #include "asio/detail/buffer_sequence_adapter.hpp"
 #include "asio/detail/conditionally_enabled_mutex.hpp"
 #include "asio/detail/io_uring_operation.hpp"
+#include "asio/detail/io_uring_sqe_stage.hpp"
 #include "asio/detail/limits.hpp"
 #include "asio/detail/object_pool.hpp"
 #include "asio/detail/op_queue.hpp"
@@ -60,6 +61,7 @@ public:
     io_object* io_object_;
     op_queue<io_uring_operation> op_queue_;
     bool cancel_requested_;
+    bool staged_;
 
     ASIO_DECL io_queue();
     void set_result(int r) { task_result_ = static_cast<unsigned>(r); }
@@ -88,6 +90,24 @@ public:
   // Per I/O object data.
   typedef io_object* per_io_object_data;
 
+  // Counters that describe contention for the service's lock when starting
+  // operations. An operation that finds the lock held by another thread stages
+  // its entries rather than waiting, unless the stage is full.
+  struct submission_statistics
+  {
+    // Entries that were submitted directly while holding the lock.
+    std::size_t direct_sqes;
+
+    // The number of times an operation found the lock held by another thread.
+    std::size_t lock_contentions;
+
+    // Entries that were staged because the lock was held.
+    std::size_t staged_sqes;
+
+    // The number of batches in which staged entries were submitted.
+    std::size_t staged_flushes;
+  };
+
   // Constructor.
   ASIO_DECL io_uring_service(asio::execution_context& ctx);
 
@@ -120,11 +140,22 @@ public:
   // Post an operation for immediate completion.
   void post_immediate_completion(operation* op, bool is_continuation);
 
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+  // Post an operation to the scheduler that owns another ring, by sending it
+  // as a message from this ring. Returns false if the message cannot be sent,
+  // including when the target has been shut down, so the caller can post the
+  // operation through the target scheduler's queue instead.
+  ASIO_DECL bool post_message(io_uring_service& target, operation* op);
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
+
   // Start a new operation. The operation will be prepared and submitted to the
   // io_uring when it is at the head of its I/O operation queue.
   ASIO_DECL void start_op(int op_type, per_io_object_data& io_obj,
       io_uring_operation* op, bool is_continuation);
 
+  // Get the submission statistics.
+  ASIO_DECL submission_statistics get_submission_statistics();
+
   // Cancel all operations associated with the given I/O object. The handlers
   // associated with the I/O object will be invoked with the operation_aborted
   // error.
@@ -196,6 +227,29 @@ private:
   // The number of operations to complete in a batch.
   enum { complete_batch_size = 128 };
 
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+  // Tags applied to the user data of completions that carry messages.
+  enum
+  {
+    message_delivery = 1,
+    message_sent = 2,
+    message_tag_mask = 3
+  };
+
+  // Whether the user data of a completion carries a message.
+  static bool is_message(void* ptr)
+  {
+    return (reinterpret_cast<std::size_t>(ptr) & message_tag_mask) != 0;
+  }
+
+  // Process a completion that carries a message.
+  ASIO_DECL void complete_message(void* ptr,
+      int result, op_queue<operation>& ops);
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
+
+  // Get the next completion when draining the ring on shutdown or fork.
+  ASIO_DECL bool get_drained_cqe(::io_uring_cqe** cqe, bool first);
+
   // The type used for processing eventfd readiness notifications.
   class event_fd_read_op;
 
@@ -235,6 +289,27 @@ private:
   // Submit pending submission queue entries.
   ASIO_DECL void submit_sqes();
 
+  // Prepare the submission queue entries for an operation, linking a timeout
+  // entry if the operation has a deadline. Returns false if the entries could
+  // not be obtained.
+  ASIO_DECL bool prepare_sqes(io_uring_operation* op, void* data);
+
+  // Fill in the entries for an operation. The timeout entry is used only if
+  // the operation has a deadline.
+  ASIO_DECL static void prepare_op_sqes(io_uring_operation* op, void* data,
+      ::io_uring_sqe* sqe, ::io_uring_sqe* timeout_sqe);
+
+  // Lock the mutex to prepare the entries for an operation. If another thread
+  // holds the mutex and the stage has room, the entries are staged instead and
+  // false is returned. Must be called while the I/O object's mutex is held.
+  ASIO_DECL bool lock_or_stage_sqes(io_uring_operation* op, io_queue* io_q);
+
+  // Stage the entries for an operation. Returns false if the stage is full.
+  ASIO_DECL bool stage_sqes(io_uring_operation* op, io_queue* io_q);
+
+  // Copy the staged entries into the submission queue and submit them.
+  ASIO_DECL void flush_sqe_stage();
+
   // Post an operation to submit the pending submission queue entries.
   ASIO_DECL void post_submit_sqes_op(mutex::scoped_lock& lock);
 
@@ -253,6 +328,18 @@ private:
         const asio::error_code& ec, std::size_t bytes_transferred);
   };
 
+  // Helper operation to submit staged submission queue entries.
+  class flush_sqe_stage_op : operation
+  {
+    friend class io_uring_service;
+
+    io_uring_service* service_;
+
+    ASIO_DECL flush_sqe_stage_op(io_uring_service* s);
+    ASIO_DECL static void do_complete(void* owner, operation* base,
+        const asio::error_code& ec, std::size_t bytes_transferred);
+  };
+
   // The scheduler implementation used to post completions.
   scheduler& scheduler_;
 
@@ -262,6 +349,15 @@ private:
   // The ring.
   ::io_uring ring_;
 
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+  // Whether the ring supports messaging other rings.
+  bool msg_ring_supported_;
+
+  // The number of messages sent by or to this ring whose completions have not
+  // yet been processed.
+  atomic_count messages_in_flight_;
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
+
   // The count of unfinished work.
   atomic_count outstanding_work_;
 
@@ -274,6 +370,15 @@ private:
   // Whether there is a pending submission operation.
   bool pending_submit_sqes_op_;
 
+  // The number of entries submitted directly, protected by the mutex.
+  std::size_t direct_sqes_;
+
+  // Entries staged while the mutex was held by another thread.
+  io_uring_sqe_stage sqe_stage_;
+
+  // The operation used to submit the staged entries.
+  flush_sqe_stage_op flush_sqe_stage_op_;
+
   // Whether the service has been shut down.
   bool shutdown_;
 
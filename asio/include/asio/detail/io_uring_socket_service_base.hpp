@@ -26,6 +26,7 @@
 #include "asio/execution_context.hpp"
 #include "asio/socket_base.hpp"
 #include "asio/detail/buffer_sequence_adapter.hpp"
+#include "asio/detail/chrono.hpp"
 #include "asio/detail/memory.hpp"
 #include "asio/detail/io_uring_null_buffers_op.hpp"
 #include "asio/detail/io_uring_service.hpp"
@@ -318,6 +319,50 @@ public:
     p.v = p.p = 0;
   }
 
+#if defined(ASIO_HAS_CHRONO)
+  // Start an asynchronous send that fails with timed_out if it has not
+  // completed by the specified expiry time. The deadline is enforced by the
+  // kernel using a linked timeout.
+  template <typename ConstBufferSequence, typename Handler, typename IoExecutor>
+  void async_send(base_implementation_type& impl,
+      const ConstBufferSequence& buffers, socket_base::message_flags flags,
+      const chrono::steady_clock::time_point& expiry,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    typename associated_cancellation_slot<Handler>::type slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_send_op<
+        ConstBufferSequence, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        impl.state_, buffers, flags, handler, io_ex);
+    p.p->expiry_ = to_kernel_timespec(expiry);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(&io_uring_service_,
+            &impl.io_object_data_, io_uring_service::write_op);
+    }
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_send(expiry)"));
+
+    start_op(impl, io_uring_service::write_op, p.p, is_continuation,
+        ((impl.state_ & socket_ops::stream_oriented)
+          && buffer_sequence_adapter<asio::const_buffer,
+            ConstBufferSequence>::all_empty(buffers)));
+    p.v = p.p = 0;
+  }
+#endif // defined(ASIO_HAS_CHRONO)
+
   // Start an asynchronous wait until data can be sent without blocking.
   template <typename Handler, typename IoExecutor>
   void async_send(base_implementation_type& impl, const null_buffers&,
@@ -426,6 +471,54 @@ public:
     p.v = p.p = 0;
   }
 
+#if defined(ASIO_HAS_CHRONO)
+  // Start an asynchronous receive that fails with timed_out if it has not
+  // completed by the specified expiry time. The deadline is enforced by the
+  // kernel using a linked timeout.
+  template <typename MutableBufferSequence,
+      typename Handler, typename IoExecutor>
+  void async_receive(base_implementation_type& impl,
+      const MutableBufferSequence& buffers, socket_base::message_flags flags,
+      const chrono::steady_clock::time_point& expiry,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    int op_type = (flags & socket_base::message_out_of_band)
+      ? io_uring_service::except_op : io_uring_service::read_op;
+
+    typename associated_cancellation_slot<Handler>::type slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef io_uring_socket_recv_op<
+        MutableBufferSequence, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        impl.state_, buffers, flags, handler, io_ex);
+    p.p->expiry_ = to_kernel_timespec(expiry);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<io_uring_op_cancellation>(
+            &io_uring_service_, &impl.io_object_data_, op_type);
+    }
+
+    ASIO_HANDLER_CREATION((io_uring_service_.context(), *p.p,
+          "socket", &impl, impl.socket_, "async_receive(expiry)"));
+
+    start_op(impl, op_type, p.p, is_continuation,
+        ((impl.state_ & socket_ops::stream_oriented)
+          && buffer_sequence_adapter<asio::mutable_buffer,
+            MutableBufferSequence>::all_empty(buffers)));
+    p.v = p.p = 0;
+  }
+#endif // defined(ASIO_HAS_CHRONO)
+
   // Wait until data can be received without blocking.
   template <typename Handler, typename IoExecutor>
   void async_receive(base_implementation_type& impl,
@@ -613,6 +706,26 @@ protected:
   ASIO_DECL void start_accept_op(base_implementation_type& impl,
       io_uring_operation* op, bool is_continuation, bool peer_is_open);
 
+#if defined(ASIO_HAS_CHRONO)
+  // Convert a steady clock time point to an absolute timespec suitable for
+  // use with a linked timeout. The steady clock uses CLOCK_MONOTONIC.
+  static __kernel_timespec to_kernel_timespec(
+      const chrono::steady_clock::time_point& expiry)
+  {
+    chrono::nanoseconds ns = chrono::duration_cast<chrono::nanoseconds>(
+        expiry.time_since_epoch());
+    __kernel_timespec ts;
+    ts.tv_sec = 0;
+    ts.tv_nsec = 1;
+    if (ns.count() > 0)
+    {
+      ts.tv_sec = static_cast<long long>(ns.count() / 1000000000);
+      ts.tv_nsec = static_cast<long long>(ns.count() % 1000000000);
+    }
+    return ts;
+  }
+#endif // defined(ASIO_HAS_CHRONO)
+
   // Helper class used to implement per-operation cancellation
   class io_uring_op_cancellation
   {
@@ -0,0 +1,83 @@
+//
+// detail/io_uring_sqe_stage.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_IO_URING_SQE_STAGE_HPP
+#define ASIO_DETAIL_IO_URING_SQE_STAGE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_IO_URING)
+
+#include <liburing.h>
+#include "asio/detail/conditionally_enabled_mutex.hpp"
+#include "asio/detail/noncopyable.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Submission queue entries for operations that were started while another
+// thread held the io_uring service's lock. Rather than wait for that lock, the
+// starting thread copies its entries here under a lock that is only ever held
+// briefly. The entries are moved to the ring by an operation that is posted to
+// the scheduler when the stage becomes non-empty, so any thread running the
+// scheduler may submit them.
+class io_uring_sqe_stage
+  : private noncopyable
+{
+public:
+  // The maximum number of entries that may be staged before a flush.
+  enum { max_sqes = 64 };
+
+  explicit io_uring_sqe_stage(bool locking)
+    : mutex_(locking),
+      count_(0),
+      flush_pending_(false),
+      lock_contentions_(0),
+      staged_sqes_(0),
+      flushes_(0)
+  {
+  }
+
+  // Mutex to protect access to the stage.
+  conditionally_enabled_mutex mutex_;
+
+  // The number of staged entries.
+  int count_;
+
+  // Whether an operation to flush the stage has been posted.
+  bool flush_pending_;
+
+  // The number of times an operation found the service's lock held.
+  std::size_t lock_contentions_;
+
+  // The number of entries that were staged.
+  std::size_t staged_sqes_;
+
+  // The number of batches in which staged entries were submitted.
+  std::size_t flushes_;
+
+  // The staged entries.
+  ::io_uring_sqe sqes_[max_sqes];
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_IO_URING)
+
+#endif // ASIO_DETAIL_IO_URING_SQE_STAGE_HPP
@@ -46,6 +46,12 @@ public:
   {
   }
 
+  // Try to lock the mutex without blocking.
+  bool try_lock()
+  {
+    return true;
+  }
+
   // Unlock the mutex.
   void unlock()
   {
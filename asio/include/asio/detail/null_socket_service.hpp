@@ -25,6 +25,7 @@
 #include "asio/post.hpp"
 #include "asio/socket_base.hpp"
 #include "asio/detail/bind_handler.hpp"
+#include "asio/detail/chrono.hpp"
 
 #include "asio/detail/push_options.hpp"
 
@@ -282,6 +283,20 @@ public:
           handler, ec, bytes_transferred));
   }
 
+#if defined(ASIO_HAS_CHRONO)
+  // Start an asynchronous send with a deadline.
+  template <typename ConstBufferSequence, typename Handler, typename IoExecutor>
+  void async_send(implementation_type&, const ConstBufferSequence&,
+      socket_base::message_flags, const chrono::steady_clock::time_point&,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    asio::error_code ec = asio::error::operation_not_supported;
+    const std::size_t bytes_transferred = 0;
+    asio::post(io_ex, detail::bind_handler(
+          handler, ec, bytes_transferred));
+  }
+#endif // defined(ASIO_HAS_CHRONO)
+
   // Start an asynchronous wait until data can be sent without blocking.
   template <typename Handler, typename IoExecutor>
   void async_send(implementation_type&, const null_buffers&,
@@ -323,6 +338,21 @@ public:
           handler, ec, bytes_transferred));
   }
 
+#if defined(ASIO_HAS_CHRONO)
+  // Start an asynchronous receive with a deadline.
+  template <typename MutableBufferSequence,
+      typename Handler, typename IoExecutor>
+  void async_receive(implementation_type&, const MutableBufferSequence&,
+      socket_base::message_flags, const chrono::steady_clock::time_point&,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    asio::error_code ec = asio::error::operation_not_supported;
+    const std::size_t bytes_transferred = 0;
+    asio::post(io_ex, detail::bind_handler(
+          handler, ec, bytes_transferred));
+  }
+#endif // defined(ASIO_HAS_CHRONO)
+
   // Wait until data can be received without blocking.
   template <typename Handler, typename IoExecutor>
   void async_receive(implementation_type&, const null_buffers&,
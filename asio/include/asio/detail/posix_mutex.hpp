@@ -51,6 +51,12 @@ public:
     (void)::pthread_mutex_lock(&mutex_); // Ignore EINVAL.
   }
 
+  // Try to lock the mutex without blocking.
+  bool try_lock()
+  {
+    return ::pthread_mutex_trylock(&mutex_) == 0;
+  }
+
   // Unlock the mutex.
   void unlock()
   {
@@ -0,0 +1,214 @@
+//
+// detail/reactive_socket_send_zero_copy_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_REACTIVE_SOCKET_SEND_ZERO_COPY_OP_HPP
+#define ASIO_DETAIL_REACTIVE_SOCKET_SEND_ZERO_COPY_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_MSG_ZEROCOPY)
+
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/buffer_sequence_adapter.hpp"
+#include "asio/detail/fenced_block.hpp"
+#include "asio/detail/handler_alloc_helpers.hpp"
+#include "asio/detail/handler_invoke_helpers.hpp"
+#include "asio/detail/handler_work.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/reactor.hpp"
+#include "asio/detail/reactor_op.hpp"
+#include "asio/detail/socket_ops.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Sends with MSG_ZEROCOPY and then waits for the notification, read from the
+// socket's error queue, that the kernel has released the buffers' pages. The
+// operation remains at the head of the descriptor's write queue until the
+// notification arrives, which the reactor reports as an error event.
+template <typename ConstBufferSequence>
+class reactive_socket_send_zero_copy_op_base : public reactor_op
+{
+public:
+  reactive_socket_send_zero_copy_op_base(const asio::error_code& success_ec,
+      socket_type socket, reactor::per_descriptor_data descriptor_data,
+      const ConstBufferSequence& buffers, func_type complete_func)
+    : reactor_op(success_ec,
+        &reactive_socket_send_zero_copy_op_base::do_perform, complete_func),
+      socket_(socket),
+      descriptor_data_(descriptor_data),
+      buffers_(buffers),
+      sequence_(0),
+      sent_(false)
+  {
+  }
+
+  static status do_perform(reactor_op* base)
+  {
+    ASIO_ASSUME(base != 0);
+    reactive_socket_send_zero_copy_op_base* o(
+        static_cast<reactive_socket_send_zero_copy_op_base*>(base));
+
+    if (!o->sent_)
+    {
+      typedef buffer_sequence_adapter<asio::const_buffer,
+          ConstBufferSequence> bufs_type;
+
+      bufs_type bufs(o->buffers_);
+      if (!socket_ops::non_blocking_send(o->socket_,
+            bufs.buffers(), bufs.count(), ASIO_OS_DEF(MSG_ZEROCOPY),
+            o->ec_, o->bytes_transferred_))
+        return not_done;
+
+      ASIO_HANDLER_REACTOR_OPERATION((*o, "non_blocking_send",
+            o->ec_, o->bytes_transferred_));
+
+      // The kernel allocates a sequence number only to a send that succeeds.
+      if (o->ec_ || o->bytes_transferred_ == 0)
+        return done;
+
+      o->sequence_ = o->descriptor_data_->allocate_zero_copy_sequence();
+      o->sent_ = true;
+    }
+
+    if (!socket_ops::non_blocking_recv_zero_copy_notification(
+          o->socket_, o->sequence_, o->ec_))
+      return not_done;
+
+    ASIO_HANDLER_REACTOR_OPERATION((*o,
+          "non_blocking_recv_zero_copy_notification",
+          o->ec_, o->bytes_transferred_));
+
+    return done;
+  }
+
+private:
+  socket_type socket_;
+  reactor::per_descriptor_data descriptor_data_;
+  ConstBufferSequence buffers_;
+  uint32_t sequence_;
+  bool sent_;
+};
+
+template <typename ConstBufferSequence, typename Handler, typename IoExecutor>
+class reactive_socket_send_zero_copy_op :
+  public reactive_socket_send_zero_copy_op_base<ConstBufferSequence>
+{
+public:
+  typedef Handler handler_type;
+  typedef IoExecutor io_executor_type;
+
+  ASIO_DEFINE_HANDLER_PTR(reactive_socket_send_zero_copy_op);
+
+  reactive_socket_send_zero_copy_op(const asio::error_code& success_ec,
+      socket_type socket, reactor::per_descriptor_data descriptor_data,
+      const ConstBufferSequence& buffers, Handler& handler,
+      const IoExecutor& io_ex)
+    : reactive_socket_send_zero_copy_op_base<ConstBufferSequence>(
+        success_ec, socket, descriptor_data, buffers,
+        &reactive_socket_send_zero_copy_op::do_complete),
+      handler_(ASIO_MOVE_CAST(Handler)(handler)),
+      work_(handler_, io_ex)
+  {
+  }
+
+  static void do_complete(void* owner, operation* base,
+      const asio::error_code& /*ec*/,
+      std::size_t /*bytes_transferred*/)
+  {
+    // Take ownership of the handler object.
+    ASIO_ASSUME(base != 0);
+    reactive_socket_send_zero_copy_op* o(
+        static_cast<reactive_socket_send_zero_copy_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+
+    ASIO_HANDLER_COMPLETION((*o));
+
+    // Take ownership of the operation's outstanding work.
+    handler_work<Handler, IoExecutor> w(
+        ASIO_MOVE_CAST2(handler_work<Handler, IoExecutor>)(
+          o->work_));
+
+    ASIO_ERROR_LOCATION(o->ec_);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, asio::error_code, std::size_t>
+      handler(o->handler_, o->ec_, o->bytes_transferred_);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    // Make the upcall if required.
+    if (owner)
+    {
+      fenced_block b(fenced_block::half);
+      ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+      w.complete(handler, handler.handler_);
+      ASIO_HANDLER_INVOCATION_END;
+    }
+  }
+
+  static void do_immediate(operation* base, bool, const void* io_ex)
+  {
+    // Take ownership of the handler object.
+    ASIO_ASSUME(base != 0);
+    reactive_socket_send_zero_copy_op* o(
+        static_cast<reactive_socket_send_zero_copy_op*>(base));
+    ptr p = { asio::detail::addressof(o->handler_), o, o };
+
+    ASIO_HANDLER_COMPLETION((*o));
+
+    // Take ownership of the operation's outstanding work.
+    immediate_handler_work<Handler, IoExecutor> w(
+        ASIO_MOVE_CAST2(handler_work<Handler, IoExecutor>)(
+          o->work_));
+
+    ASIO_ERROR_LOCATION(o->ec_);
+
+    // Make a copy of the handler so that the memory can be deallocated before
+    // the upcall is made. Even if we're not about to make an upcall, a
+    // sub-object of the handler may be the true owner of the memory associated
+    // with the handler. Consequently, a local copy of the handler is required
+    // to ensure that any owning sub-object remains valid until after we have
+    // deallocated the memory here.
+    detail::binder2<Handler, asio::error_code, std::size_t>
+      handler(o->handler_, o->ec_, o->bytes_transferred_);
+    p.h = asio::detail::addressof(handler.handler_);
+    p.reset();
+
+    ASIO_HANDLER_INVOCATION_BEGIN((handler.arg1_, handler.arg2_));
+    w.complete(handler, handler.handler_, io_ex);
+    ASIO_HANDLER_INVOCATION_END;
+  }
+
+
+private:
+  Handler handler_;
+  handler_work<Handler, IoExecutor> work_;
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_MSG_ZEROCOPY)
+
+#endif // ASIO_DETAIL_REACTIVE_SOCKET_SEND_ZERO_COPY_OP_HPP
@@ -29,8 +29,11 @@
 #include "asio/detail/noncopyable.hpp"
 #include "asio/detail/reactive_null_buffers_op.hpp"
 #include "asio/detail/reactive_socket_accept_op.hpp"
+#include "asio/detail/reactive_socket_accept_some_op.hpp"
 #include "asio/detail/reactive_socket_connect_op.hpp"
 #include "asio/detail/reactive_socket_recvfrom_op.hpp"
+#include "asio/detail/reactive_socket_recvmmsg_op.hpp"
+#include "asio/detail/reactive_socket_sendmmsg_op.hpp"
 #include "asio/detail/reactive_socket_sendto_op.hpp"
 #include "asio/detail/reactive_socket_service_base.hpp"
 #include "asio/detail/reactor.hpp"
@@ -475,6 +478,123 @@ public:
     p.v = p.p = 0;
   }
 
+#if defined(ASIO_HAS_MMSG)
+  // Send a batch of datagrams to the specified endpoints. Returns the number
+  // of messages sent.
+  template <typename MessageIterator>
+  size_t send_many(implementation_type& impl, MessageIterator begin,
+      MessageIterator end, socket_base::message_flags flags,
+      asio::error_code& ec)
+  {
+    datagram_message_batch<MessageIterator> batch(begin, end);
+    batch.prepare_send();
+
+    std::size_t n = socket_ops::sync_sendmmsg(impl.socket_, impl.state_,
+        batch.messages(), batch.count(), flags, ec);
+
+    if (!ec)
+      batch.complete_send(n);
+
+    ASIO_ERROR_LOCATION(ec);
+    return n;
+  }
+
+  // Start an asynchronous send of a batch of datagrams. The messages must be
+  // valid for the lifetime of the asynchronous operation.
+  template <typename MessageIterator, typename Handler, typename IoExecutor>
+  void async_send_many(implementation_type& impl, MessageIterator begin,
+      MessageIterator end, socket_base::message_flags flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    typename associated_cancellation_slot<Handler>::type slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_sendmmsg_op<
+        MessageIterator, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        begin, end, flags, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<reactor_op_cancellation>(
+            &reactor_, &impl.reactor_data_, impl.socket_, reactor::write_op);
+    }
+
+    ASIO_HANDLER_CREATION((reactor_.context(), *p.p, "socket",
+          &impl, impl.socket_, "async_send_many"));
+
+    start_op(impl, reactor::write_op, p.p,
+        is_continuation, true, begin == end, &io_ex, 0);
+    p.v = p.p = 0;
+  }
+
+  // Receive a batch of datagrams with the endpoints of their senders. Blocks
+  // until at least one datagram is available. Returns the number of messages
+  // received.
+  template <typename MessageIterator>
+  size_t receive_many(implementation_type& impl, MessageIterator begin,
+      MessageIterator end, socket_base::message_flags flags,
+      asio::error_code& ec)
+  {
+    datagram_message_batch<MessageIterator> batch(begin, end);
+    batch.prepare_receive();
+
+    std::size_t n = socket_ops::sync_recvmmsg(impl.socket_, impl.state_,
+        batch.messages(), batch.count(), flags, ec);
+
+    if (!ec)
+      batch.complete_receive(n);
+
+    ASIO_ERROR_LOCATION(ec);
+    return n;
+  }
+
+  // Start an asynchronous receive of a batch of datagrams. The messages must
+  // be valid for the lifetime of the asynchronous operation.
+  template <typename MessageIterator, typename Handler, typename IoExecutor>
+  void async_receive_many(implementation_type& impl, MessageIterator begin,
+      MessageIterator end, socket_base::message_flags flags,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    typename associated_cancellation_slot<Handler>::type slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_recvmmsg_op<
+        MessageIterator, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        begin, end, flags, handler, io_ex);
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<reactor_op_cancellation>(
+            &reactor_, &impl.reactor_data_, impl.socket_, reactor::read_op);
+    }
+
+    ASIO_HANDLER_CREATION((reactor_.context(), *p.p, "socket",
+          &impl, impl.socket_, "async_receive_many"));
+
+    start_op(impl, reactor::read_op, p.p,
+        is_continuation, true, begin == end, &io_ex, 0);
+    p.v = p.p = 0;
+  }
+#endif // defined(ASIO_HAS_MMSG)
+
   // Accept a new connection.
   template <typename Socket>
   asio::error_code accept(implementation_type& impl,
@@ -541,6 +661,80 @@ public:
     p.v = p.p = 0;
   }
 
+  // Accept a batch of new connections. Blocks until at least one connection
+  // has been accepted, and then also accepts any other connections that are
+  // already queued. Returns the number of connections accepted.
+  template <typename SocketIterator>
+  std::size_t accept_some(implementation_type& impl,
+      SocketIterator begin, SocketIterator end, asio::error_code& ec)
+  {
+    socket_accept_batch<SocketIterator> batch(begin, end);
+
+    // We cannot accept a socket that is already open.
+    if (batch.any_open())
+    {
+      ec = asio::error::already_open;
+      ASIO_ERROR_LOCATION(ec);
+      return 0;
+    }
+
+    ec = asio::error_code();
+    if (begin != end)
+    {
+      socket_type new_socket = socket_ops::sync_accept(
+          impl.socket_, impl.state_, 0, 0, ec);
+      if (new_socket == invalid_socket)
+      {
+        ASIO_ERROR_LOCATION(ec);
+        return 0;
+      }
+
+      batch.add(new_socket);
+      batch.perform(impl.socket_, impl.state_, ec);
+    }
+
+    std::size_t n = batch.complete(impl.protocol_, ec);
+    ASIO_ERROR_LOCATION(ec);
+    return n;
+  }
+
+  // Start an asynchronous accept of a batch of new connections. The sockets
+  // must be valid until the accept's handler is invoked.
+  template <typename SocketIterator, typename Handler, typename IoExecutor>
+  void async_accept_some(implementation_type& impl,
+      SocketIterator begin, SocketIterator end,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    typename associated_cancellation_slot<Handler>::type slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_accept_some_op<SocketIterator,
+        Protocol, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_, impl.state_,
+        begin, end, impl.protocol_, handler, io_ex);
+    bool any_open = p.p->any_open();
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected() && !any_open)
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<reactor_op_cancellation>(
+            &reactor_, &impl.reactor_data_, impl.socket_, reactor::read_op);
+    }
+
+    ASIO_HANDLER_CREATION((reactor_.context(), *p.p, "socket",
+          &impl, impl.socket_, "async_accept_some"));
+
+    start_accept_op(impl, p.p, is_continuation, any_open, &io_ex, 0);
+    p.v = p.p = 0;
+  }
+
 #if defined(ASIO_HAS_MOVE)
   // Start an asynchronous accept. The peer_endpoint object must be valid until
   // the accept's handler is invoked.
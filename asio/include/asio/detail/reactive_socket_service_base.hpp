@@ -28,11 +28,13 @@
 #include "asio/execution_context.hpp"
 #include "asio/socket_base.hpp"
 #include "asio/detail/buffer_sequence_adapter.hpp"
+#include "asio/detail/deadline_handler.hpp"
 #include "asio/detail/memory.hpp"
 #include "asio/detail/reactive_null_buffers_op.hpp"
 #include "asio/detail/reactive_socket_recv_op.hpp"
 #include "asio/detail/reactive_socket_recvmsg_op.hpp"
 #include "asio/detail/reactive_socket_send_op.hpp"
+#include "asio/detail/reactive_socket_send_zero_copy_op.hpp"
 #include "asio/detail/reactive_wait_op.hpp"
 #include "asio/detail/reactor.hpp"
 #include "asio/detail/reactor_op.hpp"
@@ -318,6 +320,72 @@ public:
     p.v = p.p = 0;
   }
 
+#if defined(ASIO_HAS_MSG_ZEROCOPY)
+  // Start an asynchronous zero-copy send. The operation completes when the
+  // kernel has released the pages of the data being sent, which must be valid
+  // until then.
+  template <typename ConstBufferSequence, typename Handler, typename IoExecutor>
+  void async_send_zero_copy(base_implementation_type& impl,
+      const ConstBufferSequence& buffers,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    bool is_continuation =
+      asio_handler_cont_helpers::is_continuation(handler);
+
+    typename associated_cancellation_slot<Handler>::type slot
+      = asio::get_associated_cancellation_slot(handler);
+
+    // Allocate and construct an operation to wrap the handler.
+    typedef reactive_socket_send_zero_copy_op<
+        ConstBufferSequence, Handler, IoExecutor> op;
+    typename op::ptr p = { asio::detail::addressof(handler),
+      op::ptr::allocate(handler), 0 };
+    p.p = new (p.v) op(success_ec_, impl.socket_,
+        impl.reactor_data_, buffers, handler, io_ex);
+
+    // The socket must opt in to zero-copy sends before the first one.
+    if ((impl.state_ & socket_ops::zero_copy_enabled) == 0)
+    {
+      int optval = 1;
+      if (socket_ops::setsockopt(impl.socket_, impl.state_,
+            ASIO_OS_DEF(SOL_SOCKET), ASIO_OS_DEF(SO_ZEROCOPY),
+            &optval, sizeof(optval), p.p->ec_) == 0)
+        impl.state_ |= socket_ops::zero_copy_enabled;
+    }
+
+    // Optionally register for per-operation cancellation.
+    if (slot.is_connected())
+    {
+      p.p->cancellation_key_ =
+        &slot.template emplace<reactor_op_cancellation>(
+            &reactor_, &impl.reactor_data_, impl.socket_, reactor::write_op);
+    }
+
+    ASIO_HANDLER_CREATION((reactor_.context(), *p.p, "socket",
+          &impl, impl.socket_, "async_send_zero_copy"));
+
+    start_op(impl, reactor::write_op, p.p, is_continuation, true,
+        (!!p.p->ec_ || buffer_sequence_adapter<asio::const_buffer,
+          ConstBufferSequence>::all_empty(buffers)), &io_ex, 0);
+    p.v = p.p = 0;
+  }
+#endif // defined(ASIO_HAS_MSG_ZEROCOPY)
+
+#if defined(ASIO_HAS_CHRONO)
+  // Start an asynchronous send that fails with timed_out if it has not
+  // completed by the specified expiry time. The deadline is enforced using an
+  // internal timer.
+  template <typename ConstBufferSequence, typename Handler, typename IoExecutor>
+  void async_send(base_implementation_type& impl,
+      const ConstBufferSequence& buffers, socket_base::message_flags flags,
+      const chrono::steady_clock::time_point& expiry,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    deadline_handler<Handler, IoExecutor> handler2(handler, io_ex, expiry);
+    async_send(impl, buffers, flags, handler2, io_ex);
+  }
+#endif // defined(ASIO_HAS_CHRONO)
+
   // Start an asynchronous wait until data can be sent without blocking.
   template <typename Handler, typename IoExecutor>
   void async_send(base_implementation_type& impl, const null_buffers&,
@@ -428,6 +496,22 @@ public:
     p.v = p.p = 0;
   }
 
+#if defined(ASIO_HAS_CHRONO)
+  // Start an asynchronous receive that fails with timed_out if it has not
+  // completed by the specified expiry time. The deadline is enforced using an
+  // internal timer.
+  template <typename MutableBufferSequence,
+      typename Handler, typename IoExecutor>
+  void async_receive(base_implementation_type& impl,
+      const MutableBufferSequence& buffers, socket_base::message_flags flags,
+      const chrono::steady_clock::time_point& expiry,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    deadline_handler<Handler, IoExecutor> handler2(handler, io_ex, expiry);
+    async_receive(impl, buffers, flags, handler2, io_ex);
+  }
+#endif // defined(ASIO_HAS_CHRONO)
+
   // Wait until data can be received without blocking.
   template <typename Handler, typename IoExecutor>
   void async_receive(base_implementation_type& impl,
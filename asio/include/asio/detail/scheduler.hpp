@@ -28,6 +28,10 @@
 #include "asio/detail/thread.hpp"
 #include "asio/detail/thread_context.hpp"
 
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+# include <atomic>
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
+
 #include "asio/detail/push_options.hpp"
 
 namespace asio {
@@ -35,6 +39,10 @@ namespace detail {
 
 struct scheduler_thread_info;
 
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+class io_uring_service;
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
+
 class scheduler
   : public execution_context_service_base<scheduler>,
     public thread_context
@@ -174,6 +182,13 @@ private:
   ASIO_DECL static scheduler_task* get_default_task(
       asio::execution_context& ctx);
 
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+  // Try to post an operation by messaging this scheduler's ring from the ring
+  // of the scheduler running on the current thread. Returns false if the
+  // operation must be posted through the queue instead.
+  ASIO_DECL bool post_message(operation* op);
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
+
   // Helper class to run the scheduler in its own thread.
   class thread_function;
   friend class thread_function;
@@ -201,6 +216,11 @@ private:
   // The function used to get the task.
   get_task_func_type get_task_;
 
+#if defined(ASIO_HAS_IO_URING_MSG_RING)
+  // The default task, once created, for use by threads of other schedulers.
+  std::atomic<io_uring_service*> message_service_;
+#endif // defined(ASIO_HAS_IO_URING_MSG_RING)
+
   // Operation object to represent the position of the task in the queue.
   struct task_operation : operation
   {
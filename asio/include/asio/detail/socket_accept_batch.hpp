@@ -0,0 +1,148 @@
+//
+// detail/socket_accept_batch.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_SOCKET_ACCEPT_BATCH_HPP
+#define ASIO_DETAIL_SOCKET_ACCEPT_BATCH_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include <cstddef>
+#include "asio/error.hpp"
+#include "asio/detail/socket_holder.hpp"
+#include "asio/detail/socket_ops.hpp"
+#include "asio/detail/socket_types.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Accepts the connections that are queued on a listening socket into a range
+// of closed sockets. Sockets beyond the first max_sockets are left for a
+// subsequent operation.
+template <typename SocketIterator>
+class socket_accept_batch
+{
+public:
+  enum { max_sockets = 64 };
+
+  socket_accept_batch(SocketIterator begin, SocketIterator end)
+    : begin_(begin),
+      capacity_(0),
+      size_(0)
+  {
+    for (SocketIterator iter = begin;
+        iter != end && capacity_ < max_sockets; ++iter)
+      ++capacity_;
+  }
+
+  // Determine whether any of the sockets is already open.
+  bool any_open() const
+  {
+    SocketIterator iter = begin_;
+    for (std::size_t i = 0; i < capacity_; ++i, ++iter)
+      if (iter->is_open())
+        return true;
+    return false;
+  }
+
+  // Get the number of connections that have been accepted.
+  std::size_t size() const
+  {
+    return size_;
+  }
+
+  // Take ownership of a connection that was accepted by the caller.
+  void add(socket_type new_socket)
+  {
+    sockets_[size_++].reset(new_socket);
+  }
+
+  // Accept connections until the batch is full or no more are queued. Returns
+  // true when the operation is complete, which is once at least one connection
+  // has been accepted or an error has occurred.
+  bool perform(socket_type s,
+      socket_ops::state_type state, asio::error_code& ec)
+  {
+    while (size_ < capacity_)
+    {
+      socket_type new_socket = invalid_socket;
+
+      // A socket that is not in non-blocking mode would block in accept once
+      // the queue is empty, so its readiness must be checked first.
+      int ready = 1;
+      if ((state & socket_ops::non_blocking) == 0)
+      {
+        ready = socket_ops::poll_read(s,
+            socket_ops::user_set_non_blocking, 0, ec);
+        if (ready == 0)
+          break;
+        if (ready < 0 && ec == asio::error::interrupted)
+          continue;
+      }
+
+      if (ready > 0
+          && !socket_ops::non_blocking_accept(s, state, 0, 0, ec, new_socket))
+        break;
+
+      if (new_socket == invalid_socket)
+      {
+        // Connections that were accepted before the error are delivered, and
+        // the error is left to recur on the next accept.
+        if (size_ > 0)
+          ec = asio::error_code();
+        return true;
+      }
+
+      sockets_[size_++].reset(new_socket);
+    }
+
+    if (size_ > 0 || capacity_ == 0)
+    {
+      ec = asio::error_code();
+      return true;
+    }
+
+    return false;
+  }
+
+  // Assign the accepted connections to the sockets, in order. Returns the
+  // number of sockets that were assigned. Any connections that could not be
+  // assigned are closed.
+  template <typename Protocol>
+  std::size_t complete(const Protocol& protocol, asio::error_code& ec)
+  {
+    SocketIterator iter = begin_;
+    for (std::size_t i = 0; i < size_; ++i, ++iter)
+    {
+      iter->assign(protocol, sockets_[i].get(), ec);
+      if (ec)
+        return i;
+      sockets_[i].release();
+    }
+    return size_;
+  }
+
+private:
+  SocketIterator begin_;
+  std::size_t capacity_;
+  std::size_t size_;
+  socket_holder sockets_[max_sockets];
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_DETAIL_SOCKET_ACCEPT_BATCH_HPP
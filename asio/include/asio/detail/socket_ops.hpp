@@ -52,7 +52,10 @@ enum
   datagram_oriented = 32,
 
   // The socket may have been dup()-ed.
-  possible_dup = 64
+  possible_dup = 64,
+
+  // The socket has been enabled for zero-copy sends.
+  zero_copy_enabled = 128
 };
 
 typedef unsigned char state_type;
@@ -279,6 +282,80 @@ ASIO_DECL bool non_blocking_sendto1(socket_type s, const void* data,
 
 #endif // !defined(ASIO_HAS_IOCP)
 
+#if defined(ASIO_HAS_MMSG)
+
+ASIO_DECL signed_size_type recvmmsg(socket_type s, mmsghdr_type* msgs,
+    size_t count, int flags, asio::error_code& ec);
+
+ASIO_DECL size_t sync_recvmmsg(socket_type s, state_type state,
+    mmsghdr_type* msgs, size_t count, int flags, asio::error_code& ec);
+
+ASIO_DECL bool non_blocking_recvmmsg(socket_type s, mmsghdr_type* msgs,
+    size_t count, int flags, asio::error_code& ec,
+    size_t& messages_transferred);
+
+ASIO_DECL signed_size_type sendmmsg(socket_type s, mmsghdr_type* msgs,
+    size_t count, int flags, asio::error_code& ec);
+
+ASIO_DECL size_t sync_sendmmsg(socket_type s, state_type state,
+    mmsghdr_type* msgs, size_t count, int flags, asio::error_code& ec);
+
+ASIO_DECL bool non_blocking_sendmmsg(socket_type s, mmsghdr_type* msgs,
+    size_t count, int flags, asio::error_code& ec,
+    size_t& messages_transferred);
+
+#endif // defined(ASIO_HAS_MMSG)
+
+#if defined(ASIO_HAS_MSG_ZEROCOPY)
+
+ASIO_DECL int recv_zero_copy_notification(socket_type s,
+    uint32_t& first, uint32_t& last, asio::error_code& ec);
+
+ASIO_DECL bool non_blocking_recv_zero_copy_notification(socket_type s,
+    uint32_t sequence, asio::error_code& ec);
+
+#endif // defined(ASIO_HAS_MSG_ZEROCOPY)
+
+#if defined(ASIO_HAS_SO_TIMESTAMPING)
+
+ASIO_DECL uint64_t timestamp_to_nanoseconds(const timespec& ts);
+
+ASIO_DECL int recv_send_timestamp(socket_type s, uint32_t& id,
+    uint64_t& timestamp, asio::error_code& ec);
+
+#endif // defined(ASIO_HAS_SO_TIMESTAMPING)
+
+#if defined(ASIO_HAS_SENDFILE)
+
+ASIO_DECL signed_size_type sendfile(socket_type s, int fd,
+    uint64_t offset, size_t size, asio::error_code& ec);
+
+ASIO_DECL bool non_blocking_sendfile(socket_type s, int fd,
+    uint64_t offset, size_t size, asio::error_code& ec,
+    size_t& bytes_transferred);
+
+#endif // defined(ASIO_HAS_SENDFILE)
+
+#if defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+
+ASIO_DECL void* map_receive_queue(socket_type s,
+    size_t size, asio::error_code& ec);
+
+ASIO_DECL void unmap_receive_queue(void* addr, size_t size);
+
+ASIO_DECL bool non_blocking_recv_zero_copy(socket_type s,
+    void* map_addr, size_t map_size, void* copy_addr, size_t copy_size,
+    const void*& data, asio::error_code& ec, size_t& bytes_transferred);
+
+#endif // defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+
+#if defined(ASIO_HAS_REUSEPORT_CBPF)
+
+ASIO_DECL int attach_reuse_port_cpu_filter(socket_type s,
+    size_t group_size, asio::error_code& ec);
+
+#endif // defined(ASIO_HAS_REUSEPORT_CBPF)
+
 ASIO_DECL socket_type socket(int af, int type, int protocol,
     asio::error_code& ec);
 
@@ -81,6 +81,15 @@
 # if !defined(__SYMBIAN32__)
 #  include <netinet/tcp.h>
 # endif
+# if defined(ASIO_HAS_UDP_GSO)
+#  include <netinet/udp.h>
+# endif
+# if defined(ASIO_HAS_MSG_ZEROCOPY) || defined(ASIO_HAS_SO_TIMESTAMPING)
+#  include <linux/errqueue.h>
+# endif
+# if defined(ASIO_HAS_SO_TIMESTAMPING)
+#  include <linux/net_tstamp.h>
+# endif
 # include <arpa/inet.h>
 # include <netdb.h>
 # include <net/if.h>
@@ -322,6 +331,9 @@ typedef sockaddr_storage sockaddr_storage_type;
 typedef sockaddr_un sockaddr_un_type;
 typedef addrinfo addrinfo_type;
 typedef ::linger linger_type;
+#if defined(ASIO_HAS_MMSG)
+typedef ::mmsghdr mmsghdr_type;
+#endif // defined(ASIO_HAS_MMSG)
 typedef int ioctl_arg_type;
 typedef uint32_t u_long_type;
 typedef uint16_t u_short_type;
@@ -368,6 +380,86 @@ typedef int signed_size_type;
 # define ASIO_OS_DEF_SO_RCVLOWAT SO_RCVLOWAT
 # define ASIO_OS_DEF_SO_REUSEADDR SO_REUSEADDR
 # define ASIO_OS_DEF_TCP_NODELAY TCP_NODELAY
+# if defined(ASIO_HAS_UDP_GSO)
+#  if defined(UDP_SEGMENT)
+#   define ASIO_OS_DEF_UDP_SEGMENT UDP_SEGMENT
+#  else // defined(UDP_SEGMENT)
+#   define ASIO_OS_DEF_UDP_SEGMENT 103
+#  endif // defined(UDP_SEGMENT)
+#  if defined(UDP_GRO)
+#   define ASIO_OS_DEF_UDP_GRO UDP_GRO
+#  else // defined(UDP_GRO)
+#   define ASIO_OS_DEF_UDP_GRO 104
+#  endif // defined(UDP_GRO)
+# endif // defined(ASIO_HAS_UDP_GSO)
+# if defined(ASIO_HAS_MSG_ZEROCOPY)
+#  if defined(SO_ZEROCOPY)
+#   define ASIO_OS_DEF_SO_ZEROCOPY SO_ZEROCOPY
+#  else // defined(SO_ZEROCOPY)
+#   define ASIO_OS_DEF_SO_ZEROCOPY 60
+#  endif // defined(SO_ZEROCOPY)
+#  if defined(MSG_ZEROCOPY)
+#   define ASIO_OS_DEF_MSG_ZEROCOPY MSG_ZEROCOPY
+#  else // defined(MSG_ZEROCOPY)
+#   define ASIO_OS_DEF_MSG_ZEROCOPY 0x4000000
+#  endif // defined(MSG_ZEROCOPY)
+# endif // defined(ASIO_HAS_MSG_ZEROCOPY)
+# if defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+#  if defined(TCP_ZEROCOPY_RECEIVE)
+#   define ASIO_OS_DEF_TCP_ZEROCOPY_RECEIVE TCP_ZEROCOPY_RECEIVE
+#  else // defined(TCP_ZEROCOPY_RECEIVE)
+#   define ASIO_OS_DEF_TCP_ZEROCOPY_RECEIVE 35
+#  endif // defined(TCP_ZEROCOPY_RECEIVE)
+# endif // defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+# if defined(ASIO_HAS_TCP_FAST_OPEN)
+#  if defined(TCP_FASTOPEN)
+#   define ASIO_OS_DEF_TCP_FASTOPEN TCP_FASTOPEN
+#  else // defined(TCP_FASTOPEN)
+#   define ASIO_OS_DEF_TCP_FASTOPEN 23
+#  endif // defined(TCP_FASTOPEN)
+#  if defined(TCP_FASTOPEN_CONNECT)
+#   define ASIO_OS_DEF_TCP_FASTOPEN_CONNECT TCP_FASTOPEN_CONNECT
+#  else // defined(TCP_FASTOPEN_CONNECT)
+#   define ASIO_OS_DEF_TCP_FASTOPEN_CONNECT 30
+#  endif // defined(TCP_FASTOPEN_CONNECT)
+# endif // defined(ASIO_HAS_TCP_FAST_OPEN)
+# if defined(ASIO_HAS_REUSEPORT_CBPF)
+#  if defined(SO_REUSEPORT)
+#   define ASIO_OS_DEF_SO_REUSEPORT SO_REUSEPORT
+#  else // defined(SO_REUSEPORT)
+#   define ASIO_OS_DEF_SO_REUSEPORT 15
+#  endif // defined(SO_REUSEPORT)
+#  if defined(SO_INCOMING_CPU)
+#   define ASIO_OS_DEF_SO_INCOMING_CPU SO_INCOMING_CPU
+#  else // defined(SO_INCOMING_CPU)
+#   define ASIO_OS_DEF_SO_INCOMING_CPU 49
+#  endif // defined(SO_INCOMING_CPU)
+#  if defined(SO_ATTACH_REUSEPORT_CBPF)
+#   define ASIO_OS_DEF_SO_ATTACH_REUSEPORT_CBPF SO_ATTACH_REUSEPORT_CBPF
+#  else // defined(SO_ATTACH_REUSEPORT_CBPF)
+#   define ASIO_OS_DEF_SO_ATTACH_REUSEPORT_CBPF 51
+#  endif // defined(SO_ATTACH_REUSEPORT_CBPF)
+# endif // defined(ASIO_HAS_REUSEPORT_CBPF)
+# if defined(ASIO_HAS_SO_TIMESTAMPING)
+#  if defined(SO_TIMESTAMPNS)
+#   define ASIO_OS_DEF_SO_TIMESTAMPNS SO_TIMESTAMPNS
+#  else // defined(SO_TIMESTAMPNS)
+#   define ASIO_OS_DEF_SO_TIMESTAMPNS 35
+#  endif // defined(SO_TIMESTAMPNS)
+#  if defined(SO_TIMESTAMPING)
+#   define ASIO_OS_DEF_SO_TIMESTAMPING SO_TIMESTAMPING
+#  else // defined(SO_TIMESTAMPING)
+#   define ASIO_OS_DEF_SO_TIMESTAMPING 37
+#  endif // defined(SO_TIMESTAMPING)
+#  define ASIO_OS_DEF_SOF_TIMESTAMPING_TX_HARDWARE SOF_TIMESTAMPING_TX_HARDWARE
+#  define ASIO_OS_DEF_SOF_TIMESTAMPING_TX_SOFTWARE SOF_TIMESTAMPING_TX_SOFTWARE
+#  define ASIO_OS_DEF_SOF_TIMESTAMPING_RX_HARDWARE SOF_TIMESTAMPING_RX_HARDWARE
+#  define ASIO_OS_DEF_SOF_TIMESTAMPING_RX_SOFTWARE SOF_TIMESTAMPING_RX_SOFTWARE
+#  define ASIO_OS_DEF_SOF_TIMESTAMPING_SOFTWARE SOF_TIMESTAMPING_SOFTWARE
+#  define ASIO_OS_DEF_SOF_TIMESTAMPING_RAW_HARDWARE SOF_TIMESTAMPING_RAW_HARDWARE
+#  define ASIO_OS_DEF_SOF_TIMESTAMPING_OPT_ID SOF_TIMESTAMPING_OPT_ID
+#  define ASIO_OS_DEF_SOF_TIMESTAMPING_OPT_TSONLY SOF_TIMESTAMPING_OPT_TSONLY
+# endif // defined(ASIO_HAS_SO_TIMESTAMPING)
 # define ASIO_OS_DEF_IP_MULTICAST_IF IP_MULTICAST_IF
 # define ASIO_OS_DEF_IP_MULTICAST_TTL IP_MULTICAST_TTL
 # define ASIO_OS_DEF_IP_MULTICAST_LOOP IP_MULTICAST_LOOP
@@ -31,6 +31,9 @@
 namespace asio {
 namespace detail {
 
+template <typename Clock, typename WaitTraits>
+struct chrono_time_traits;
+
 template <typename Time_Traits>
 class timer_queue
   : public timer_queue_base
@@ -125,7 +128,8 @@ public:
 
     return this->to_msec(
         Time_Traits::to_posix_duration(
-          Time_Traits::subtract(heap_[0].time_, Time_Traits::now())),
+          Time_Traits::subtract(this->to_wake_time(heap_[0].time_,
+              static_cast<Time_Traits*>(0)), Time_Traits::now())),
         max_duration);
   }
 
@@ -137,7 +141,8 @@ public:
 
     return this->to_usec(
         Time_Traits::to_posix_duration(
-          Time_Traits::subtract(heap_[0].time_, Time_Traits::now())),
+          Time_Traits::subtract(this->to_wake_time(heap_[0].time_,
+              static_cast<Time_Traits*>(0)), Time_Traits::now())),
         max_duration);
   }
 
@@ -337,6 +342,22 @@ private:
     return time.is_pos_infinity();
   }
 
+  // Get the time at which the reactor should wake up for a timer.
+  template <typename Traits>
+  static time_type to_wake_time(const time_type& time, Traits*)
+  {
+    return time;
+  }
+
+  // Get the time at which the reactor should wake up for a timer, allowing
+  // for any slack permitted by the wait traits.
+  template <typename Clock, typename WaitTraits>
+  static time_type to_wake_time(const time_type& time,
+      chrono_time_traits<Clock, WaitTraits>*)
+  {
+    return chrono_time_traits<Clock, WaitTraits>::to_wake_time(time);
+  }
+
   // Helper function to convert a duration into milliseconds.
   template <typename Duration>
   long to_msec(const Duration& d, long max_duration) const
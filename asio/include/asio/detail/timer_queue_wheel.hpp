@@ -0,0 +1,550 @@
+//
+// detail/timer_queue_wheel.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_TIMER_QUEUE_WHEEL_HPP
+#define ASIO_DETAIL_TIMER_QUEUE_WHEEL_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_CHRONO)
+
+#include <cstddef>
+#include "asio/detail/chrono.hpp"
+#include "asio/detail/chrono_time_traits.hpp"
+#include "asio/detail/cstdint.hpp"
+#include "asio/detail/limits.hpp"
+#include "asio/detail/op_queue.hpp"
+#include "asio/detail/timer_queue.hpp"
+#include "asio/detail/timer_queue_base.hpp"
+#include "asio/detail/wait_op.hpp"
+#include "asio/error.hpp"
+#include "asio/wheel_wait_traits.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Template specialisation for timers that use a hierarchical timing wheel.
+//
+// Time is divided into ticks of the resolution given by the wait traits. Each
+// level of the wheel has 64 slots, with a slot at level n spanning 64^n ticks.
+// A timer is placed on the lowest level that can hold its distance from the
+// current tick, and is moved down a level each time the wheel reaches the
+// start of its slot. Timers that are too far away for the top level are kept
+// on an overflow list that is revisited once per revolution of that level,
+// and timers that are already due are kept on a list of their own.
+template <typename Clock, typename Resolution>
+class timer_queue<
+    chrono_time_traits<Clock, wheel_wait_traits<Clock, Resolution> > >
+  : public timer_queue_base
+{
+private:
+  typedef chrono_time_traits<Clock,
+      wheel_wait_traits<Clock, Resolution> > time_traits_type;
+
+public:
+  // The time type.
+  typedef typename time_traits_type::time_type time_type;
+
+  // The duration type.
+  typedef typename time_traits_type::duration_type duration_type;
+
+  // Per-timer data.
+  class per_timer_data
+  {
+  public:
+    per_timer_data() :
+      tick_(0), list_(0),
+      next_(0), prev_(0)
+    {
+    }
+
+  private:
+    friend class timer_queue;
+
+    // The operations waiting on the timer.
+    op_queue<wait_op> op_queue_;
+
+    // The tick at which the timer expires.
+    uint64_t tick_;
+
+    // The head of the slot or overflow list that holds the timer.
+    per_timer_data** list_;
+
+    // Pointers to adjacent timers in the same list.
+    per_timer_data* next_;
+    per_timer_data* prev_;
+  };
+
+  // Constructor.
+  timer_queue()
+    : resolution_(resolution_ticks()),
+      current_(0),
+      earliest_(no_tick),
+      overflow_(0),
+      due_(0)
+  {
+    for (std::size_t i = 0; i < num_levels; ++i)
+      occupied_[i] = 0;
+    for (std::size_t i = 0; i < num_levels * num_slots; ++i)
+      slots_[i] = 0;
+  }
+
+  // Add a new timer to the queue. Returns true if this is the timer that is
+  // earliest in the queue, in which case the reactor's event demultiplexing
+  // function call may need to be interrupted and restarted.
+  bool enqueue_timer(const time_type& time, per_timer_data& timer, wait_op* op)
+  {
+    // Enqueue the timer object.
+    bool earliest = false;
+    if (timer.list_ == 0)
+    {
+      // An empty wheel can start again from the current time, so that the new
+      // timer does not need to be cascaded down from an upper level.
+      if (this->empty())
+        current_ = to_tick(time_traits_type::now(), false);
+
+      link_timer(timer, to_tick(time, true));
+
+      // The reactor only needs to be interrupted if the timer is due before
+      // the tick it was last told to wait for.
+      if (timer.tick_ < earliest_)
+      {
+        earliest_ = timer.tick_;
+        earliest = true;
+      }
+    }
+
+    // Enqueue the individual timer operation.
+    timer.op_queue_.push(op);
+
+    // Interrupt reactor only if newly added timer is first to expire.
+    return earliest && timer.op_queue_.front() == op;
+  }
+
+  // Whether there are no timers in the queue.
+  virtual bool empty() const
+  {
+    for (std::size_t i = 0; i < num_levels; ++i)
+      if (occupied_[i])
+        return false;
+    return overflow_ == 0 && due_ == 0;
+  }
+
+  // Get the time for the timer that is earliest in the queue.
+  virtual long wait_duration_msec(long max_duration) const
+  {
+    earliest_ = next_event_tick();
+    if (earliest_ == no_tick)
+      return max_duration;
+
+    return this->to_msec(
+        time_traits_type::to_posix_duration(
+          time_traits_type::subtract(
+            to_time(earliest_), time_traits_type::now())),
+        max_duration);
+  }
+
+  // Get the time for the timer that is earliest in the queue.
+  virtual long wait_duration_usec(long max_duration) const
+  {
+    earliest_ = next_event_tick();
+    if (earliest_ == no_tick)
+      return max_duration;
+
+    return this->to_usec(
+        time_traits_type::to_posix_duration(
+          time_traits_type::subtract(
+            to_time(earliest_), time_traits_type::now())),
+        max_duration);
+  }
+
+  // Dequeue all timers not later than the current time.
+  virtual void get_ready_timers(op_queue<operation>& ops)
+  {
+    if (!this->empty())
+    {
+      dequeue_list(due_, ops);
+
+      const uint64_t now = to_tick(time_traits_type::now(), false);
+      for (uint64_t tick = next_event_tick();
+          tick <= now; tick = next_event_tick())
+      {
+        current_ = tick;
+        cascade_timers(tick);
+
+        occupied_[0] &= ~(static_cast<uint64_t>(1) << (tick & slot_mask));
+        dequeue_list(slots_[tick & slot_mask], ops);
+        current_ = tick + 1;
+      }
+
+      // All timers due at or before now have been dequeued, so the wheel can
+      // skip over the empty ticks in between.
+      if (current_ < now)
+        current_ = now;
+    }
+  }
+
+  // Dequeue all timers.
+  virtual void get_all_timers(op_queue<operation>& ops)
+  {
+    for (std::size_t i = 0; i < num_levels * num_slots; ++i)
+      dequeue_list(slots_[i], ops);
+    dequeue_list(overflow_, ops);
+    dequeue_list(due_, ops);
+
+    for (std::size_t i = 0; i < num_levels; ++i)
+      occupied_[i] = 0;
+  }
+
+  // Cancel and dequeue operations for the given timer.
+  std::size_t cancel_timer(per_timer_data& timer, op_queue<operation>& ops,
+      std::size_t max_cancelled = (std::numeric_limits<std::size_t>::max)())
+  {
+    std::size_t num_cancelled = 0;
+    if (timer.list_ != 0)
+    {
+      while (wait_op* op = (num_cancelled != max_cancelled)
+          ? timer.op_queue_.front() : 0)
+      {
+        op->ec_ = asio::error::operation_aborted;
+        timer.op_queue_.pop();
+        ops.push(op);
+        ++num_cancelled;
+      }
+      if (timer.op_queue_.empty())
+        unlink_timer(timer);
+    }
+    return num_cancelled;
+  }
+
+  // Cancel and dequeue a specific operation for the given timer.
+  void cancel_timer_by_key(per_timer_data* timer,
+      op_queue<operation>& ops, void* cancellation_key)
+  {
+    if (timer->list_ != 0)
+    {
+      op_queue<wait_op> other_ops;
+      while (wait_op* op = timer->op_queue_.front())
+      {
+        timer->op_queue_.pop();
+        if (op->cancellation_key_ == cancellation_key)
+        {
+          op->ec_ = asio::error::operation_aborted;
+          ops.push(op);
+        }
+        else
+          other_ops.push(op);
+      }
+      timer->op_queue_.push(other_ops);
+      if (timer->op_queue_.empty())
+        unlink_timer(*timer);
+    }
+  }
+
+  // Move operations from one timer to another, empty timer.
+  void move_timer(per_timer_data& target, per_timer_data& source)
+  {
+    target.op_queue_.push(source.op_queue_);
+
+    target.tick_ = source.tick_;
+    target.list_ = source.list_;
+    source.list_ = 0;
+
+    if (target.list_ && *target.list_ == &source)
+      *target.list_ = &target;
+    if (source.prev_)
+      source.prev_->next_ = &target;
+    if (source.next_)
+      source.next_->prev_= &target;
+    target.next_ = source.next_;
+    target.prev_ = source.prev_;
+    source.next_ = 0;
+    source.prev_ = 0;
+  }
+
+private:
+  // The shape of the wheel.
+  enum
+  {
+    slot_bits = 6,
+    num_slots = 1 << slot_bits,
+    slot_mask = num_slots - 1,
+    num_levels = 8
+  };
+
+  // A tick value used to indicate that there is nothing to wait for.
+  static const uint64_t no_tick = ~static_cast<uint64_t>(0);
+
+  // Get the length of a tick in units of the clock's duration.
+  static int64_t resolution_ticks()
+  {
+    int64_t ticks = static_cast<int64_t>(
+        chrono::duration_cast<duration_type>(Resolution(1)).count());
+    return ticks > 0 ? ticks : 1;
+  }
+
+  // Convert a time into a tick, rounding either up or down.
+  uint64_t to_tick(const time_type& t, bool round_up) const
+  {
+    int64_t d = static_cast<int64_t>(
+        time_traits_type::subtract(t, time_type()).count());
+    if (d <= 0)
+      return 0;
+    uint64_t tick = static_cast<uint64_t>(d / resolution_);
+    if (round_up && d % resolution_ != 0)
+      ++tick;
+    return tick;
+  }
+
+  // Convert a tick into the time at which it starts.
+  time_type to_time(uint64_t tick) const
+  {
+    if (tick > static_cast<uint64_t>(
+          (std::numeric_limits<int64_t>::max)() / resolution_))
+      return (time_type::max)();
+    return time_type() + duration_type(
+        static_cast<typename duration_type::rep>(
+          static_cast<int64_t>(tick) * resolution_));
+  }
+
+  // Find the distance from the given slot to the next occupied slot, wrapping
+  // around the end of the level.
+  static uint64_t next_slot(uint64_t occupied, std::size_t slot)
+  {
+    uint64_t bits = (occupied >> slot)
+      | (occupied << ((num_slots - slot) & slot_mask));
+#if defined(__GNUC__)
+    return static_cast<uint64_t>(__builtin_ctzll(bits));
+#else // defined(__GNUC__)
+    uint64_t distance = 0;
+    for (std::size_t shift = num_slots / 2; shift > 0; shift /= 2)
+    {
+      if ((bits & ((static_cast<uint64_t>(1) << shift) - 1)) == 0)
+      {
+        bits >>= shift;
+        distance += shift;
+      }
+    }
+    return distance;
+#endif // defined(__GNUC__)
+  }
+
+  // Get the next tick at which a timer expires or must be cascaded down to a
+  // lower level of the wheel.
+  uint64_t next_event_tick() const
+  {
+    if (due_)
+      return 0;
+
+    uint64_t tick = no_tick;
+    for (std::size_t level = 0; level < num_levels; ++level)
+    {
+      if (occupied_[level])
+      {
+        const std::size_t shift = slot_bits * level;
+        const uint64_t span_mask = (static_cast<uint64_t>(1) << shift) - 1;
+        const uint64_t start = (current_ + span_mask) & ~span_mask;
+        const uint64_t candidate = start + (next_slot(occupied_[level],
+              static_cast<std::size_t>(start >> shift) & slot_mask) << shift);
+        if (candidate < tick)
+          tick = candidate;
+      }
+    }
+
+    if (overflow_)
+    {
+      const uint64_t span_mask =
+        (static_cast<uint64_t>(1) << (slot_bits * num_levels)) - 1;
+      const uint64_t candidate = (current_ + span_mask) & ~span_mask;
+      if (candidate < tick)
+        tick = candidate;
+    }
+
+    return tick;
+  }
+
+  // Link a timer into the slot for its expiry tick, relative to the current
+  // tick.
+  void link_timer(per_timer_data& timer, uint64_t tick)
+  {
+    timer.tick_ = tick;
+
+    per_timer_data** list = &due_;
+    if (tick >= current_)
+    {
+      const uint64_t distance = tick - current_;
+      std::size_t level = 0;
+      while (level < num_levels
+          && (distance >> (slot_bits * (level + 1))) != 0)
+        ++level;
+
+      list = &overflow_;
+      if (level < num_levels)
+      {
+        const std::size_t slot = static_cast<std::size_t>(
+            tick >> (slot_bits * level)) & slot_mask;
+        list = &slots_[level * num_slots + slot];
+        occupied_[level] |= static_cast<uint64_t>(1) << slot;
+      }
+    }
+
+    timer.list_ = list;
+    timer.next_ = *list;
+    timer.prev_ = 0;
+    if (*list)
+      (*list)->prev_ = &timer;
+    *list = &timer;
+  }
+
+  // Remove a timer from its list.
+  void unlink_timer(per_timer_data& timer)
+  {
+    per_timer_data** list = timer.list_;
+    if (*list == &timer)
+      *list = timer.next_;
+    if (timer.prev_)
+      timer.prev_->next_ = timer.next_;
+    if (timer.next_)
+      timer.next_->prev_= timer.prev_;
+    timer.next_ = 0;
+    timer.prev_ = 0;
+    timer.list_ = 0;
+
+    if (*list == 0 && list != &overflow_ && list != &due_)
+    {
+      const std::size_t index = static_cast<std::size_t>(list - slots_);
+      occupied_[index / num_slots] &=
+        ~(static_cast<uint64_t>(1) << (index & slot_mask));
+    }
+  }
+
+  // Move the timers from the upper level slots that start at the given tick
+  // down to the lower levels.
+  void cascade_timers(uint64_t tick)
+  {
+    const uint64_t overflow_mask =
+      (static_cast<uint64_t>(1) << (slot_bits * num_levels)) - 1;
+    if (overflow_ && (tick & overflow_mask) == 0)
+      relink_list(overflow_);
+
+    for (std::size_t level = num_levels - 1; level > 0; --level)
+    {
+      const std::size_t shift = slot_bits * level;
+      if ((tick & ((static_cast<uint64_t>(1) << shift) - 1)) == 0)
+      {
+        const std::size_t slot =
+          static_cast<std::size_t>(tick >> shift) & slot_mask;
+        if (occupied_[level] & (static_cast<uint64_t>(1) << slot))
+        {
+          occupied_[level] &= ~(static_cast<uint64_t>(1) << slot);
+          relink_list(slots_[level * num_slots + slot]);
+        }
+      }
+    }
+  }
+
+  // Link every timer in a list again, relative to the current tick.
+  void relink_list(per_timer_data*& list)
+  {
+    per_timer_data* timer = list;
+    list = 0;
+    while (timer)
+    {
+      per_timer_data* next = timer->next_;
+      link_timer(*timer, timer->tick_);
+      timer = next;
+    }
+  }
+
+  // Dequeue the operations for every timer in a list.
+  static void dequeue_list(per_timer_data*& list, op_queue<operation>& ops)
+  {
+    while (list)
+    {
+      per_timer_data* timer = list;
+      list = timer->next_;
+      while (wait_op* op = timer->op_queue_.front())
+      {
+        timer->op_queue_.pop();
+        op->ec_ = asio::error_code();
+        ops.push(op);
+      }
+      timer->next_ = 0;
+      timer->prev_ = 0;
+      timer->list_ = 0;
+    }
+  }
+
+  // Helper function to convert a duration into milliseconds.
+  template <typename Duration>
+  long to_msec(const Duration& d, long max_duration) const
+  {
+    if (d.ticks() <= 0)
+      return 0;
+    int64_t msec = d.total_milliseconds();
+    if (msec == 0)
+      return 1;
+    if (msec > max_duration)
+      return max_duration;
+    return static_cast<long>(msec);
+  }
+
+  // Helper function to convert a duration into microseconds.
+  template <typename Duration>
+  long to_usec(const Duration& d, long max_duration) const
+  {
+    if (d.ticks() <= 0)
+      return 0;
+    int64_t usec = d.total_microseconds();
+    if (usec == 0)
+      return 1;
+    if (usec > max_duration)
+      return max_duration;
+    return static_cast<long>(usec);
+  }
+
+  // The length of a tick in units of the clock's duration.
+  const int64_t resolution_;
+
+  // The tick that the wheel is up to. Every timer in the wheel expires at or
+  // after this tick.
+  uint64_t current_;
+
+  // The tick the reactor was last told to wait for, or that of an earlier
+  // timer added since.
+  mutable uint64_t earliest_;
+
+  // Bitmasks of the slots that hold timers, one for each level.
+  uint64_t occupied_[num_levels];
+
+  // The heads of the slot lists, ordered by level.
+  per_timer_data* slots_[num_levels * num_slots];
+
+  // The head of the list of timers that are too far away for the wheel.
+  per_timer_data* overflow_;
+
+  // The head of the list of timers that expire before the current tick.
+  per_timer_data* due_;
+};
+
+} // namespace detail
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_CHRONO)
+
+#endif // ASIO_DETAIL_TIMER_QUEUE_WHEEL_HPP
@@ -20,6 +20,7 @@
 #if defined(ASIO_HAS_IOCP) && defined(ASIO_HAS_FILE)
 
 #include <string>
+#include "asio/detail/background_file_service.hpp"
 #include "asio/detail/cstdint.hpp"
 #include "asio/detail/win_iocp_handle_service.hpp"
 #include "asio/error.hpp"
@@ -48,6 +49,7 @@ public:
 
     uint64_t offset_;
     bool is_stream_;
+    background_file_pending_open* pending_open_;
   };
 
   // Constructor.
@@ -62,6 +64,7 @@ public:
     handle_service_.construct(impl);
     impl.offset_ = 0;
     impl.is_stream_ = false;
+    impl.pending_open_ = 0;
   }
 
   // Move-construct a new file implementation.
@@ -72,6 +75,9 @@ public:
     impl.offset_ = other_impl.offset_;
     impl.is_stream_ = other_impl.is_stream_;
     other_impl.offset_ = 0;
+    impl.pending_open_ = 0;
+    background_file_pending_open::move(&impl,
+        impl.pending_open_, other_impl.pending_open_);
   }
 
   // Move-assign from another file implementation.
@@ -84,11 +90,14 @@ public:
     impl.offset_ = other_impl.offset_;
     impl.is_stream_ = other_impl.is_stream_;
     other_impl.offset_ = 0;
+    background_file_pending_open::move(&impl,
+        impl.pending_open_, other_impl.pending_open_);
   }
 
   // Destroy a file implementation.
   void destroy(implementation_type& impl)
   {
+    background_file_pending_open::abandon(impl.pending_open_);
     handle_service_.destroy(impl);
   }
 
@@ -103,6 +112,18 @@ public:
       const char* path, file_base::flags open_flags,
       asio::error_code& ec);
 
+  // Start an asynchronous open. The open is performed on a background thread.
+  template <typename Handler, typename IoExecutor>
+  void async_open(implementation_type& impl, const std::string& path,
+      file_base::flags open_flags, Handler& handler, const IoExecutor& io_ex)
+  {
+    background_file_open<win_iocp_file_service> function(
+        *this, path, open_flags, impl.is_stream_);
+    function.pending().link(&impl, impl.pending_open_);
+    background_service_.async_perform(
+        function, handler, io_ex, &impl, "async_open");
+  }
+
   // Assign a native handle to a file implementation.
   asio::error_code assign(implementation_type& impl,
       const native_handle_type& native_handle,
@@ -121,9 +142,23 @@ public:
   asio::error_code close(implementation_type& impl,
       asio::error_code& ec)
   {
+    background_file_pending_open::abandon(impl.pending_open_);
     return handle_service_.close(impl, ec);
   }
 
+  // Start an asynchronous close. The file is moved out of the implementation
+  // immediately, and closed on a background thread.
+  template <typename Handler, typename IoExecutor>
+  void async_close(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    background_file_close<win_iocp_file_service> function(*this);
+    background_file_pending_open::abandon(impl.pending_open_);
+    move_assign(function.impl(), *this, impl);
+    background_service_.async_perform(
+        function, handler, io_ex, &impl, "async_close");
+  }
+
   // Get the native file representation.
   native_handle_type native_handle(const implementation_type& impl) const
   {
@@ -141,6 +176,15 @@ public:
   asio::error_code cancel(implementation_type& impl,
       asio::error_code& ec)
   {
+    if (impl.pending_open_ && !handle_service_.is_open(impl))
+    {
+      // Only the open is outstanding, and abandoning it cancels it.
+      background_file_pending_open::abandon(impl.pending_open_);
+      ec = asio::error_code();
+      return ec;
+    }
+
+    background_file_pending_open::abandon(impl.pending_open_);
     return handle_service_.cancel(impl, ec);
   }
 
@@ -148,18 +192,62 @@ public:
   ASIO_DECL uint64_t size(const implementation_type& impl,
       asio::error_code& ec) const;
 
+  // Start an asynchronous operation to get the size of the file. The size is
+  // obtained on a background thread.
+  template <typename Handler, typename IoExecutor>
+  void async_size(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    background_service_.async_perform(
+        background_file_size<win_iocp_file_service>(*this, impl),
+        handler, io_ex, &impl, "async_size");
+  }
+
   // Alter the size of the file.
   ASIO_DECL asio::error_code resize(implementation_type& impl,
       uint64_t n, asio::error_code& ec);
 
+  // Start an asynchronous operation to alter the size of the file. The resize
+  // is performed on a background thread.
+  template <typename Handler, typename IoExecutor>
+  void async_resize(implementation_type& impl, uint64_t n,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    background_service_.async_perform(
+        background_file_resize<win_iocp_file_service>(*this, impl, n),
+        handler, io_ex, &impl, "async_resize");
+  }
+
   // Synchronise the file to disk.
   ASIO_DECL asio::error_code sync_all(implementation_type& impl,
       asio::error_code& ec);
 
+  // Start an asynchronous operation to synchronise the file to disk. The
+  // flush is performed on a background thread.
+  template <typename Handler, typename IoExecutor>
+  void async_sync_all(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    background_service_.async_perform(
+        background_file_sync<win_iocp_file_service>(*this, impl, false),
+        handler, io_ex, &impl, "async_sync_all");
+  }
+
   // Synchronise the file data to disk.
   ASIO_DECL asio::error_code sync_data(implementation_type& impl,
       asio::error_code& ec);
 
+  // Start an asynchronous operation to synchronise the file data to disk. The
+  // flush is performed on a background thread.
+  template <typename Handler, typename IoExecutor>
+  void async_sync_data(implementation_type& impl,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    background_service_.async_perform(
+        background_file_sync<win_iocp_file_service>(*this, impl, true),
+        handler, io_ex, &impl, "async_sync_data");
+  }
+
   // Seek to a position in the file.
   ASIO_DECL uint64_t seek(implementation_type& impl, int64_t offset,
       file_base::seek_basis whence, asio::error_code& ec);
@@ -251,6 +339,9 @@ private:
   // The implementation used for initiating asynchronous operations.
   win_iocp_handle_service handle_service_;
 
+  // The service used to run operations that have no overlapped equivalent.
+  background_file_service& background_service_;
+
   // Emulation of Windows IO_STATUS_BLOCK structure.
   struct io_status_block
   {
@@ -25,6 +25,7 @@
 #include "asio/socket_base.hpp"
 #include "asio/detail/bind_handler.hpp"
 #include "asio/detail/buffer_sequence_adapter.hpp"
+#include "asio/detail/deadline_handler.hpp"
 #include "asio/detail/fenced_block.hpp"
 #include "asio/detail/handler_alloc_helpers.hpp"
 #include "asio/detail/handler_invoke_helpers.hpp"
@@ -325,6 +326,21 @@ public:
     p.v = p.p = 0;
   }
 
+#if defined(ASIO_HAS_CHRONO)
+  // Start an asynchronous send that fails with timed_out if it has not
+  // completed by the specified expiry time. The deadline is enforced using an
+  // internal timer.
+  template <typename ConstBufferSequence, typename Handler, typename IoExecutor>
+  void async_send(base_implementation_type& impl,
+      const ConstBufferSequence& buffers, socket_base::message_flags flags,
+      const chrono::steady_clock::time_point& expiry,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    deadline_handler<Handler, IoExecutor> handler2(handler, io_ex, expiry);
+    async_send(impl, buffers, flags, handler2, io_ex);
+  }
+#endif // defined(ASIO_HAS_CHRONO)
+
   // Start an asynchronous wait until data can be sent without blocking.
   template <typename Handler, typename IoExecutor>
   void async_send(base_implementation_type& impl, const null_buffers&,
@@ -401,6 +417,22 @@ public:
     p.v = p.p = 0;
   }
 
+#if defined(ASIO_HAS_CHRONO)
+  // Start an asynchronous receive that fails with timed_out if it has not
+  // completed by the specified expiry time. The deadline is enforced using an
+  // internal timer.
+  template <typename MutableBufferSequence,
+      typename Handler, typename IoExecutor>
+  void async_receive(base_implementation_type& impl,
+      const MutableBufferSequence& buffers, socket_base::message_flags flags,
+      const chrono::steady_clock::time_point& expiry,
+      Handler& handler, const IoExecutor& io_ex)
+  {
+    deadline_handler<Handler, IoExecutor> handler2(handler, io_ex, expiry);
+    async_receive(impl, buffers, flags, handler2, io_ex);
+  }
+#endif // defined(ASIO_HAS_CHRONO)
+
   // Wait until data can be received without blocking.
   template <typename Handler, typename IoExecutor>
   void async_receive(base_implementation_type& impl,
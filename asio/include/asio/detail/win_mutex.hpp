@@ -49,6 +49,12 @@ public:
     ::EnterCriticalSection(&crit_section_);
   }
 
+  // Try to lock the mutex without blocking.
+  bool try_lock()
+  {
+    return ::TryEnterCriticalSection(&crit_section_) != FALSE;
+  }
+
   // Unlock the mutex.
   void unlock()
   {
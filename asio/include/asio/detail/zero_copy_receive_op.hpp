@@ -0,0 +1,266 @@
+//
+// detail/zero_copy_receive_op.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_DETAIL_ZERO_COPY_RECEIVE_OP_HPP
+#define ASIO_DETAIL_ZERO_COPY_RECEIVE_OP_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+
+#include "asio/associator.hpp"
+#include "asio/socket_base.hpp"
+#include "asio/zero_copy_receive_buffer.hpp"
+#include "asio/detail/base_from_cancellation_state.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/handler_alloc_helpers.hpp"
+#include "asio/detail/handler_cont_helpers.hpp"
+#include "asio/detail/handler_invoke_helpers.hpp"
+#include "asio/detail/handler_tracking.hpp"
+#include "asio/detail/socket_ops.hpp"
+#include "asio/post.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+// Performs a zero-copy receive into a buffer.
+class zero_copy_receive_engine
+{
+public:
+  // Receive as much data as is available without blocking. Returns false if
+  // the socket must become readable before trying again.
+  static bool perform(zero_copy_receive_buffer& b,
+      socket_type s, asio::error_code& ec)
+  {
+    b.data_ = asio::const_buffer();
+
+    // The mapping belongs to the socket on which it was created. If the socket
+    // does not support it the data is always copied.
+    if (b.socket_ != s)
+    {
+      socket_ops::unmap_receive_queue(b.map_, b.map_size_);
+      asio::error_code map_ec;
+      b.map_ = socket_ops::map_receive_queue(s, b.map_size_, map_ec);
+      b.socket_ = s;
+    }
+
+    const void* data = 0;
+    std::size_t bytes = 0;
+    if (!socket_ops::non_blocking_recv_zero_copy(s, b.map_, b.map_size_,
+          b.copy_, b.copy_size_, data, ec, bytes))
+      return false;
+
+    if (!ec)
+      b.data_ = asio::const_buffer(data, bytes);
+    return true;
+  }
+};
+
+template <typename Socket, typename ReadHandler>
+class zero_copy_receive_op
+  : public base_from_cancellation_state<ReadHandler>
+{
+public:
+  zero_copy_receive_op(Socket& socket,
+      zero_copy_receive_buffer& buffer, ReadHandler& handler)
+    : base_from_cancellation_state<ReadHandler>(handler),
+      socket_(socket),
+      buffer_(buffer),
+      start_(0),
+      handler_(ASIO_MOVE_CAST(ReadHandler)(handler))
+  {
+  }
+
+#if defined(ASIO_HAS_MOVE)
+  zero_copy_receive_op(const zero_copy_receive_op& other)
+    : base_from_cancellation_state<ReadHandler>(other),
+      socket_(other.socket_),
+      buffer_(other.buffer_),
+      start_(other.start_),
+      handler_(other.handler_)
+  {
+  }
+
+  zero_copy_receive_op(zero_copy_receive_op&& other)
+    : base_from_cancellation_state<ReadHandler>(
+        ASIO_MOVE_CAST(base_from_cancellation_state<
+          ReadHandler>)(other)),
+      socket_(other.socket_),
+      buffer_(other.buffer_),
+      start_(other.start_),
+      handler_(ASIO_MOVE_CAST(ReadHandler)(other.handler_))
+  {
+  }
+#endif // defined(ASIO_HAS_MOVE)
+
+  void operator()(asio::error_code ec,
+      std::size_t = 0, int start = 0)
+  {
+    switch (start_ = start)
+    {
+      case 1:
+      // Data that is already queued is received without waiting. The result
+      // is posted back to the operation, marked as complete.
+      if (zero_copy_receive_engine::perform(
+            buffer_, socket_.native_handle(), ec))
+      {
+        ASIO_HANDLER_LOCATION((__FILE__, __LINE__,
+              "async_receive_zero_copy"));
+        asio::post(socket_.get_executor(),
+            detail::bind_handler(
+              ASIO_MOVE_CAST(zero_copy_receive_op)(*this), ec, 0, 2));
+        return;
+      }
+      for (;;)
+      {
+        {
+          ASIO_HANDLER_LOCATION((__FILE__, __LINE__,
+                "async_receive_zero_copy"));
+          socket_.async_wait(socket_base::wait_read,
+              ASIO_MOVE_CAST(zero_copy_receive_op)(*this));
+        }
+        return; default:
+        if (ec || start_ == 2)
+          break;
+        if (this->cancelled() != cancellation_type::none)
+        {
+          ec = error::operation_aborted;
+          break;
+        }
+        if (zero_copy_receive_engine::perform(
+              buffer_, socket_.native_handle(), ec))
+          break;
+      }
+
+      ASIO_MOVE_OR_LVALUE(ReadHandler)(handler_)(
+          static_cast<const asio::error_code&>(ec),
+          static_cast<const std::size_t&>(buffer_.size()));
+    }
+  }
+
+//private:
+  Socket& socket_;
+  zero_copy_receive_buffer& buffer_;
+  int start_;
+  ReadHandler handler_;
+};
+
+template <typename Socket, typename ReadHandler>
+inline asio_handler_allocate_is_deprecated
+asio_handler_allocate(std::size_t size,
+    zero_copy_receive_op<Socket, ReadHandler>* this_handler)
+{
+#if defined(ASIO_NO_DEPRECATED)
+  asio_handler_alloc_helpers::allocate(size, this_handler->handler_);
+  return asio_handler_allocate_is_no_longer_used();
+#else // defined(ASIO_NO_DEPRECATED)
+  return asio_handler_alloc_helpers::allocate(
+      size, this_handler->handler_);
+#endif // defined(ASIO_NO_DEPRECATED)
+}
+
+template <typename Socket, typename ReadHandler>
+inline asio_handler_deallocate_is_deprecated
+asio_handler_deallocate(void* pointer, std::size_t size,
+    zero_copy_receive_op<Socket, ReadHandler>* this_handler)
+{
+  asio_handler_alloc_helpers::deallocate(
+      pointer, size, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+  return asio_handler_deallocate_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+}
+
+template <typename Socket, typename ReadHandler>
+inline bool asio_handler_is_continuation(
+    zero_copy_receive_op<Socket, ReadHandler>* this_handler)
+{
+  return this_handler->start_ == 0 ? true
+    : asio_handler_cont_helpers::is_continuation(
+        this_handler->handler_);
+}
+
+template <typename Function, typename Socket, typename ReadHandler>
+inline asio_handler_invoke_is_deprecated
+asio_handler_invoke(Function& function,
+    zero_copy_receive_op<Socket, ReadHandler>* this_handler)
+{
+  asio_handler_invoke_helpers::invoke(
+      function, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+  return asio_handler_invoke_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+}
+
+template <typename Function, typename Socket, typename ReadHandler>
+inline asio_handler_invoke_is_deprecated
+asio_handler_invoke(const Function& function,
+    zero_copy_receive_op<Socket, ReadHandler>* this_handler)
+{
+  asio_handler_invoke_helpers::invoke(
+      function, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+  return asio_handler_invoke_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+}
+
+template <typename Socket, typename ReadHandler>
+inline void start_zero_copy_receive_op(Socket& socket,
+    zero_copy_receive_buffer& buffer, ReadHandler& handler)
+{
+  detail::zero_copy_receive_op<Socket, ReadHandler>(
+      socket, buffer, handler)(asio::error_code(), 0, 1);
+}
+
+} // namespace detail
+
+#if !defined(GENERATING_DOCUMENTATION)
+
+template <template <typename, typename> class Associator,
+    typename Socket, typename ReadHandler,
+    typename DefaultCandidate>
+struct associator<Associator,
+    detail::zero_copy_receive_op<Socket, ReadHandler>,
+    DefaultCandidate>
+  : Associator<ReadHandler, DefaultCandidate>
+{
+  static typename Associator<ReadHandler, DefaultCandidate>::type
+  get(const detail::zero_copy_receive_op<Socket, ReadHandler>& h)
+    ASIO_NOEXCEPT
+  {
+    return Associator<ReadHandler, DefaultCandidate>::get(h.handler_);
+  }
+
+  static ASIO_AUTO_RETURN_TYPE_PREFIX2(
+      typename Associator<ReadHandler, DefaultCandidate>::type)
+  get(const detail::zero_copy_receive_op<Socket, ReadHandler>& h,
+      const DefaultCandidate& c) ASIO_NOEXCEPT
+    ASIO_AUTO_RETURN_TYPE_SUFFIX((
+      Associator<ReadHandler, DefaultCandidate>::get(h.handler_, c)))
+  {
+    return Associator<ReadHandler, DefaultCandidate>::get(h.handler_, c);
+  }
+};
+
+#endif // !defined(GENERATING_DOCUMENTATION)
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+
+#endif // ASIO_DETAIL_ZERO_COPY_RECEIVE_OP_HPP
@@ -0,0 +1,315 @@
+//
+// impl/sendfile.hpp
+// ~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_IMPL_SENDFILE_HPP
+#define ASIO_IMPL_SENDFILE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/associator.hpp"
+#include "asio/buffer.hpp"
+#include "asio/detail/base_from_cancellation_state.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/handler_alloc_helpers.hpp"
+#include "asio/detail/handler_cont_helpers.hpp"
+#include "asio/detail/handler_invoke_helpers.hpp"
+#include "asio/detail/handler_tracking.hpp"
+#include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/non_const_lvalue.hpp"
+#include "asio/detail/socket_ops.hpp"
+#include "asio/post.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+namespace detail
+{
+  template <typename Socket, typename File, typename WriteHandler>
+  class sendfile_op
+    : public base_from_cancellation_state<WriteHandler>
+  {
+  public:
+    sendfile_op(Socket& socket, int fd, uint64_t offset,
+        std::size_t count, WriteHandler& handler)
+      : base_from_cancellation_state<WriteHandler>(handler),
+        socket_(socket),
+        fd_(fd),
+        offset_(offset),
+        count_(count),
+        total_(0),
+        start_(0),
+        handler_(ASIO_MOVE_CAST(WriteHandler)(handler))
+    {
+    }
+
+#if defined(ASIO_HAS_MOVE)
+    sendfile_op(const sendfile_op& other)
+      : base_from_cancellation_state<WriteHandler>(other),
+        socket_(other.socket_),
+        fd_(other.fd_),
+        offset_(other.offset_),
+        count_(other.count_),
+        total_(other.total_),
+        start_(other.start_),
+        handler_(other.handler_)
+    {
+    }
+
+    sendfile_op(sendfile_op&& other)
+      : base_from_cancellation_state<WriteHandler>(
+          ASIO_MOVE_CAST(base_from_cancellation_state<
+            WriteHandler>)(other)),
+        socket_(other.socket_),
+        fd_(other.fd_),
+        offset_(other.offset_),
+        count_(other.count_),
+        total_(other.total_),
+        start_(other.start_),
+        handler_(ASIO_MOVE_CAST(WriteHandler)(other.handler_))
+    {
+    }
+#endif // defined(ASIO_HAS_MOVE)
+
+    void operator()(asio::error_code ec,
+        std::size_t = 0, int start = 0)
+    {
+      switch (start_ = start)
+      {
+        case 1:
+        socket_.native_non_blocking(true, ec);
+        if (ec || count_ == 0)
+        {
+          ASIO_HANDLER_LOCATION((__FILE__, __LINE__, "async_sendfile"));
+          asio::post(socket_.get_executor(),
+              detail::bind_handler(
+                ASIO_MOVE_CAST(sendfile_op)(*this), ec));
+          return;
+        }
+        for (;;)
+        {
+          {
+            ASIO_HANDLER_LOCATION((__FILE__, __LINE__, "async_sendfile"));
+            socket_.async_write_some(asio::null_buffers(),
+                ASIO_MOVE_CAST(sendfile_op)(*this));
+          }
+          return; default:
+          if (ec)
+            break;
+          if (this->cancelled() != cancellation_type::none)
+          {
+            ec = error::operation_aborted;
+            break;
+          }
+          if (perform(ec))
+            break;
+        }
+
+        ASIO_MOVE_OR_LVALUE(WriteHandler)(handler_)(
+            static_cast<const asio::error_code&>(ec),
+            static_cast<const std::size_t&>(total_));
+      }
+    }
+
+    // Write as much of the file as possible. Returns false if the socket must
+    // become ready before trying again.
+    bool perform(asio::error_code& ec)
+    {
+      while (total_ < count_)
+      {
+        // The kernel will not move more than this many bytes in a call.
+        std::size_t chunk = count_ - total_;
+        if (chunk > 0x7ffff000)
+          chunk = 0x7ffff000;
+
+        std::size_t bytes = 0;
+        if (!socket_ops::non_blocking_sendfile(socket_.native_handle(),
+              fd_, offset_ + total_, chunk, ec, bytes))
+          return false;
+        if (ec)
+          return true;
+        total_ += bytes;
+      }
+      ec = asio::error_code();
+      return true;
+    }
+
+  //private:
+    Socket& socket_;
+    int fd_;
+    uint64_t offset_;
+    std::size_t count_;
+    std::size_t total_;
+    int start_;
+    WriteHandler handler_;
+  };
+
+  template <typename Socket, typename File, typename WriteHandler>
+  inline asio_handler_allocate_is_deprecated
+  asio_handler_allocate(std::size_t size,
+      sendfile_op<Socket, File, WriteHandler>* this_handler)
+  {
+#if defined(ASIO_NO_DEPRECATED)
+    asio_handler_alloc_helpers::allocate(size, this_handler->handler_);
+    return asio_handler_allocate_is_no_longer_used();
+#else // defined(ASIO_NO_DEPRECATED)
+    return asio_handler_alloc_helpers::allocate(
+        size, this_handler->handler_);
+#endif // defined(ASIO_NO_DEPRECATED)
+  }
+
+  template <typename Socket, typename File, typename WriteHandler>
+  inline asio_handler_deallocate_is_deprecated
+  asio_handler_deallocate(void* pointer, std::size_t size,
+      sendfile_op<Socket, File, WriteHandler>* this_handler)
+  {
+    asio_handler_alloc_helpers::deallocate(
+        pointer, size, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+    return asio_handler_deallocate_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+  }
+
+  template <typename Socket, typename File, typename WriteHandler>
+  inline bool asio_handler_is_continuation(
+      sendfile_op<Socket, File, WriteHandler>* this_handler)
+  {
+    return this_handler->start_ == 0 ? true
+      : asio_handler_cont_helpers::is_continuation(
+          this_handler->handler_);
+  }
+
+  template <typename Function, typename Socket,
+      typename File, typename WriteHandler>
+  inline asio_handler_invoke_is_deprecated
+  asio_handler_invoke(Function& function,
+      sendfile_op<Socket, File, WriteHandler>* this_handler)
+  {
+    asio_handler_invoke_helpers::invoke(
+        function, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+    return asio_handler_invoke_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+  }
+
+  template <typename Function, typename Socket,
+      typename File, typename WriteHandler>
+  inline asio_handler_invoke_is_deprecated
+  asio_handler_invoke(const Function& function,
+      sendfile_op<Socket, File, WriteHandler>* this_handler)
+  {
+    asio_handler_invoke_helpers::invoke(
+        function, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+    return asio_handler_invoke_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+  }
+
+  template <typename Socket, typename File, typename WriteHandler>
+  inline void start_sendfile_op(Socket& socket, File& file,
+      uint64_t offset, std::size_t count, WriteHandler& handler)
+  {
+    detail::sendfile_op<Socket, File, WriteHandler>(
+        socket, file.native_handle(), offset, count, handler)(
+          asio::error_code(), 0, 1);
+  }
+
+  template <typename Socket, typename File>
+  class initiate_async_sendfile
+  {
+  public:
+    typedef typename Socket::executor_type executor_type;
+
+    initiate_async_sendfile(Socket& socket, File& file)
+      : socket_(socket),
+        file_(file)
+    {
+    }
+
+    executor_type get_executor() const ASIO_NOEXCEPT
+    {
+      return socket_.get_executor();
+    }
+
+    template <typename WriteHandler>
+    void operator()(ASIO_MOVE_ARG(WriteHandler) handler,
+        uint64_t offset, std::size_t count) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+      non_const_lvalue<WriteHandler> handler2(handler);
+      start_sendfile_op(socket_, file_, offset, count, handler2.value);
+    }
+
+  private:
+    Socket& socket_;
+    File& file_;
+  };
+} // namespace detail
+
+#if !defined(GENERATING_DOCUMENTATION)
+
+template <template <typename, typename> class Associator,
+    typename Socket, typename File, typename WriteHandler,
+    typename DefaultCandidate>
+struct associator<Associator,
+    detail::sendfile_op<Socket, File, WriteHandler>,
+    DefaultCandidate>
+  : Associator<WriteHandler, DefaultCandidate>
+{
+  static typename Associator<WriteHandler, DefaultCandidate>::type
+  get(const detail::sendfile_op<Socket, File, WriteHandler>& h)
+    ASIO_NOEXCEPT
+  {
+    return Associator<WriteHandler, DefaultCandidate>::get(h.handler_);
+  }
+
+  static ASIO_AUTO_RETURN_TYPE_PREFIX2(
+      typename Associator<WriteHandler, DefaultCandidate>::type)
+  get(const detail::sendfile_op<Socket, File, WriteHandler>& h,
+      const DefaultCandidate& c) ASIO_NOEXCEPT
+    ASIO_AUTO_RETURN_TYPE_SUFFIX((
+      Associator<WriteHandler, DefaultCandidate>::get(h.handler_, c)))
+  {
+    return Associator<WriteHandler, DefaultCandidate>::get(h.handler_, c);
+  }
+};
+
+#endif // !defined(GENERATING_DOCUMENTATION)
+
+template <typename Socket, typename File,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      std::size_t)) WriteToken>
+inline ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(WriteToken,
+    void (asio::error_code, std::size_t))
+async_sendfile(Socket& socket, File& file,
+    uint64_t offset, std::size_t count,
+    ASIO_MOVE_ARG(WriteToken) token)
+  ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+    async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        declval<detail::initiate_async_sendfile<Socket, File> >(),
+        token, offset, count)))
+{
+  return async_initiate<WriteToken,
+    void (asio::error_code, std::size_t)>(
+      detail::initiate_async_sendfile<Socket, File>(socket, file),
+      token, offset, count);
+}
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_IMPL_SENDFILE_HPP
@@ -0,0 +1,613 @@
+//
+// impl/splice.hpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_IMPL_SPLICE_HPP
+#define ASIO_IMPL_SPLICE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/associator.hpp"
+#include "asio/buffer.hpp"
+#include "asio/detail/base_from_cancellation_state.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/descriptor_ops.hpp"
+#include "asio/detail/handler_alloc_helpers.hpp"
+#include "asio/detail/handler_cont_helpers.hpp"
+#include "asio/detail/handler_invoke_helpers.hpp"
+#include "asio/detail/handler_tracking.hpp"
+#include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/non_const_lvalue.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/post.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+namespace detail
+{
+  // The pipe through which data is moved when neither end of a splice is
+  // itself a pipe.
+  class splice_pipe
+    : private noncopyable
+  {
+  public:
+    splice_pipe()
+    {
+      fds_[0] = fds_[1] = -1;
+    }
+
+    ~splice_pipe()
+    {
+      asio::error_code ignored_ec;
+      for (int i = 0; i < 2; ++i)
+      {
+        descriptor_ops::state_type state = 0;
+        if (fds_[i] != -1)
+          descriptor_ops::close(fds_[i], state, ignored_ec);
+      }
+    }
+
+    int fds_[2];
+  };
+
+  struct splice_memfns_base
+  {
+    void native_non_blocking();
+  };
+
+  template <typename T>
+  struct splice_memfns_derived
+    : T, splice_memfns_base
+  {
+  };
+
+  template <typename T, T>
+  struct splice_memfns_check
+  {
+  };
+
+  template <typename>
+  char (&native_non_blocking_helper(...))[2];
+
+  template <typename T>
+  char native_non_blocking_helper(
+      splice_memfns_check<
+        void (splice_memfns_base::*)(),
+        &splice_memfns_derived<T>::native_non_blocking>*);
+
+  // Whether an I/O object keeps track of its descriptor's non-blocking mode,
+  // as sockets and stream descriptors do.
+  template <typename T>
+  struct has_native_non_blocking
+    : integral_constant<bool,
+        sizeof(native_non_blocking_helper<T>(0)) != 1>
+  {
+  };
+
+  // Places the descriptor of one end of a splice into non-blocking mode.
+  class splice_descriptor_mode
+  {
+  public:
+    splice_descriptor_mode()
+      : descriptor_(-1),
+        flags_(0)
+    {
+    }
+
+    // Objects that keep track of the mode are asked to change it, so that
+    // their state stays consistent with the descriptor.
+    template <typename Object>
+    bool set(Object& object, true_type, asio::error_code& ec)
+    {
+      object.native_non_blocking(true, ec);
+      return !ec;
+    }
+
+    // For other objects, such as pipes and files, the descriptor's flags are
+    // changed directly and must be restored when the operation completes.
+    template <typename Object>
+    bool set(Object& object, false_type, asio::error_code& ec)
+    {
+      int d = object.native_handle();
+      int flags = descriptor_ops::fcntl(d, F_GETFL, ec);
+      if (flags < 0)
+        return false;
+      if ((flags & O_NONBLOCK) == 0)
+      {
+        if (descriptor_ops::fcntl(d, F_SETFL, flags | O_NONBLOCK, ec) < 0)
+          return false;
+        descriptor_ = d;
+        flags_ = flags;
+      }
+      return true;
+    }
+
+    void restore()
+    {
+      if (descriptor_ != -1)
+      {
+        asio::error_code ignored_ec;
+        descriptor_ops::fcntl(descriptor_, F_SETFL, flags_, ignored_ec);
+        descriptor_ = -1;
+      }
+    }
+
+  private:
+    int descriptor_;
+    int flags_;
+  };
+
+  // The non-template part of the splice and tee operations. Performs as much
+  // of the transfer as can be done without blocking, and reports which
+  // readiness condition must be waited for before trying again.
+  class splice_engine
+  {
+  public:
+    enum wait_type { wait_none, wait_read, wait_write };
+
+    splice_engine(int source, int sink, std::size_t max_bytes, bool tee)
+      : source_(source),
+        sink_(sink),
+        max_bytes_(max_bytes),
+        total_(0),
+        buffered_(0),
+        tee_(tee),
+        eof_(false)
+    {
+    }
+
+    // Prepare the descriptors for the transfer.
+    template <typename Source, typename Sink>
+    asio::error_code open(Source& source, Sink& sink)
+    {
+      asio::error_code ec;
+      if (max_bytes_ == 0)
+        return ec;
+
+      if (!source_mode_.set(source, has_native_non_blocking<Source>(), ec)
+          || !sink_mode_.set(sink, has_native_non_blocking<Sink>(), ec))
+        return ec;
+
+      if (!tee_ && !descriptor_ops::is_pipe(source_)
+          && !descriptor_ops::is_pipe(sink_))
+      {
+        pipe_.reset(new splice_pipe);
+        descriptor_ops::pipe(pipe_->fds_, ec);
+      }
+
+      return ec;
+    }
+
+    // Restore the descriptors' original modes after the transfer.
+    void close()
+    {
+      source_mode_.restore();
+      sink_mode_.restore();
+    }
+
+    // Transfer as much data as possible. Returns wait_none when the operation
+    // is complete, in which case ec contains the result.
+    wait_type perform(asio::error_code& ec)
+    {
+      if (tee_)
+        return perform_tee(ec);
+      else if (pipe_)
+        return perform_piped(ec);
+      else
+        return perform_direct(ec);
+    }
+
+    // Write data that remains in the internal pipe to the sink, for as long
+    // as this can be done without blocking. Any data that cannot be written
+    // is discarded when the pipe is closed.
+    void flush()
+    {
+      while (pipe_ && buffered_ > 0)
+      {
+        asio::error_code ec;
+        std::size_t bytes = 0;
+        if (!descriptor_ops::non_blocking_splice(
+              pipe_->fds_[0], sink_, buffered_, ec, bytes) || ec)
+          return;
+        buffered_ -= bytes;
+        total_ += bytes;
+      }
+    }
+
+    // Whether there is nothing to transfer.
+    bool empty() const
+    {
+      return max_bytes_ == 0;
+    }
+
+    // The number of bytes written to the sink.
+    std::size_t total() const
+    {
+      return total_;
+    }
+
+  private:
+    wait_type perform_tee(asio::error_code& ec)
+    {
+      if (!descriptor_ops::non_blocking_tee(source_,
+            sink_, chunk_size(max_bytes_), ec, total_))
+        return pending_wait();
+      return wait_none;
+    }
+
+    wait_type perform_direct(asio::error_code& ec)
+    {
+      while (total_ < max_bytes_)
+      {
+        std::size_t bytes = 0;
+        if (!descriptor_ops::non_blocking_splice(source_,
+              sink_, chunk_size(max_bytes_ - total_), ec, bytes))
+          return pending_wait();
+        if (ec)
+          return wait_none;
+        total_ += bytes;
+      }
+      ec = asio::error_code();
+      return wait_none;
+    }
+
+    wait_type perform_piped(asio::error_code& ec)
+    {
+      for (;;)
+      {
+        std::size_t bytes = 0;
+        if (buffered_ > 0)
+        {
+          // Drain the pipe into the sink.
+          if (!descriptor_ops::non_blocking_splice(
+                pipe_->fds_[0], sink_, buffered_, ec, bytes))
+            return wait_write;
+          if (ec)
+            return wait_none;
+          buffered_ -= bytes;
+          total_ += bytes;
+        }
+        else if (eof_)
+        {
+          ec = asio::error::eof;
+          return wait_none;
+        }
+        else if (total_ == max_bytes_)
+        {
+          ec = asio::error_code();
+          return wait_none;
+        }
+        else
+        {
+          // Fill the empty pipe from the source.
+          if (!descriptor_ops::non_blocking_splice(source_,
+                pipe_->fds_[1], chunk_size(max_bytes_ - total_), ec, bytes))
+            return wait_read;
+          if (ec == asio::error::eof)
+            eof_ = true;
+          else if (ec)
+            return wait_none;
+          buffered_ += bytes;
+        }
+      }
+    }
+
+    // When a direct transfer would block, either end may be the cause.
+    wait_type pending_wait() const
+    {
+      asio::error_code ec;
+      return descriptor_ops::poll_read(source_,
+          descriptor_ops::user_set_non_blocking, ec) > 0
+        ? wait_write : wait_read;
+    }
+
+    // The kernel does not accept arbitrarily large lengths, and will not move
+    // more than this many bytes in a single call in any case.
+    static std::size_t chunk_size(std::size_t n)
+    {
+      return n < 0x7ffff000 ? n : 0x7ffff000;
+    }
+
+    int source_;
+    int sink_;
+    std::size_t max_bytes_;
+    std::size_t total_;
+    std::size_t buffered_;
+    bool tee_;
+    bool eof_;
+    splice_descriptor_mode source_mode_;
+    splice_descriptor_mode sink_mode_;
+    shared_ptr<splice_pipe> pipe_;
+  };
+
+  template <typename Source, typename Sink, typename SpliceHandler>
+  class splice_op
+    : public base_from_cancellation_state<SpliceHandler>
+  {
+  public:
+    splice_op(Source& source, Sink& sink, std::size_t max_bytes,
+        bool tee, SpliceHandler& handler)
+      : base_from_cancellation_state<SpliceHandler>(handler),
+        source_(source),
+        sink_(sink),
+        engine_(source.native_handle(), sink.native_handle(), max_bytes, tee),
+        wait_(splice_engine::wait_none),
+        start_(0),
+        handler_(ASIO_MOVE_CAST(SpliceHandler)(handler))
+    {
+    }
+
+#if defined(ASIO_HAS_MOVE)
+    splice_op(const splice_op& other)
+      : base_from_cancellation_state<SpliceHandler>(other),
+        source_(other.source_),
+        sink_(other.sink_),
+        engine_(other.engine_),
+        wait_(other.wait_),
+        start_(other.start_),
+        handler_(other.handler_)
+    {
+    }
+
+    splice_op(splice_op&& other)
+      : base_from_cancellation_state<SpliceHandler>(
+          ASIO_MOVE_CAST(base_from_cancellation_state<
+            SpliceHandler>)(other)),
+        source_(other.source_),
+        sink_(other.sink_),
+        engine_(ASIO_MOVE_CAST(splice_engine)(other.engine_)),
+        wait_(other.wait_),
+        start_(other.start_),
+        handler_(ASIO_MOVE_CAST(SpliceHandler)(other.handler_))
+    {
+    }
+#endif // defined(ASIO_HAS_MOVE)
+
+    void operator()(asio::error_code ec,
+        std::size_t = 0, int start = 0)
+    {
+      switch (start_ = start)
+      {
+        case 1:
+        ec = engine_.open(source_, sink_);
+        if (ec || engine_.empty())
+        {
+          ASIO_HANDLER_LOCATION((__FILE__, __LINE__, "async_splice"));
+          asio::post(source_.get_executor(),
+              detail::bind_handler(
+                ASIO_MOVE_CAST(splice_op)(*this), ec));
+          return;
+        }
+        wait_ = splice_engine::wait_read;
+        for (;;)
+        {
+          {
+            ASIO_HANDLER_LOCATION((__FILE__, __LINE__, "async_splice"));
+            if (wait_ == splice_engine::wait_read)
+              source_.async_read_some(asio::null_buffers(),
+                  ASIO_MOVE_CAST(splice_op)(*this));
+            else
+              sink_.async_write_some(asio::null_buffers(),
+                  ASIO_MOVE_CAST(splice_op)(*this));
+          }
+          return; default:
+          if (ec)
+            break;
+          if (this->cancelled() != cancellation_type::none)
+          {
+            ec = error::operation_aborted;
+            break;
+          }
+          wait_ = engine_.perform(ec);
+          if (wait_ == splice_engine::wait_none)
+            break;
+        }
+
+        if (ec)
+          engine_.flush();
+        engine_.close();
+        ASIO_MOVE_OR_LVALUE(SpliceHandler)(handler_)(
+            static_cast<const asio::error_code&>(ec),
+            static_cast<const std::size_t&>(engine_.total()));
+      }
+    }
+
+  //private:
+    Source& source_;
+    Sink& sink_;
+    splice_engine engine_;
+    splice_engine::wait_type wait_;
+    int start_;
+    SpliceHandler handler_;
+  };
+
+  template <typename Source, typename Sink, typename SpliceHandler>
+  inline asio_handler_allocate_is_deprecated
+  asio_handler_allocate(std::size_t size,
+      splice_op<Source, Sink, SpliceHandler>* this_handler)
+  {
+#if defined(ASIO_NO_DEPRECATED)
+    asio_handler_alloc_helpers::allocate(size, this_handler->handler_);
+    return asio_handler_allocate_is_no_longer_used();
+#else // defined(ASIO_NO_DEPRECATED)
+    return asio_handler_alloc_helpers::allocate(
+        size, this_handler->handler_);
+#endif // defined(ASIO_NO_DEPRECATED)
+  }
+
+  template <typename Source, typename Sink, typename SpliceHandler>
+  inline asio_handler_deallocate_is_deprecated
+  asio_handler_deallocate(void* pointer, std::size_t size,
+      splice_op<Source, Sink, SpliceHandler>* this_handler)
+  {
+    asio_handler_alloc_helpers::deallocate(
+        pointer, size, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+    return asio_handler_deallocate_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+  }
+
+  template <typename Source, typename Sink, typename SpliceHandler>
+  inline bool asio_handler_is_continuation(
+      splice_op<Source, Sink, SpliceHandler>* this_handler)
+  {
+    return this_handler->start_ == 0 ? true
+      : asio_handler_cont_helpers::is_continuation(
+          this_handler->handler_);
+  }
+
+  template <typename Function, typename Source,
+      typename Sink, typename SpliceHandler>
+  inline asio_handler_invoke_is_deprecated
+  asio_handler_invoke(Function& function,
+      splice_op<Source, Sink, SpliceHandler>* this_handler)
+  {
+    asio_handler_invoke_helpers::invoke(
+        function, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+    return asio_handler_invoke_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+  }
+
+  template <typename Function, typename Source,
+      typename Sink, typename SpliceHandler>
+  inline asio_handler_invoke_is_deprecated
+  asio_handler_invoke(const Function& function,
+      splice_op<Source, Sink, SpliceHandler>* this_handler)
+  {
+    asio_handler_invoke_helpers::invoke(
+        function, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+    return asio_handler_invoke_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+  }
+
+  template <typename Source, typename Sink, typename SpliceHandler>
+  inline void start_splice_op(Source& source, Sink& sink,
+      std::size_t max_bytes, bool tee, SpliceHandler& handler)
+  {
+    detail::splice_op<Source, Sink, SpliceHandler>(
+        source, sink, max_bytes, tee, handler)(
+          asio::error_code(), 0, 1);
+  }
+
+  template <typename Source, typename Sink>
+  class initiate_async_splice
+  {
+  public:
+    typedef typename Source::executor_type executor_type;
+
+    initiate_async_splice(Source& source, Sink& sink)
+      : source_(source),
+        sink_(sink)
+    {
+    }
+
+    executor_type get_executor() const ASIO_NOEXCEPT
+    {
+      return source_.get_executor();
+    }
+
+    template <typename SpliceHandler>
+    void operator()(ASIO_MOVE_ARG(SpliceHandler) handler,
+        std::size_t max_bytes, bool tee) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ReadHandler.
+      ASIO_READ_HANDLER_CHECK(SpliceHandler, handler) type_check;
+
+      non_const_lvalue<SpliceHandler> handler2(handler);
+      start_splice_op(source_, sink_, max_bytes, tee, handler2.value);
+    }
+
+  private:
+    Source& source_;
+    Sink& sink_;
+  };
+} // namespace detail
+
+#if !defined(GENERATING_DOCUMENTATION)
+
+template <template <typename, typename> class Associator,
+    typename Source, typename Sink, typename SpliceHandler,
+    typename DefaultCandidate>
+struct associator<Associator,
+    detail::splice_op<Source, Sink, SpliceHandler>,
+    DefaultCandidate>
+  : Associator<SpliceHandler, DefaultCandidate>
+{
+  static typename Associator<SpliceHandler, DefaultCandidate>::type
+  get(const detail::splice_op<Source, Sink, SpliceHandler>& h)
+    ASIO_NOEXCEPT
+  {
+    return Associator<SpliceHandler, DefaultCandidate>::get(h.handler_);
+  }
+
+  static ASIO_AUTO_RETURN_TYPE_PREFIX2(
+      typename Associator<SpliceHandler, DefaultCandidate>::type)
+  get(const detail::splice_op<Source, Sink, SpliceHandler>& h,
+      const DefaultCandidate& c) ASIO_NOEXCEPT
+    ASIO_AUTO_RETURN_TYPE_SUFFIX((
+      Associator<SpliceHandler, DefaultCandidate>::get(h.handler_, c)))
+  {
+    return Associator<SpliceHandler, DefaultCandidate>::get(h.handler_, c);
+  }
+};
+
+#endif // !defined(GENERATING_DOCUMENTATION)
+
+template <typename Source, typename Sink,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      std::size_t)) SpliceToken>
+inline ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(SpliceToken,
+    void (asio::error_code, std::size_t))
+async_splice(Source& source, Sink& sink, std::size_t max_bytes,
+    ASIO_MOVE_ARG(SpliceToken) token)
+  ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+    async_initiate<SpliceToken,
+      void (asio::error_code, std::size_t)>(
+        declval<detail::initiate_async_splice<Source, Sink> >(),
+        token, max_bytes, false)))
+{
+  return async_initiate<SpliceToken,
+    void (asio::error_code, std::size_t)>(
+      detail::initiate_async_splice<Source, Sink>(source, sink),
+      token, max_bytes, false);
+}
+
+template <typename Source, typename Sink,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      std::size_t)) TeeToken>
+inline ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(TeeToken,
+    void (asio::error_code, std::size_t))
+async_tee(Source& source, Sink& sink, std::size_t max_bytes,
+    ASIO_MOVE_ARG(TeeToken) token)
+  ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+    async_initiate<TeeToken,
+      void (asio::error_code, std::size_t)>(
+        declval<detail::initiate_async_splice<Source, Sink> >(),
+        token, max_bytes, true)))
+{
+  return async_initiate<TeeToken,
+    void (asio::error_code, std::size_t)>(
+      detail::initiate_async_splice<Source, Sink>(source, sink),
+      token, max_bytes, true);
+}
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // ASIO_IMPL_SPLICE_HPP
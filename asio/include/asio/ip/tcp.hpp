@@ -125,6 +125,83 @@ public:
     ASIO_OS_DEF(IPPROTO_TCP), ASIO_OS_DEF(TCP_NODELAY)> no_delay;
 #endif
 
+#if defined(ASIO_HAS_TCP_FAST_OPEN) || defined(GENERATING_DOCUMENTATION)
+  /// Socket option to accept connections using TCP Fast Open.
+  /**
+   * Implements the IPPROTO_TCP/TCP_FASTOPEN socket option. When set on an
+   * acceptor to a non-zero value, data carried in the SYN of a new connection
+   * is delivered to the application before the handshake completes. The value
+   * limits the number of such connections that may be pending at once. The
+   * option must be set before the acceptor starts listening.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * asio::ip::tcp::acceptor acceptor(my_context);
+   * ...
+   * asio::ip::tcp::fast_open option(256);
+   * acceptor.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * asio::ip::tcp::acceptor acceptor(my_context);
+   * ...
+   * asio::ip::tcp::fast_open option;
+   * acceptor.get_option(option);
+   * int queue_length = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Integer_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined fast_open;
+#else
+  typedef asio::detail::socket_option::integer<
+    ASIO_OS_DEF(IPPROTO_TCP), ASIO_OS_DEF(TCP_FASTOPEN)> fast_open;
+#endif
+
+  /// Socket option to connect using TCP Fast Open.
+  /**
+   * Implements the IPPROTO_TCP/TCP_FASTOPEN_CONNECT socket option. When
+   * enabled on a socket before it is connected, the connection completes
+   * immediately if a Fast Open cookie for the peer is cached, and the data
+   * from the first send is carried in the SYN. This option is set
+   * automatically by basic_stream_socket::async_connect_and_send.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * asio::ip::tcp::socket socket(my_context);
+   * ...
+   * asio::ip::tcp::fast_open_connect option(true);
+   * socket.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * asio::ip::tcp::socket socket(my_context);
+   * ...
+   * asio::ip::tcp::fast_open_connect option;
+   * socket.get_option(option);
+   * bool is_set = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Boolean_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined fast_open_connect;
+#else
+  typedef asio::detail::socket_option::boolean<
+    ASIO_OS_DEF(IPPROTO_TCP), ASIO_OS_DEF(TCP_FASTOPEN_CONNECT)>
+      fast_open_connect;
+#endif
+#endif // defined(ASIO_HAS_TCP_FAST_OPEN) || defined(GENERATING_DOCUMENTATION)
+
   /// Compare two protocols for equality.
   friend bool operator==(const tcp& p1, const tcp& p2)
   {
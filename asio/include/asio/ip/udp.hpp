@@ -17,6 +17,7 @@
 
 #include "asio/detail/config.hpp"
 #include "asio/basic_datagram_socket.hpp"
+#include "asio/detail/socket_option.hpp"
 #include "asio/detail/socket_types.hpp"
 #include "asio/ip/basic_endpoint.hpp"
 #include "asio/ip/basic_resolver.hpp"
@@ -81,6 +82,82 @@ public:
   /// The UDP resolver type.
   typedef basic_resolver<udp> resolver;
 
+#if defined(ASIO_HAS_UDP_GSO) || defined(GENERATING_DOCUMENTATION)
+  /// Socket option for segmentation offload of outgoing datagrams.
+  /**
+   * Implements the IPPROTO_UDP/UDP_SEGMENT socket option. When set to a
+   * non-zero value, each buffer sent on the socket is split by the kernel or
+   * the network device into datagrams of at most the given size. A segment
+   * size may also be given for an individual message sent with
+   * basic_datagram_socket::send_many.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * asio::ip::udp::socket socket(my_context);
+   * ...
+   * asio::ip::udp::segment_size option(1200);
+   * socket.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * asio::ip::udp::socket socket(my_context);
+   * ...
+   * asio::ip::udp::segment_size option;
+   * socket.get_option(option);
+   * int size = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Integer_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined segment_size;
+#else
+  typedef asio::detail::socket_option::integer<
+    ASIO_OS_DEF(IPPROTO_UDP), ASIO_OS_DEF(UDP_SEGMENT)> segment_size;
+#endif
+
+  /// Socket option for coalescing of incoming datagrams.
+  /**
+   * Implements the IPPROTO_UDP/UDP_GRO socket option. When enabled, datagrams
+   * from the same flow may be delivered as a single buffer. The size of the
+   * segments that make up such a buffer is reported by
+   * basic_datagram_socket::receive_many and
+   * basic_datagram_socket::async_receive_many.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * asio::ip::udp::socket socket(my_context);
+   * ...
+   * asio::ip::udp::receive_offload option(true);
+   * socket.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * asio::ip::udp::socket socket(my_context);
+   * ...
+   * asio::ip::udp::receive_offload option;
+   * socket.get_option(option);
+   * bool is_set = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Boolean_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined receive_offload;
+#else
+  typedef asio::detail::socket_option::boolean<
+    ASIO_OS_DEF(IPPROTO_UDP), ASIO_OS_DEF(UDP_GRO)> receive_offload;
+#endif
+#endif // defined(ASIO_HAS_UDP_GSO) || defined(GENERATING_DOCUMENTATION)
+
   /// Compare two protocols for equality.
   friend bool operator==(const udp& p1, const udp& p2)
   {
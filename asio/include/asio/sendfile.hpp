@@ -0,0 +1,145 @@
+//
+// sendfile.hpp
+// ~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_SENDFILE_HPP
+#define ASIO_SENDFILE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_SENDFILE) \
+  || defined(GENERATING_DOCUMENTATION)
+
+#include <cstddef>
+#include "asio/async_result.hpp"
+#include "asio/error.hpp"
+#include "asio/detail/cstdint.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+template <typename Socket, typename File> class initiate_async_sendfile;
+
+} // namespace detail
+
+/**
+ * @defgroup async_sendfile asio::async_sendfile
+ *
+ * @brief The @c async_sendfile function is a composed asynchronous operation
+ * that writes the contents of a file to a stream socket without copying it
+ * through user memory.
+ */
+/*@{*/
+
+/// Start an asynchronous operation to write part of a file to a stream socket
+/// without copying it through user memory.
+/**
+ * This function is used to asynchronously write @c count bytes of @c file,
+ * starting at @c offset, to @c socket using the @c sendfile system call. It is
+ * an initiating function for an @ref asynchronous_operation, and always
+ * returns immediately. The asynchronous operation will continue until one of
+ * the following conditions is true:
+ *
+ * @li Exactly @c count bytes have been written to the socket.
+ *
+ * @li The end of the file has been reached.
+ *
+ * @li An error occurred.
+ *
+ * Partial transfers are retried until the operation completes. Readiness of
+ * the socket is determined using its @c async_write_some function with
+ * asio::null_buffers, and the socket is placed into non-blocking mode. The
+ * file is read at the given offset, and its current position is not changed.
+ *
+ * This operation is known as a <em>composed operation</em>. The program must
+ * ensure that no other write operations are performed on the socket until
+ * this operation completes.
+ *
+ * @param socket The stream socket to which data is written, such as an
+ * asio::basic_stream_socket.
+ *
+ * @param file The file from which data is read. The type must provide
+ * @c native_handle, such as asio::basic_random_access_file or
+ * asio::basic_stream_file.
+ *
+ * @param offset The position in the file at which to start reading.
+ *
+ * @param count The number of bytes to transfer.
+ *
+ * @param token The @ref completion_token that will be used to produce a
+ * completion handler, which will be called when the operation completes.
+ * Potential completion tokens include @ref use_future, @ref use_awaitable,
+ * @ref yield_context, or a function object with the correct completion
+ * signature. The function signature of the completion handler must be:
+ * @code void handler(
+ *   // Result of operation. Set to asio::error::eof if the
+ *   // end of the file was reached before count bytes were
+ *   // transferred.
+ *   const asio::error_code& error,
+ *
+ *   // Number of bytes written to the socket.
+ *   std::size_t bytes_transferred
+ * ); @endcode
+ * Regardless of whether the asynchronous operation completes immediately or
+ * not, the completion handler will not be invoked from within this function.
+ * On immediate completion, invocation of the handler will be performed in a
+ * manner equivalent to using asio::post().
+ *
+ * @par Completion Signature
+ * @code void(asio::error_code, std::size_t) @endcode
+ *
+ * @par Example
+ * To send the whole of a file:
+ * @code
+ * asio::async_sendfile(socket, file, 0, file.size(), handler);
+ * @endcode
+ *
+ * @par Per-Operation Cancellation
+ * This asynchronous operation supports cancellation for the following
+ * asio::cancellation_type values:
+ *
+ * @li @c cancellation_type::terminal
+ *
+ * if they are also supported by the socket's @c async_write_some operation.
+ */
+template <typename Socket, typename File,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      std::size_t)) WriteToken
+        ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(
+          typename Socket::executor_type)>
+ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(WriteToken,
+    void (asio::error_code, std::size_t))
+async_sendfile(Socket& socket, File& file,
+    uint64_t offset, std::size_t count,
+    ASIO_MOVE_ARG(WriteToken) token
+      ASIO_DEFAULT_COMPLETION_TOKEN(typename Socket::executor_type))
+  ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+    async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        declval<detail::initiate_async_sendfile<Socket, File> >(),
+        token, offset, count)));
+
+/*@}*/
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#include "asio/impl/sendfile.hpp"
+
+#endif // defined(ASIO_HAS_SENDFILE)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_SENDFILE_HPP
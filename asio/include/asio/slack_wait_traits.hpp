@@ -0,0 +1,74 @@
+//
+// slack_wait_traits.hpp
+// ~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_SLACK_WAIT_TRAITS_HPP
+#define ASIO_SLACK_WAIT_TRAITS_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_CHRONO) || defined(GENERATING_DOCUMENTATION)
+
+#include "asio/detail/chrono.hpp"
+#include "asio/wait_traits.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+/// Wait traits that allow timers to complete late so that their wake-ups can
+/// be coalesced.
+/**
+ * Timers that use these traits with the basic_waitable_timer class template
+ * may complete up to one tick of the @c Slack duration type after their
+ * expiry time. They never complete early. The scheduler wakes up at a
+ * multiple of the slack, so that all timers that expire within the same
+ * window complete together, reducing the number of wake-ups for large numbers
+ * of timers that do not need precise expiry, such as idle timeouts and
+ * keepalives.
+ *
+ * Any wait traits class may allow slack in the same way by providing a static
+ * @c timer_slack member function that returns a @c Clock::duration. The slack
+ * is then a property of the timer queue that holds all timers of that type.
+ *
+ * @par Example
+ * @code
+ * typedef asio::basic_waitable_timer<
+ *     asio::chrono::steady_clock,
+ *     asio::slack_wait_traits<
+ *       asio::chrono::steady_clock,
+ *       asio::chrono::seconds>
+ *   > keepalive_timer;
+ * @endcode
+ */
+template <typename Clock, typename Slack>
+struct slack_wait_traits
+  : wait_traits<Clock>
+{
+  /// Get the amount by which a timer may complete after its expiry time.
+  /**
+   * @returns One tick of the @c Slack duration type.
+   */
+  static typename Clock::duration timer_slack()
+  {
+    return chrono::duration_cast<typename Clock::duration>(Slack(1));
+  }
+};
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_CHRONO) || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_SLACK_WAIT_TRAITS_HPP
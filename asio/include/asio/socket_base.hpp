@@ -396,6 +396,201 @@ public:
       reuse_address;
 #endif
 
+#if defined(ASIO_HAS_REUSEPORT_CBPF) || defined(GENERATING_DOCUMENTATION)
+  /// Socket option to allow several sockets to be bound to the same address.
+  /**
+   * Implements the SOL_SOCKET/SO_REUSEPORT socket option. Incoming connections
+   * are distributed across the acceptors that are bound to the address. Use
+   * basic_acceptor_group to choose the acceptor by the receiving CPU.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * asio::ip::tcp::acceptor acceptor(my_context);
+   * ...
+   * asio::socket_base::reuse_port option(true);
+   * acceptor.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * asio::ip::tcp::acceptor acceptor(my_context);
+   * ...
+   * asio::socket_base::reuse_port option;
+   * acceptor.get_option(option);
+   * bool is_set = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Boolean_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined reuse_port;
+#else
+  typedef asio::detail::socket_option::boolean<
+    ASIO_OS_DEF(SOL_SOCKET), ASIO_OS_DEF(SO_REUSEPORT)>
+      reuse_port;
+#endif
+
+  /// Socket option to get the CPU on which a socket's packets are received.
+  /**
+   * Implements the SOL_SOCKET/SO_INCOMING_CPU socket option. The value is the
+   * CPU that most recently processed a packet received on the socket, or -1
+   * if none has been received.
+   *
+   * @par Examples
+   * Getting the current option value:
+   * @code
+   * asio::ip::tcp::socket socket(my_context);
+   * ...
+   * asio::socket_base::incoming_cpu option;
+   * socket.get_option(option);
+   * int cpu = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Integer_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined incoming_cpu;
+#else
+  typedef asio::detail::socket_option::integer<
+    ASIO_OS_DEF(SOL_SOCKET), ASIO_OS_DEF(SO_INCOMING_CPU)>
+      incoming_cpu;
+#endif
+#endif // defined(ASIO_HAS_REUSEPORT_CBPF) || defined(GENERATING_DOCUMENTATION)
+
+#if defined(ASIO_HAS_SO_TIMESTAMPING) || defined(GENERATING_DOCUMENTATION)
+  /// Socket option to report the time at which each datagram was received.
+  /**
+   * Implements the SOL_SOCKET/SO_TIMESTAMPNS socket option. When enabled, the
+   * kernel records a software timestamp, with nanosecond resolution, as each
+   * datagram arrives. The timestamp is returned in datagram_message::timestamp
+   * by basic_datagram_socket::receive_many and
+   * basic_datagram_socket::async_receive_many.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * asio::ip::udp::socket socket(my_context);
+   * ...
+   * asio::socket_base::receive_timestamps option(true);
+   * socket.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * asio::ip::udp::socket socket(my_context);
+   * ...
+   * asio::socket_base::receive_timestamps option;
+   * socket.get_option(option);
+   * bool is_set = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Boolean_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined receive_timestamps;
+#else
+  typedef asio::detail::socket_option::boolean<
+    ASIO_OS_DEF(SOL_SOCKET), ASIO_OS_DEF(SO_TIMESTAMPNS)>
+      receive_timestamps;
+#endif
+
+  /// Bitmask type for the flags that are used with the timestamping option.
+  typedef int timestamping_flags;
+
+#if defined(GENERATING_DOCUMENTATION)
+  /// Generate software timestamps when data leaves the kernel.
+  static const int timestamp_tx_software = implementation_defined;
+
+  /// Generate hardware timestamps when data leaves the network interface.
+  static const int timestamp_tx_hardware = implementation_defined;
+
+  /// Generate software timestamps when data enters the kernel.
+  static const int timestamp_rx_software = implementation_defined;
+
+  /// Generate hardware timestamps when data arrives at the network interface.
+  static const int timestamp_rx_hardware = implementation_defined;
+
+  /// Report any software timestamps that are generated.
+  static const int timestamp_software = implementation_defined;
+
+  /// Report any hardware timestamps that are generated.
+  static const int timestamp_raw_hardware = implementation_defined;
+
+  /// Identify each transmit timestamp by the send that it belongs to.
+  static const int timestamp_opt_id = implementation_defined;
+
+  /// Return transmit timestamps without a copy of the data that was sent.
+  static const int timestamp_opt_tsonly = implementation_defined;
+#else
+  ASIO_STATIC_CONSTANT(int, timestamp_tx_software
+      = ASIO_OS_DEF(SOF_TIMESTAMPING_TX_SOFTWARE));
+  ASIO_STATIC_CONSTANT(int, timestamp_tx_hardware
+      = ASIO_OS_DEF(SOF_TIMESTAMPING_TX_HARDWARE));
+  ASIO_STATIC_CONSTANT(int, timestamp_rx_software
+      = ASIO_OS_DEF(SOF_TIMESTAMPING_RX_SOFTWARE));
+  ASIO_STATIC_CONSTANT(int, timestamp_rx_hardware
+      = ASIO_OS_DEF(SOF_TIMESTAMPING_RX_HARDWARE));
+  ASIO_STATIC_CONSTANT(int, timestamp_software
+      = ASIO_OS_DEF(SOF_TIMESTAMPING_SOFTWARE));
+  ASIO_STATIC_CONSTANT(int, timestamp_raw_hardware
+      = ASIO_OS_DEF(SOF_TIMESTAMPING_RAW_HARDWARE));
+  ASIO_STATIC_CONSTANT(int, timestamp_opt_id
+      = ASIO_OS_DEF(SOF_TIMESTAMPING_OPT_ID));
+  ASIO_STATIC_CONSTANT(int, timestamp_opt_tsonly
+      = ASIO_OS_DEF(SOF_TIMESTAMPING_OPT_TSONLY));
+#endif
+
+  /// Socket option to select the timestamps generated and reported for data.
+  /**
+   * Implements the SOL_SOCKET/SO_TIMESTAMPING socket option. The value is a
+   * bitwise combination of the timestamping_flags constants. Receive
+   * timestamps are returned in datagram_message::timestamp and
+   * datagram_message::hardware_timestamp. Transmit timestamps are queued on
+   * the socket's error queue and are read using
+   * basic_socket::receive_send_timestamp.
+   *
+   * @par Examples
+   * Setting the option:
+   * @code
+   * asio::ip::udp::socket socket(my_context);
+   * ...
+   * asio::socket_base::timestamping option(
+   *     asio::socket_base::timestamp_rx_software
+   *     | asio::socket_base::timestamp_tx_software
+   *     | asio::socket_base::timestamp_software
+   *     | asio::socket_base::timestamp_opt_id
+   *     | asio::socket_base::timestamp_opt_tsonly);
+   * socket.set_option(option);
+   * @endcode
+   *
+   * @par
+   * Getting the current option value:
+   * @code
+   * asio::ip::udp::socket socket(my_context);
+   * ...
+   * asio::socket_base::timestamping option;
+   * socket.get_option(option);
+   * int flags = option.value();
+   * @endcode
+   *
+   * @par Concepts:
+   * Socket_Option, Integer_Socket_Option.
+   */
+#if defined(GENERATING_DOCUMENTATION)
+  typedef implementation_defined timestamping;
+#else
+  typedef asio::detail::socket_option::integer<
+    ASIO_OS_DEF(SOL_SOCKET), ASIO_OS_DEF(SO_TIMESTAMPING)>
+      timestamping;
+#endif
+#endif // defined(ASIO_HAS_SO_TIMESTAMPING) || defined(GENERATING_DOCUMENTATION)
+
   /// Socket option to specify whether the socket lingers on close if unsent
   /// data is present.
   /**
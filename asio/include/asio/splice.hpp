@@ -0,0 +1,230 @@
+//
+// splice.hpp
+// ~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_SPLICE_HPP
+#define ASIO_SPLICE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_SPLICE) \
+  || defined(GENERATING_DOCUMENTATION)
+
+#include <cstddef>
+#include "asio/async_result.hpp"
+#include "asio/error.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+template <typename Source, typename Sink> class initiate_async_splice;
+
+} // namespace detail
+
+/**
+ * @defgroup async_splice asio::async_splice
+ *
+ * @brief The @c async_splice function is a composed asynchronous operation
+ * that moves data from one descriptor-based I/O object to another without
+ * copying it through user memory.
+ */
+/*@{*/
+
+/// Start an asynchronous operation to move data between two I/O objects
+/// without copying it through user memory.
+/**
+ * This function is used to asynchronously move up to @c max_bytes bytes of
+ * data from @c source to @c sink using the @c splice system call. It is an
+ * initiating function for an @ref asynchronous_operation, and always returns
+ * immediately. The asynchronous operation will continue until one of the
+ * following conditions is true:
+ *
+ * @li Exactly @c max_bytes bytes have been written to the sink.
+ *
+ * @li The end of the source has been reached and all data read from it has
+ * been written to the sink.
+ *
+ * @li An error occurred.
+ *
+ * When neither object refers to a pipe, the data is moved through a pipe that
+ * is owned by the operation. Readiness of the source and sink is determined
+ * using their @c async_read_some and @c async_write_some functions with
+ * asio::null_buffers, and the descriptors are placed into non-blocking mode.
+ * Objects that provide @c native_non_blocking, such as sockets, are switched
+ * using that function. For other objects, such as pipes and files, the
+ * descriptor's original mode is restored when the operation completes.
+ *
+ * If the operation is cancelled or fails while data read from the source is
+ * held in the operation's pipe, that data is written to the sink as far as
+ * is possible without blocking, and the remainder is discarded. Discarded
+ * data is not included in the number of bytes transferred.
+ *
+ * This operation is known as a <em>composed operation</em>. The program must
+ * ensure that no other read operations are performed on the source, and no
+ * other write operations are performed on the sink, until this operation
+ * completes.
+ *
+ * @param source The object from which data is read. The type must provide
+ * @c native_handle, @c get_executor and @c async_read_some, such as
+ * asio::basic_stream_socket, asio::basic_readable_pipe,
+ * asio::posix::basic_stream_descriptor or asio::basic_stream_file.
+ *
+ * @param sink The object to which data is written. The type must provide
+ * @c native_handle and @c async_write_some, such as
+ * asio::basic_stream_socket, asio::basic_writable_pipe,
+ * asio::posix::basic_stream_descriptor or asio::basic_stream_file.
+ *
+ * @param max_bytes The maximum number of bytes to transfer.
+ *
+ * @param token The @ref completion_token that will be used to produce a
+ * completion handler, which will be called when the operation completes.
+ * Potential completion tokens include @ref use_future, @ref use_awaitable,
+ * @ref yield_context, or a function object with the correct completion
+ * signature. The function signature of the completion handler must be:
+ * @code void handler(
+ *   // Result of operation. Set to asio::error::eof if the
+ *   // end of the source was reached before max_bytes bytes
+ *   // were transferred.
+ *   const asio::error_code& error,
+ *
+ *   // Number of bytes written to the sink.
+ *   std::size_t bytes_transferred
+ * ); @endcode
+ * Regardless of whether the asynchronous operation completes immediately or
+ * not, the completion handler will not be invoked from within this function.
+ * On immediate completion, invocation of the handler will be performed in a
+ * manner equivalent to using asio::post().
+ *
+ * @par Completion Signature
+ * @code void(asio::error_code, std::size_t) @endcode
+ *
+ * @par Example
+ * To relay all data from one socket to another:
+ * @code
+ * asio::async_splice(client_socket, server_socket,
+ *     std::numeric_limits<std::size_t>::max(), handler);
+ * @endcode
+ *
+ * @par Per-Operation Cancellation
+ * This asynchronous operation supports cancellation for the following
+ * asio::cancellation_type values:
+ *
+ * @li @c cancellation_type::terminal
+ *
+ * if they are also supported by the source's @c async_read_some and the
+ * sink's @c async_write_some operations. Data that has been read from the
+ * source but not yet written to the sink is discarded on cancellation.
+ */
+template <typename Source, typename Sink,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      std::size_t)) SpliceToken
+        ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(
+          typename Source::executor_type)>
+ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(SpliceToken,
+    void (asio::error_code, std::size_t))
+async_splice(Source& source, Sink& sink, std::size_t max_bytes,
+    ASIO_MOVE_ARG(SpliceToken) token
+      ASIO_DEFAULT_COMPLETION_TOKEN(typename Source::executor_type))
+  ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+    async_initiate<SpliceToken,
+      void (asio::error_code, std::size_t)>(
+        declval<detail::initiate_async_splice<Source, Sink> >(),
+        token, max_bytes, false)));
+
+/*@}*/
+/**
+ * @defgroup async_tee asio::async_tee
+ *
+ * @brief The @c async_tee function duplicates data between two pipes without
+ * consuming it.
+ */
+/*@{*/
+
+/// Start an asynchronous operation to duplicate data from one pipe to another
+/// without consuming it.
+/**
+ * This function is used to asynchronously copy up to @c max_bytes bytes of
+ * the data that is available in the @c source pipe to the @c sink pipe using
+ * the @c tee system call. The data remains available for reading from the
+ * source, for example by a subsequent call to asio::async_splice. It is an
+ * initiating function for an @ref asynchronous_operation, and always returns
+ * immediately. The operation completes as soon as some data has been
+ * duplicated, or an error occurs.
+ *
+ * @param source The pipe from which data is duplicated, such as an
+ * asio::basic_readable_pipe.
+ *
+ * @param sink The pipe to which data is written, such as an
+ * asio::basic_writable_pipe.
+ *
+ * @param max_bytes The maximum number of bytes to duplicate.
+ *
+ * @param token The @ref completion_token that will be used to produce a
+ * completion handler, which will be called when the operation completes.
+ * Potential completion tokens include @ref use_future, @ref use_awaitable,
+ * @ref yield_context, or a function object with the correct completion
+ * signature. The function signature of the completion handler must be:
+ * @code void handler(
+ *   // Result of operation.
+ *   const asio::error_code& error,
+ *
+ *   // Number of bytes duplicated.
+ *   std::size_t bytes_transferred
+ * ); @endcode
+ * Regardless of whether the asynchronous operation completes immediately or
+ * not, the completion handler will not be invoked from within this function.
+ * On immediate completion, invocation of the handler will be performed in a
+ * manner equivalent to using asio::post().
+ *
+ * @par Completion Signature
+ * @code void(asio::error_code, std::size_t) @endcode
+ *
+ * @par Per-Operation Cancellation
+ * This asynchronous operation supports cancellation for the following
+ * asio::cancellation_type values:
+ *
+ * @li @c cancellation_type::terminal
+ *
+ * if they are also supported by the source's @c async_read_some and the
+ * sink's @c async_write_some operations.
+ */
+template <typename Source, typename Sink,
+    ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+      std::size_t)) TeeToken
+        ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(
+          typename Source::executor_type)>
+ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(TeeToken,
+    void (asio::error_code, std::size_t))
+async_tee(Source& source, Sink& sink, std::size_t max_bytes,
+    ASIO_MOVE_ARG(TeeToken) token
+      ASIO_DEFAULT_COMPLETION_TOKEN(typename Source::executor_type))
+  ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+    async_initiate<TeeToken,
+      void (asio::error_code, std::size_t)>(
+        declval<detail::initiate_async_splice<Source, Sink> >(),
+        token, max_bytes, true)));
+
+/*@}*/
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#include "asio/impl/splice.hpp"
+
+#endif // defined(ASIO_HAS_SPLICE)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_SPLICE_HPP
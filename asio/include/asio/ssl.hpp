@@ -17,6 +17,7 @@
 
 #include "asio/ssl/context.hpp"
 #include "asio/ssl/context_base.hpp"
+#include "asio/ssl/datagram_stream.hpp"
 #include "asio/ssl/error.hpp"
 #include "asio/ssl/rfc2818_verification.hpp"
 #include "asio/ssl/host_name_verification.hpp"
@@ -711,6 +711,142 @@ public:
   ASIO_SYNC_OP_VOID set_password_callback(PasswordCallback callback,
       asio::error_code& ec);
 
+#if defined(ASIO_HAS_SSL_SESSION_CACHE) \
+  || defined(GENERATING_DOCUMENTATION)
+  /// Enable the client session cache.
+  /**
+   * This function makes clients that use the context keep the sessions they
+   * establish, so that handshakes on later connections to the same host or
+   * endpoint resume a session rather than performing a full handshake. The
+   * sessions of a stream are cached under the key set with
+   * ssl::stream::set_session_cache_key(), or otherwise under the server name
+   * that the stream sends in its handshake. Streams with neither do not use
+   * the cache.
+   *
+   * @param max_entries The maximum number of hosts or endpoints for which
+   * sessions are kept. The least recently used are discarded first.
+   *
+   * @throws asio::system_error Thrown on failure.
+   *
+   * @note Calls @c SSL_CTX_set_session_cache_mode and
+   * @c SSL_CTX_sess_set_new_cb. A context that is also used by servers keeps
+   * its server-side session cache. With TLS 1.3, sessions are sent by the
+   * server after the handshake, and are only received once data has been read
+   * from the stream.
+   */
+  ASIO_DECL void enable_session_cache(std::size_t max_entries);
+
+  /// Enable the client session cache.
+  /**
+   * This function makes clients that use the context keep the sessions they
+   * establish, so that handshakes on later connections to the same host or
+   * endpoint resume a session rather than performing a full handshake. The
+   * sessions of a stream are cached under the key set with
+   * ssl::stream::set_session_cache_key(), or otherwise under the server name
+   * that the stream sends in its handshake. Streams with neither do not use
+   * the cache.
+   *
+   * @param max_entries The maximum number of hosts or endpoints for which
+   * sessions are kept. The least recently used are discarded first.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @note Calls @c SSL_CTX_set_session_cache_mode and
+   * @c SSL_CTX_sess_set_new_cb. A context that is also used by servers keeps
+   * its server-side session cache. With TLS 1.3, sessions are sent by the
+   * server after the handshake, and are only received once data has been read
+   * from the stream.
+   */
+  ASIO_DECL ASIO_SYNC_OP_VOID enable_session_cache(
+      std::size_t max_entries, asio::error_code& ec);
+
+  /// Rotate the key used to encrypt session tickets to a new random key.
+  /**
+   * This function is used by servers to start encrypting session tickets with
+   * a newly generated key. Tickets that were encrypted with the previous key
+   * are still accepted, and are replaced with tickets encrypted with the new
+   * key. Older tickets are rejected, so that clients presenting them perform
+   * a full handshake.
+   *
+   * @throws asio::system_error Thrown on failure.
+   *
+   * @note Calls @c SSL_CTX_set_tlsext_ticket_key_evp_cb, or
+   * @c SSL_CTX_set_tlsext_ticket_key_cb before OpenSSL 3.0.
+   */
+  ASIO_DECL void rotate_session_ticket_key();
+
+  /// Rotate the key used to encrypt session tickets to a new random key.
+  /**
+   * This function is used by servers to start encrypting session tickets with
+   * a newly generated key. Tickets that were encrypted with the previous key
+   * are still accepted, and are replaced with tickets encrypted with the new
+   * key. Older tickets are rejected, so that clients presenting them perform
+   * a full handshake.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @note Calls @c SSL_CTX_set_tlsext_ticket_key_evp_cb, or
+   * @c SSL_CTX_set_tlsext_ticket_key_cb before OpenSSL 3.0.
+   */
+  ASIO_DECL ASIO_SYNC_OP_VOID rotate_session_ticket_key(
+      asio::error_code& ec);
+
+  /// Rotate the key used to encrypt session tickets to the specified key.
+  /**
+   * This function is used by servers to start encrypting session tickets with
+   * the specified key, such as a key that is shared by a group of servers so
+   * that any of them can resume a session. Tickets that were encrypted with
+   * the previous key are still accepted, and are replaced with tickets
+   * encrypted with the new key. Older tickets are rejected, so that clients
+   * presenting them perform a full handshake.
+   *
+   * @param key A buffer containing the key, which must be 80 bytes: a 16 byte
+   * key name, a 32 byte HMAC-SHA256 key, and a 32 byte AES-256 key.
+   *
+   * @throws asio::system_error Thrown on failure.
+   *
+   * @note Calls @c SSL_CTX_set_tlsext_ticket_key_evp_cb, or
+   * @c SSL_CTX_set_tlsext_ticket_key_cb before OpenSSL 3.0.
+   */
+  ASIO_DECL void rotate_session_ticket_key(const const_buffer& key);
+
+  /// Rotate the key used to encrypt session tickets to the specified key.
+  /**
+   * This function is used by servers to start encrypting session tickets with
+   * the specified key, such as a key that is shared by a group of servers so
+   * that any of them can resume a session. Tickets that were encrypted with
+   * the previous key are still accepted, and are replaced with tickets
+   * encrypted with the new key. Older tickets are rejected, so that clients
+   * presenting them perform a full handshake.
+   *
+   * @param key A buffer containing the key, which must be 80 bytes: a 16 byte
+   * key name, a 32 byte HMAC-SHA256 key, and a 32 byte AES-256 key.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @note Calls @c SSL_CTX_set_tlsext_ticket_key_evp_cb, or
+   * @c SSL_CTX_set_tlsext_ticket_key_cb before OpenSSL 3.0.
+   */
+  ASIO_DECL ASIO_SYNC_OP_VOID rotate_session_ticket_key(
+      const const_buffer& key, asio::error_code& ec);
+
+  /// Get the number of client handshakes that resumed a cached session.
+  ASIO_DECL std::size_t session_cache_hits() const;
+
+  /// Get the number of client handshakes that used the session cache but
+  /// performed a full handshake.
+  ASIO_DECL std::size_t session_cache_misses() const;
+
+  /// Get the number of session tickets accepted by servers that were
+  /// encrypted with the current or previous key.
+  ASIO_DECL std::size_t session_ticket_hits() const;
+
+  /// Get the number of session tickets rejected by servers because they were
+  /// encrypted with an unknown key.
+  ASIO_DECL std::size_t session_ticket_misses() const;
+#endif // defined(ASIO_HAS_SSL_SESSION_CACHE)
+       //   || defined(GENERATING_DOCUMENTATION)
+
 private:
   struct bio_cleanup;
   struct x509_cleanup;
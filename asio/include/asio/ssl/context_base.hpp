@@ -101,7 +101,25 @@ public:
     tls_client,
 
     /// TLS server.
-    tls_server
+    tls_server,
+
+    /// Generic DTLS.
+    dtls,
+
+    /// DTLS client.
+    dtls_client,
+
+    /// DTLS server.
+    dtls_server,
+
+    /// Generic DTLS version 1.2.
+    dtlsv12,
+
+    /// DTLS version 1.2 client.
+    dtlsv12_client,
+
+    /// DTLS version 1.2 server.
+    dtlsv12_server
   };
 
   /// Bitmask type for SSL options.
@@ -0,0 +1,912 @@
+//
+// ssl/datagram_stream.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_SSL_DATAGRAM_STREAM_HPP
+#define ASIO_SSL_DATAGRAM_STREAM_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include "asio/ssl/detail/openssl_types.hpp"
+
+#if defined(ASIO_HAS_SSL_DTLS) || defined(GENERATING_DOCUMENTATION)
+
+#include "asio/async_result.hpp"
+#include "asio/detail/handler_type_requirements.hpp"
+#include "asio/detail/non_const_lvalue.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/ssl/context.hpp"
+#include "asio/ssl/detail/datagram_transport.hpp"
+#include "asio/ssl/detail/handshake_op.hpp"
+#include "asio/ssl/detail/io.hpp"
+#include "asio/ssl/detail/read_op.hpp"
+#include "asio/ssl/detail/shutdown_op.hpp"
+#include "asio/ssl/detail/stream_core.hpp"
+#include "asio/ssl/detail/write_op.hpp"
+#include "asio/ssl/stream_base.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace ssl {
+
+/// Provides datagram-oriented functionality using DTLS.
+/**
+ * The datagram_stream class template provides asynchronous and blocking
+ * datagram-oriented functionality using DTLS. Each send transmits a single
+ * record, and each receive returns the data of a single record.
+ *
+ * The next layer must be a datagram socket that is connected to the peer, so
+ * that every datagram it receives belongs to the session. While a handshake
+ * is in progress, its messages are retransmitted on a timer if no reply is
+ * received.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe. The application must also ensure that all
+ * asynchronous operations are performed within the same implicit or explicit
+ * strand.
+ *
+ * @par Example
+ * To use the datagram_stream template with an ip::udp::socket, you would
+ * write:
+ * @code
+ * asio::io_context my_context;
+ * asio::ssl::context ctx(asio::ssl::context::dtls_client);
+ * asio::ssl::datagram_stream<asio:ip::udp::socket> sock(my_context, ctx);
+ * sock.next_layer().connect(peer_endpoint);
+ * sock.handshake(asio::ssl::stream_base::client);
+ * @endcode
+ */
+template <typename DatagramSocket>
+class datagram_stream :
+  public stream_base,
+  private noncopyable
+{
+private:
+  class initiate_async_handshake;
+  class initiate_async_shutdown;
+  class initiate_async_send;
+  class initiate_async_receive;
+
+public:
+  /// The native handle type of the DTLS stream.
+  typedef SSL* native_handle_type;
+
+  /// The type of the next layer.
+  typedef typename remove_reference<DatagramSocket>::type next_layer_type;
+
+  /// The type of the lowest layer.
+  typedef typename next_layer_type::lowest_layer_type lowest_layer_type;
+
+  /// The type of the executor associated with the object.
+  typedef typename lowest_layer_type::executor_type executor_type;
+
+#if defined(ASIO_HAS_MOVE) || defined(GENERATING_DOCUMENTATION)
+  /// Construct a datagram stream.
+  /**
+   * This constructor creates a datagram stream and initialises the underlying
+   * socket object.
+   *
+   * @param arg The argument to be passed to initialise the underlying socket.
+   *
+   * @param ctx The SSL context to be used for the stream. It must have been
+   * created for one of the DTLS methods.
+   */
+  template <typename Arg>
+  datagram_stream(Arg&& arg, context& ctx)
+    : next_layer_(ASIO_MOVE_CAST(Arg)(arg)),
+      core_(ctx.native_handle(), next_layer_.lowest_layer().get_executor()),
+      transport_(next_layer_, core_.engine_)
+  {
+  }
+#else // defined(ASIO_HAS_MOVE) || defined(GENERATING_DOCUMENTATION)
+  template <typename Arg>
+  datagram_stream(Arg& arg, context& ctx)
+    : next_layer_(arg),
+      core_(ctx.native_handle(), next_layer_.lowest_layer().get_executor()),
+      transport_(next_layer_, core_.engine_)
+  {
+  }
+#endif // defined(ASIO_HAS_MOVE) || defined(GENERATING_DOCUMENTATION)
+
+  /// Destructor.
+  /**
+   * @note A @c datagram_stream object must not be destroyed while there are
+   * pending asynchronous operations associated with it.
+   */
+  ~datagram_stream()
+  {
+  }
+
+  /// Get the executor associated with the object.
+  /**
+   * This function may be used to obtain the executor object that the stream
+   * uses to dispatch handlers for asynchronous operations.
+   *
+   * @return A copy of the executor that stream will use to dispatch handlers.
+   */
+  executor_type get_executor() ASIO_NOEXCEPT
+  {
+    return next_layer_.lowest_layer().get_executor();
+  }
+
+  /// Get the underlying implementation in the native type.
+  /**
+   * This function may be used to obtain the underlying implementation of the
+   * context. This is intended to allow access to context functionality that is
+   * not otherwise provided.
+   */
+  native_handle_type native_handle()
+  {
+    return core_.engine_.native_handle();
+  }
+
+  /// Get a reference to the next layer.
+  /**
+   * This function returns a reference to the next layer in a stack of
+   * layers.
+   *
+   * @return A reference to the next layer in the stack of layers. Ownership
+   * is not transferred to the caller.
+   */
+  const next_layer_type& next_layer() const
+  {
+    return next_layer_;
+  }
+
+  /// Get a reference to the next layer.
+  /**
+   * This function returns a reference to the next layer in a stack of
+   * layers.
+   *
+   * @return A reference to the next layer in the stack of layers. Ownership
+   * is not transferred to the caller.
+   */
+  next_layer_type& next_layer()
+  {
+    return next_layer_;
+  }
+
+  /// Get a reference to the lowest layer.
+  /**
+   * This function returns a reference to the lowest layer in a stack of
+   * layers.
+   *
+   * @return A reference to the lowest layer in the stack of layers. Ownership
+   * is not transferred to the caller.
+   */
+  lowest_layer_type& lowest_layer()
+  {
+    return next_layer_.lowest_layer();
+  }
+
+  /// Get a reference to the lowest layer.
+  /**
+   * This function returns a reference to the lowest layer in a stack of
+   * layers.
+   *
+   * @return A reference to the lowest layer in the stack of layers. Ownership
+   * is not transferred to the caller.
+   */
+  const lowest_layer_type& lowest_layer() const
+  {
+    return next_layer_.lowest_layer();
+  }
+
+  /// Set the peer verification mode.
+  /**
+   * This function may be used to configure the peer verification mode used by
+   * the stream. The new mode will override the mode inherited from the context.
+   *
+   * @param v A bitmask of peer verification modes. See @ref verify_mode for
+   * available values.
+   *
+   * @throws asio::system_error Thrown on failure.
+   *
+   * @note Calls @c SSL_set_verify.
+   */
+  void set_verify_mode(verify_mode v)
+  {
+    asio::error_code ec;
+    set_verify_mode(v, ec);
+    asio::detail::throw_error(ec, "set_verify_mode");
+  }
+
+  /// Set the peer verification mode.
+  /**
+   * This function may be used to configure the peer verification mode used by
+   * the stream. The new mode will override the mode inherited from the context.
+   *
+   * @param v A bitmask of peer verification modes. See @ref verify_mode for
+   * available values.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @note Calls @c SSL_set_verify.
+   */
+  ASIO_SYNC_OP_VOID set_verify_mode(
+      verify_mode v, asio::error_code& ec)
+  {
+    core_.engine_.set_verify_mode(v, ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Set the peer verification depth.
+  /**
+   * This function may be used to configure the maximum verification depth
+   * allowed by the stream.
+   *
+   * @param depth Maximum depth for the certificate chain verification that
+   * shall be allowed.
+   *
+   * @throws asio::system_error Thrown on failure.
+   *
+   * @note Calls @c SSL_set_verify_depth.
+   */
+  void set_verify_depth(int depth)
+  {
+    asio::error_code ec;
+    set_verify_depth(depth, ec);
+    asio::detail::throw_error(ec, "set_verify_depth");
+  }
+
+  /// Set the peer verification depth.
+  /**
+   * This function may be used to configure the maximum verification depth
+   * allowed by the stream.
+   *
+   * @param depth Maximum depth for the certificate chain verification that
+   * shall be allowed.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @note Calls @c SSL_set_verify_depth.
+   */
+  ASIO_SYNC_OP_VOID set_verify_depth(
+      int depth, asio::error_code& ec)
+  {
+    core_.engine_.set_verify_depth(depth, ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Set the callback used to verify peer certificates.
+  /**
+   * This function is used to specify a callback function that will be called
+   * by the implementation when it needs to verify a peer certificate.
+   *
+   * @param callback The function object to be used for verifying a certificate.
+   * The function signature of the handler must be:
+   * @code bool verify_callback(
+   *   bool preverified, // True if the certificate passed pre-verification.
+   *   verify_context& ctx // The peer certificate and other context.
+   * ); @endcode
+   * The return value of the callback is true if the certificate has passed
+   * verification, false otherwise.
+   *
+   * @throws asio::system_error Thrown on failure.
+   *
+   * @note Calls @c SSL_set_verify.
+   */
+  template <typename VerifyCallback>
+  void set_verify_callback(VerifyCallback callback)
+  {
+    asio::error_code ec;
+    this->set_verify_callback(callback, ec);
+    asio::detail::throw_error(ec, "set_verify_callback");
+  }
+
+  /// Set the callback used to verify peer certificates.
+  /**
+   * This function is used to specify a callback function that will be called
+   * by the implementation when it needs to verify a peer certificate.
+   *
+   * @param callback The function object to be used for verifying a certificate.
+   * The function signature of the handler must be:
+   * @code bool verify_callback(
+   *   bool preverified, // True if the certificate passed pre-verification.
+   *   verify_context& ctx // The peer certificate and other context.
+   * ); @endcode
+   * The return value of the callback is true if the certificate has passed
+   * verification, false otherwise.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @note Calls @c SSL_set_verify.
+   */
+  template <typename VerifyCallback>
+  ASIO_SYNC_OP_VOID set_verify_callback(VerifyCallback callback,
+      asio::error_code& ec)
+  {
+    core_.engine_.set_verify_callback(
+        new detail::verify_callback<VerifyCallback>(callback), ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Set the maximum size of the datagrams sent to the peer.
+  /**
+   * This function may be used to limit the size of the datagrams sent by the
+   * stream, such as to the path MTU less the IP and UDP headers. Handshake
+   * messages are fragmented to fit. By default, datagrams are limited to 1452
+   * bytes.
+   *
+   * @param mtu The maximum size of a datagram.
+   *
+   * @throws asio::system_error Thrown on failure.
+   *
+   * @note Calls @c SSL_set_mtu.
+   */
+  void set_mtu(std::size_t mtu)
+  {
+    asio::error_code ec;
+    set_mtu(mtu, ec);
+    asio::detail::throw_error(ec, "set_mtu");
+  }
+
+  /// Set the maximum size of the datagrams sent to the peer.
+  /**
+   * This function may be used to limit the size of the datagrams sent by the
+   * stream, such as to the path MTU less the IP and UDP headers. Handshake
+   * messages are fragmented to fit. By default, datagrams are limited to 1452
+   * bytes.
+   *
+   * @param mtu The maximum size of a datagram.
+   *
+   * @param ec Set to indicate what error occurred, if any. Sizes too small for
+   * the SSL implementation fail with asio::error::invalid_argument.
+   *
+   * @note Calls @c SSL_set_mtu.
+   */
+  ASIO_SYNC_OP_VOID set_mtu(std::size_t mtu, asio::error_code& ec)
+  {
+    core_.engine_.set_mtu(mtu, ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Perform DTLS handshaking.
+  /**
+   * This function is used to perform DTLS handshaking on the stream. The
+   * function call will block until handshaking is complete or an error occurs.
+   * Messages that are not acknowledged by the peer are retransmitted, with
+   * the interval doubling each time, until the SSL implementation gives up.
+   *
+   * @param type The type of handshaking to be performed, i.e. as a client or as
+   * a server.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  void handshake(handshake_type type)
+  {
+    asio::error_code ec;
+    handshake(type, ec);
+    asio::detail::throw_error(ec, "handshake");
+  }
+
+  /// Perform DTLS handshaking.
+  /**
+   * This function is used to perform DTLS handshaking on the stream. The
+   * function call will block until handshaking is complete or an error occurs.
+   * Messages that are not acknowledged by the peer are retransmitted, with
+   * the interval doubling each time, until the SSL implementation gives up.
+   *
+   * @param type The type of handshaking to be performed, i.e. as a client or as
+   * a server.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   */
+  ASIO_SYNC_OP_VOID handshake(handshake_type type,
+      asio::error_code& ec)
+  {
+    detail::io(transport_, core_, detail::handshake_op(type), ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Start an asynchronous DTLS handshake.
+  /**
+   * This function is used to asynchronously perform a DTLS handshake on the
+   * stream. It is an initiating function for an @ref asynchronous_operation,
+   * and always returns immediately. Messages that are not acknowledged by the
+   * peer are retransmitted using a timer on the stream's executor.
+   *
+   * @param type The type of handshaking to be performed, i.e. as a client or as
+   * a server.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the handshake completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error // Result of operation.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * if they are also supported by the @c DatagramSocket type's
+   * @c async_receive and @c async_send operations.
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code))
+        HandshakeToken
+          ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(HandshakeToken,
+      void (asio::error_code))
+  async_handshake(handshake_type type,
+      ASIO_MOVE_ARG(HandshakeToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<HandshakeToken,
+        void (asio::error_code)>(
+          declval<initiate_async_handshake>(), token, type)))
+  {
+    return async_initiate<HandshakeToken,
+      void (asio::error_code)>(
+        initiate_async_handshake(this), token, type);
+  }
+
+  /// Shut down DTLS on the stream.
+  /**
+   * This function is used to shut down DTLS on the stream by sending a
+   * close_notify alert to the peer. The function call will block until the
+   * alert has been sent or an error occurs. It does not wait for the peer's
+   * close_notify, which may be lost.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  void shutdown()
+  {
+    asio::error_code ec;
+    shutdown(ec);
+    asio::detail::throw_error(ec, "shutdown");
+  }
+
+  /// Shut down DTLS on the stream.
+  /**
+   * This function is used to shut down DTLS on the stream by sending a
+   * close_notify alert to the peer. The function call will block until the
+   * alert has been sent or an error occurs. It does not wait for the peer's
+   * close_notify, which may be lost.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   */
+  ASIO_SYNC_OP_VOID shutdown(asio::error_code& ec)
+  {
+    detail::io(transport_, core_, detail::shutdown_op(), ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Asynchronously shut down DTLS on the stream.
+  /**
+   * This function is used to asynchronously shut down DTLS on the stream by
+   * sending a close_notify alert to the peer. It is an initiating function for
+   * an @ref asynchronous_operation, and always returns immediately. The
+   * operation completes once the alert has been sent.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the shutdown completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error // Result of operation.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * if they are also supported by the @c DatagramSocket type's
+   * @c async_send operation.
+   */
+  template <
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code))
+        ShutdownToken
+          ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(ShutdownToken,
+      void (asio::error_code))
+  async_shutdown(
+      ASIO_MOVE_ARG(ShutdownToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<ShutdownToken,
+        void (asio::error_code)>(
+          declval<initiate_async_shutdown>(), token)))
+  {
+    return async_initiate<ShutdownToken,
+      void (asio::error_code)>(
+        initiate_async_shutdown(this), token);
+  }
+
+  /// Send a record to the peer.
+  /**
+   * This function is used to send data to the peer as a single record. The
+   * function call will block until the record has been sent successfully, or
+   * until an error occurs.
+   *
+   * @param buffers The data to be sent. The data of the first non-empty buffer
+   * is sent, and must be no larger than the maximum record size of 16384
+   * bytes. It should also fit within the datagram size set using set_mtu().
+   *
+   * @returns The number of bytes sent.
+   *
+   * @throws asio::system_error Thrown on failure.
+   */
+  template <typename ConstBufferSequence>
+  std::size_t send(const ConstBufferSequence& buffers)
+  {
+    asio::error_code ec;
+    std::size_t n = send(buffers, ec);
+    asio::detail::throw_error(ec, "send");
+    return n;
+  }
+
+  /// Send a record to the peer.
+  /**
+   * This function is used to send data to the peer as a single record. The
+   * function call will block until the record has been sent successfully, or
+   * until an error occurs.
+   *
+   * @param buffers The data to be sent. The data of the first non-empty buffer
+   * is sent, and must be no larger than the maximum record size of 16384
+   * bytes. It should also fit within the datagram size set using set_mtu().
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @returns The number of bytes sent. Returns 0 if an error occurred.
+   */
+  template <typename ConstBufferSequence>
+  std::size_t send(const ConstBufferSequence& buffers,
+      asio::error_code& ec)
+  {
+    return detail::io(transport_, core_,
+        detail::write_op<ConstBufferSequence>(
+          buffers, core_.write_buffer_space_), ec);
+  }
+
+  /// Start an asynchronous send.
+  /**
+   * This function is used to asynchronously send data to the peer as a single
+   * record. It is an initiating function for an @ref asynchronous_operation,
+   * and always returns immediately.
+   *
+   * @param buffers The data to be sent. The data of the first non-empty buffer
+   * is sent, and must be no larger than the maximum record size of 16384
+   * bytes. Although the buffers object may be copied as necessary, ownership
+   * of the underlying buffers is retained by the caller, which must guarantee
+   * that they remain valid until the completion handler is called.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the send completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes sent.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * if they are also supported by the @c DatagramSocket type's
+   * @c async_receive and @c async_send operations.
+   */
+  template <typename ConstBufferSequence,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) WriteToken
+          ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(WriteToken,
+      void (asio::error_code, std::size_t))
+  async_send(const ConstBufferSequence& buffers,
+      ASIO_MOVE_ARG(WriteToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<WriteToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_send>(), token, buffers)))
+  {
+    return async_initiate<WriteToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_send(this), token, buffers);
+  }
+
+  /// Receive a record from the peer.
+  /**
+   * This function is used to receive the data of a single record from the
+   * peer. The function call will block until a record has been received
+   * successfully, or until an error occurs. Datagrams that fail to decrypt are
+   * discarded.
+   *
+   * @param buffers The buffers into which the data will be received. The data
+   * is received into the first non-empty buffer. If it is smaller than the
+   * record, the remainder is returned by the next receive.
+   *
+   * @returns The number of bytes received.
+   *
+   * @throws asio::system_error Thrown on failure. An error code of
+   * asio::error::eof indicates that the peer has shut down the session.
+   */
+  template <typename MutableBufferSequence>
+  std::size_t receive(const MutableBufferSequence& buffers)
+  {
+    asio::error_code ec;
+    std::size_t n = receive(buffers, ec);
+    asio::detail::throw_error(ec, "receive");
+    return n;
+  }
+
+  /// Receive a record from the peer.
+  /**
+   * This function is used to receive the data of a single record from the
+   * peer. The function call will block until a record has been received
+   * successfully, or until an error occurs. Datagrams that fail to decrypt are
+   * discarded.
+   *
+   * @param buffers The buffers into which the data will be received. The data
+   * is received into the first non-empty buffer. If it is smaller than the
+   * record, the remainder is returned by the next receive.
+   *
+   * @param ec Set to indicate what error occurred, if any. An error code of
+   * asio::error::eof indicates that the peer has shut down the session.
+   *
+   * @returns The number of bytes received. Returns 0 if an error occurred.
+   */
+  template <typename MutableBufferSequence>
+  std::size_t receive(const MutableBufferSequence& buffers,
+      asio::error_code& ec)
+  {
+    return detail::io(transport_, core_,
+        detail::read_op<MutableBufferSequence>(buffers), ec);
+  }
+
+  /// Start an asynchronous receive.
+  /**
+   * This function is used to asynchronously receive the data of a single
+   * record from the peer. It is an initiating function for an @ref
+   * asynchronous_operation, and always returns immediately. Datagrams that
+   * fail to decrypt are discarded.
+   *
+   * @param buffers The buffers into which the data will be received. The data
+   * is received into the first non-empty buffer. If it is smaller than the
+   * record, the remainder is returned by the next receive. Although the
+   * buffers object may be copied as necessary, ownership of the underlying
+   * buffers is retained by the caller, which must guarantee that they remain
+   * valid until the completion handler is called.
+   *
+   * @param token The @ref completion_token that will be used to produce a
+   * completion handler, which will be called when the receive completes.
+   * Potential completion tokens include @ref use_future, @ref use_awaitable,
+   * @ref yield_context, or a function object with the correct completion
+   * signature. The function signature of the completion handler must be:
+   * @code void handler(
+   *   const asio::error_code& error, // Result of operation.
+   *   std::size_t bytes_transferred // Number of bytes received.
+   * ); @endcode
+   * Regardless of whether the asynchronous operation completes immediately or
+   * not, the completion handler will not be invoked from within this function.
+   * On immediate completion, invocation of the handler will be performed in a
+   * manner equivalent to using asio::post().
+   *
+   * @par Completion Signature
+   * @code void(asio::error_code, std::size_t) @endcode
+   *
+   * @par Per-Operation Cancellation
+   * This asynchronous operation supports cancellation for the following
+   * asio::cancellation_type values:
+   *
+   * @li @c cancellation_type::terminal
+   *
+   * @li @c cancellation_type::partial
+   *
+   * if they are also supported by the @c DatagramSocket type's
+   * @c async_receive and @c async_send operations.
+   */
+  template <typename MutableBufferSequence,
+      ASIO_COMPLETION_TOKEN_FOR(void (asio::error_code,
+        std::size_t)) ReadToken
+          ASIO_DEFAULT_COMPLETION_TOKEN_TYPE(executor_type)>
+  ASIO_INITFN_AUTO_RESULT_TYPE_PREFIX(ReadToken,
+      void (asio::error_code, std::size_t))
+  async_receive(const MutableBufferSequence& buffers,
+      ASIO_MOVE_ARG(ReadToken) token
+        ASIO_DEFAULT_COMPLETION_TOKEN(executor_type))
+    ASIO_INITFN_AUTO_RESULT_TYPE_SUFFIX((
+      async_initiate<ReadToken,
+        void (asio::error_code, std::size_t)>(
+          declval<initiate_async_receive>(), token, buffers)))
+  {
+    return async_initiate<ReadToken,
+      void (asio::error_code, std::size_t)>(
+        initiate_async_receive(this), token, buffers);
+  }
+
+private:
+  typedef detail::datagram_transport<next_layer_type> transport_type;
+
+  class initiate_async_handshake
+  {
+  public:
+    typedef typename datagram_stream::executor_type executor_type;
+
+    explicit initiate_async_handshake(datagram_stream* self)
+      : self_(self)
+    {
+    }
+
+    executor_type get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename HandshakeHandler>
+    void operator()(ASIO_MOVE_ARG(HandshakeHandler) handler,
+        handshake_type type) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a HandshakeHandler.
+      ASIO_HANDSHAKE_HANDLER_CHECK(HandshakeHandler, handler) type_check;
+
+      asio::detail::non_const_lvalue<HandshakeHandler> handler2(handler);
+      detail::async_io(self_->transport_, self_->core_,
+          detail::handshake_op(type), handler2.value);
+    }
+
+  private:
+    datagram_stream* self_;
+  };
+
+  class initiate_async_shutdown
+  {
+  public:
+    typedef typename datagram_stream::executor_type executor_type;
+
+    explicit initiate_async_shutdown(datagram_stream* self)
+      : self_(self)
+    {
+    }
+
+    executor_type get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename ShutdownHandler>
+    void operator()(ASIO_MOVE_ARG(ShutdownHandler) handler) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ShutdownHandler.
+      ASIO_HANDSHAKE_HANDLER_CHECK(ShutdownHandler, handler) type_check;
+
+      asio::detail::non_const_lvalue<ShutdownHandler> handler2(handler);
+      detail::async_io(self_->transport_, self_->core_,
+          detail::shutdown_op(), handler2.value);
+    }
+
+  private:
+    datagram_stream* self_;
+  };
+
+  class initiate_async_send
+  {
+  public:
+    typedef typename datagram_stream::executor_type executor_type;
+
+    explicit initiate_async_send(datagram_stream* self)
+      : self_(self)
+    {
+    }
+
+    executor_type get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename WriteHandler, typename ConstBufferSequence>
+    void operator()(ASIO_MOVE_ARG(WriteHandler) handler,
+        const ConstBufferSequence& buffers) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a WriteHandler.
+      ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
+
+      asio::detail::non_const_lvalue<WriteHandler> handler2(handler);
+      detail::async_io(self_->transport_, self_->core_,
+          detail::write_op<ConstBufferSequence>(
+            buffers, self_->core_.write_buffer_space_), handler2.value);
+    }
+
+  private:
+    datagram_stream* self_;
+  };
+
+  class initiate_async_receive
+  {
+  public:
+    typedef typename datagram_stream::executor_type executor_type;
+
+    explicit initiate_async_receive(datagram_stream* self)
+      : self_(self)
+    {
+    }
+
+    executor_type get_executor() const ASIO_NOEXCEPT
+    {
+      return self_->get_executor();
+    }
+
+    template <typename ReadHandler, typename MutableBufferSequence>
+    void operator()(ASIO_MOVE_ARG(ReadHandler) handler,
+        const MutableBufferSequence& buffers) const
+    {
+      // If you get an error on the following line it means that your handler
+      // does not meet the documented type requirements for a ReadHandler.
+      ASIO_READ_HANDLER_CHECK(ReadHandler, handler) type_check;
+
+      asio::detail::non_const_lvalue<ReadHandler> handler2(handler);
+      detail::async_io(self_->transport_, self_->core_,
+          detail::read_op<MutableBufferSequence>(buffers), handler2.value);
+    }
+
+  private:
+    datagram_stream* self_;
+  };
+
+  DatagramSocket next_layer_;
+  detail::stream_core core_;
+  transport_type transport_;
+};
+
+} // namespace ssl
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_SSL_DTLS) || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_SSL_DATAGRAM_STREAM_HPP
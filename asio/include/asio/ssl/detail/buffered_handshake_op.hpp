@@ -69,6 +69,14 @@ private:
     Iterator iter = begin;
     std::size_t accumulated_size = 0;
 
+    // The engine cannot be given data that has already been read when it
+    // reads from the socket itself.
+    if (eng.uses_socket() && bytes_transferred < total_buffer_size_)
+    {
+      ec = asio::error::operation_not_supported;
+      return engine::want_nothing;
+    }
+
     for (;;)
     {
       engine::want want = eng.handshake(type_, ec);
@@ -0,0 +1,419 @@
+//
+// ssl/detail/datagram_transport.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_SSL_DETAIL_DATAGRAM_TRANSPORT_HPP
+#define ASIO_SSL_DETAIL_DATAGRAM_TRANSPORT_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include "asio/ssl/detail/openssl_types.hpp"
+
+#if defined(ASIO_HAS_SSL_DTLS)
+
+#if defined(ASIO_HAS_BOOST_DATE_TIME)
+# include "asio/deadline_timer.hpp"
+#else // defined(ASIO_HAS_BOOST_DATE_TIME)
+# include "asio/steady_timer.hpp"
+#endif // defined(ASIO_HAS_BOOST_DATE_TIME)
+#include "asio/associated_cancellation_slot.hpp"
+#include "asio/associated_executor.hpp"
+#include "asio/associator.hpp"
+#include "asio/bind_cancellation_slot.hpp"
+#include "asio/bind_executor.hpp"
+#include "asio/buffer.hpp"
+#include "asio/cancellation_signal.hpp"
+#include "asio/detail/bind_handler.hpp"
+#include "asio/detail/handler_alloc_helpers.hpp"
+#include "asio/detail/handler_cont_helpers.hpp"
+#include "asio/detail/handler_invoke_helpers.hpp"
+#include "asio/detail/memory.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/detail/socket_ops.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/error.hpp"
+#include "asio/post.hpp"
+#include "asio/ssl/detail/engine.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace ssl {
+namespace detail {
+
+// The state shared between a receive that waits for the handshake's
+// retransmission timer and the wait on the timer. The wait cancels the
+// receive if it is still the one the timer was started for.
+struct datagram_retransmit_state
+{
+  datagram_retransmit_state()
+    : generation(0),
+      expired(false)
+  {
+  }
+
+  cancellation_signal signal;
+  unsigned int generation;
+  bool expired;
+};
+
+// Completes the wait on the retransmission timer.
+class datagram_retransmit_handler
+{
+public:
+  datagram_retransmit_handler(
+      const asio::detail::shared_ptr<datagram_retransmit_state>& state)
+    : state_(state),
+      generation_(state->generation)
+  {
+  }
+
+  void operator()(const asio::error_code& ec)
+  {
+    if (!ec && state_->generation == generation_)
+    {
+      state_->expired = true;
+      state_->signal.emit(cancellation_type::total);
+    }
+  }
+
+private:
+  asio::detail::shared_ptr<datagram_retransmit_state> state_;
+  unsigned int generation_;
+};
+
+// Passes the cancellation of an operation on to a receive that waits for the
+// retransmission timer, which has its own cancellation slot.
+class datagram_cancellation_forwarder
+{
+public:
+  explicit datagram_cancellation_forwarder(
+      const asio::detail::shared_ptr<datagram_retransmit_state>& state)
+    : state_(state)
+  {
+  }
+
+  void operator()(cancellation_type_t type)
+  {
+    state_->signal.emit(type);
+  }
+
+private:
+  asio::detail::shared_ptr<datagram_retransmit_state> state_;
+};
+
+// Completes a receive that waits for the retransmission timer. A receive that
+// is cancelled by the timer completes without error and with no data, so that
+// the engine is called again and retransmits.
+template <typename Timer, typename Handler>
+class datagram_receive_handler
+{
+public:
+  datagram_receive_handler(Timer& timer,
+      const asio::detail::shared_ptr<datagram_retransmit_state>& state,
+      Handler& handler)
+    : timer_(timer),
+      state_(state),
+      handler_(ASIO_MOVE_CAST(Handler)(handler))
+  {
+  }
+
+#if defined(ASIO_HAS_MOVE)
+  datagram_receive_handler(const datagram_receive_handler& other)
+    : timer_(other.timer_),
+      state_(other.state_),
+      handler_(other.handler_)
+  {
+  }
+
+  datagram_receive_handler(datagram_receive_handler&& other)
+    : timer_(other.timer_),
+      state_(ASIO_MOVE_CAST(asio::detail::shared_ptr<
+            datagram_retransmit_state>)(other.state_)),
+      handler_(ASIO_MOVE_CAST(Handler)(other.handler_))
+  {
+  }
+#endif // defined(ASIO_HAS_MOVE)
+
+  void operator()(asio::error_code ec, std::size_t bytes_transferred)
+  {
+    // Stop the timer, and make sure a wait that has already completed does
+    // not cancel a later receive.
+    timer_.cancel();
+    ++state_->generation;
+    if (ec == asio::error::operation_aborted && state_->expired)
+      ec = asio::error_code();
+    state_->expired = false;
+
+    // The forwarder is no longer needed.
+    asio::cancellation_slot slot =
+      asio::get_associated_cancellation_slot(handler_);
+    if (slot.is_connected())
+      slot.clear();
+
+    ASIO_MOVE_OR_LVALUE(Handler)(handler_)(ec, bytes_transferred);
+  }
+
+//private:
+  Timer& timer_;
+  asio::detail::shared_ptr<datagram_retransmit_state> state_;
+  Handler handler_;
+};
+
+template <typename Timer, typename Handler>
+inline asio_handler_allocate_is_deprecated
+asio_handler_allocate(std::size_t size,
+    datagram_receive_handler<Timer, Handler>* this_handler)
+{
+#if defined(ASIO_NO_DEPRECATED)
+  asio_handler_alloc_helpers::allocate(size, this_handler->handler_);
+  return asio_handler_allocate_is_no_longer_used();
+#else // defined(ASIO_NO_DEPRECATED)
+  return asio_handler_alloc_helpers::allocate(
+      size, this_handler->handler_);
+#endif // defined(ASIO_NO_DEPRECATED)
+}
+
+template <typename Timer, typename Handler>
+inline asio_handler_deallocate_is_deprecated
+asio_handler_deallocate(void* pointer, std::size_t size,
+    datagram_receive_handler<Timer, Handler>* this_handler)
+{
+  asio_handler_alloc_helpers::deallocate(
+      pointer, size, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+  return asio_handler_deallocate_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+}
+
+template <typename Timer, typename Handler>
+inline bool asio_handler_is_continuation(
+    datagram_receive_handler<Timer, Handler>* this_handler)
+{
+  return asio_handler_cont_helpers::is_continuation(this_handler->handler_);
+}
+
+template <typename Function, typename Timer, typename Handler>
+inline asio_handler_invoke_is_deprecated
+asio_handler_invoke(Function& function,
+    datagram_receive_handler<Timer, Handler>* this_handler)
+{
+  asio_handler_invoke_helpers::invoke(
+      function, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+  return asio_handler_invoke_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+}
+
+template <typename Function, typename Timer, typename Handler>
+inline asio_handler_invoke_is_deprecated
+asio_handler_invoke(const Function& function,
+    datagram_receive_handler<Timer, Handler>* this_handler)
+{
+  asio_handler_invoke_helpers::invoke(
+      function, this_handler->handler_);
+#if defined(ASIO_NO_DEPRECATED)
+  return asio_handler_invoke_is_no_longer_used();
+#endif // defined(ASIO_NO_DEPRECATED)
+}
+
+// Presents a connected datagram socket as a stream to the SSL I/O operations.
+// Each write sends one of the datagrams produced by the engine, and each read
+// receives a single datagram. While the engine's handshake retransmission
+// timer is running, a read completes with no data once the timer expires.
+template <typename DatagramSocket>
+class datagram_transport
+  : private asio::detail::noncopyable
+{
+public:
+  typedef typename DatagramSocket::executor_type executor_type;
+  typedef typename DatagramSocket::lowest_layer_type lowest_layer_type;
+
+#if defined(ASIO_HAS_BOOST_DATE_TIME)
+  typedef asio::deadline_timer timer_type;
+#else // defined(ASIO_HAS_BOOST_DATE_TIME)
+  typedef asio::steady_timer timer_type;
+#endif // defined(ASIO_HAS_BOOST_DATE_TIME)
+
+  datagram_transport(DatagramSocket& socket, engine& eng)
+    : socket_(socket),
+      engine_(eng),
+      timer_(socket.get_executor()),
+      state_(new datagram_retransmit_state)
+  {
+  }
+
+  executor_type get_executor() ASIO_NOEXCEPT
+  {
+    return socket_.get_executor();
+  }
+
+  lowest_layer_type& lowest_layer()
+  {
+    return socket_.lowest_layer();
+  }
+
+  template <typename ConstBufferSequence>
+  std::size_t write_some(const ConstBufferSequence& buffers,
+      asio::error_code& ec)
+  {
+    asio::const_buffer datagram = first_datagram(buffers);
+    if (datagram.size() == 0)
+    {
+      ec = asio::error_code();
+      return 0;
+    }
+
+    return socket_.send(datagram, 0, ec);
+  }
+
+  template <typename ConstBufferSequence, typename WriteHandler>
+  void async_write_some(const ConstBufferSequence& buffers,
+      ASIO_MOVE_ARG(WriteHandler) handler)
+  {
+    asio::const_buffer datagram = first_datagram(buffers);
+    if (datagram.size() == 0)
+    {
+      asio::post(socket_.get_executor(),
+          asio::detail::bind_handler(
+            ASIO_MOVE_CAST(WriteHandler)(handler),
+            asio::error_code(), 0));
+      return;
+    }
+
+    socket_.async_send(datagram,
+        ASIO_MOVE_CAST(WriteHandler)(handler));
+  }
+
+  template <typename MutableBufferSequence>
+  std::size_t read_some(const MutableBufferSequence& buffers,
+      asio::error_code& ec)
+  {
+    int timeout = engine_.retransmit_timeout();
+    if (timeout >= 0)
+    {
+      // A read that finds no datagram before the timer expires has no data.
+      if (asio::detail::socket_ops::poll_read(
+            socket_.native_handle(), 0, timeout, ec) <= 0)
+        return 0;
+    }
+
+    return socket_.receive(buffers, 0, ec);
+  }
+
+  template <typename MutableBufferSequence, typename ReadHandler>
+  void async_read_some(const MutableBufferSequence& buffers,
+      ASIO_MOVE_ARG(ReadHandler) handler)
+  {
+    typedef typename decay<ReadHandler>::type handler_type;
+
+    // An empty read is used only to complete an operation as if posted. It
+    // must not consume a datagram.
+    if (asio::buffer_size(buffers) == 0)
+    {
+      asio::post(socket_.get_executor(),
+          asio::detail::bind_handler(
+            ASIO_MOVE_CAST(ReadHandler)(handler),
+            asio::error_code(), 0));
+      return;
+    }
+
+    int timeout = engine_.retransmit_timeout();
+    if (timeout < 0)
+    {
+      socket_.async_receive(buffers,
+          ASIO_MOVE_CAST(ReadHandler)(handler));
+      return;
+    }
+
+    // The wait on the timer runs on the same executor as the receive, so
+    // that it sees the receive's progress.
+    expires_after(timeout);
+    ++state_->generation;
+    timer_.async_wait(
+        asio::bind_executor(
+          asio::get_associated_executor(handler, socket_.get_executor()),
+          datagram_retransmit_handler(state_)));
+
+    // The receive is cancelled through the shared state's signal, which also
+    // passes on any cancellation of the operation itself.
+    asio::cancellation_slot slot =
+      asio::get_associated_cancellation_slot(handler);
+    if (slot.is_connected())
+      slot.template emplace<datagram_cancellation_forwarder>(state_);
+
+    handler_type handler2(ASIO_MOVE_CAST(ReadHandler)(handler));
+    socket_.async_receive(buffers,
+        asio::bind_cancellation_slot(state_->signal.slot(),
+          datagram_receive_handler<timer_type, handler_type>(
+            timer_, state_, handler2)));
+  }
+
+private:
+  // Get the datagram at the start of output obtained from the engine.
+  template <typename ConstBufferSequence>
+  asio::const_buffer first_datagram(const ConstBufferSequence& buffers)
+  {
+    asio::const_buffer output(*asio::buffer_sequence_begin(buffers));
+    return asio::buffer(output, engine_.datagram_size(output));
+  }
+
+  void expires_after(int milliseconds)
+  {
+#if defined(ASIO_HAS_BOOST_DATE_TIME)
+    timer_.expires_from_now(boost::posix_time::milliseconds(milliseconds));
+#else // defined(ASIO_HAS_BOOST_DATE_TIME)
+    timer_.expires_after(asio::chrono::milliseconds(milliseconds));
+#endif // defined(ASIO_HAS_BOOST_DATE_TIME)
+  }
+
+  DatagramSocket& socket_;
+  engine& engine_;
+  timer_type timer_;
+  asio::detail::shared_ptr<datagram_retransmit_state> state_;
+};
+
+} // namespace detail
+} // namespace ssl
+
+template <template <typename, typename> class Associator,
+    typename Timer, typename Handler, typename DefaultCandidate>
+struct associator<Associator,
+    ssl::detail::datagram_receive_handler<Timer, Handler>,
+    DefaultCandidate>
+  : Associator<Handler, DefaultCandidate>
+{
+  static typename Associator<Handler, DefaultCandidate>::type
+  get(const ssl::detail::datagram_receive_handler<Timer, Handler>& h)
+    ASIO_NOEXCEPT
+  {
+    return Associator<Handler, DefaultCandidate>::get(h.handler_);
+  }
+
+  static ASIO_AUTO_RETURN_TYPE_PREFIX2(
+      typename Associator<Handler, DefaultCandidate>::type)
+  get(const ssl::detail::datagram_receive_handler<Timer, Handler>& h,
+      const DefaultCandidate& c) ASIO_NOEXCEPT
+    ASIO_AUTO_RETURN_TYPE_SUFFIX((
+      Associator<Handler, DefaultCandidate>::get(h.handler_, c)))
+  {
+    return Associator<Handler, DefaultCandidate>::get(h.handler_, c);
+  }
+};
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_SSL_DTLS)
+
+#endif // ASIO_SSL_DETAIL_DATAGRAM_TRANSPORT_HPP
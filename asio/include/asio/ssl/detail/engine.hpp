@@ -17,6 +17,7 @@
 
 #include "asio/detail/config.hpp"
 
+#include <string>
 #include "asio/buffer.hpp"
 #include "asio/detail/static_mutex.hpp"
 #include "asio/ssl/detail/openssl_types.hpp"
@@ -35,6 +36,14 @@ class engine
 public:
   enum want
   {
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+    // Returned by functions to indicate that the engine has paused an
+    // asynchronous job. The caller should wait until the job's file descriptor
+    // is readable. The engine then needs to be called again to retry the
+    // operation.
+    want_async_and_retry = -3,
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
+
     // Returned by functions to indicate that the engine wants input. The input
     // buffer should be updated to point to the data. The engine then needs to
     // be called again to retry the operation.
@@ -77,6 +86,59 @@ public:
   // Get the underlying implementation in the native type.
   ASIO_DECL SSL* native_handle();
 
+#if defined(ASIO_HAS_SSL_KERNEL_TLS)
+  // Make the SSL implementation read from and write to the specified socket
+  // directly, rather than through the input and output buffers, and allow
+  // OpenSSL to hand the session's record encryption to the kernel. Must be
+  // called before the handshake.
+  ASIO_DECL asio::error_code use_kernel_tls(
+      int socket, asio::error_code& ec);
+
+  // Whether records written to the socket are encrypted by the kernel.
+  ASIO_DECL bool kernel_tls_send() const;
+
+  // Whether records read from the socket are decrypted by the kernel.
+  ASIO_DECL bool kernel_tls_receive() const;
+#endif // defined(ASIO_HAS_SSL_KERNEL_TLS)
+
+  // Whether the SSL implementation performs its own I/O on a socket, in which
+  // case the caller must wait for the socket to become ready instead of
+  // transferring input and output data.
+  bool uses_socket() const
+  {
+    return ssl_ != 0 && ext_bio_ == 0;
+  }
+
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+  // Enable or disable asynchronous jobs for the SSL implementation's
+  // operations.
+  ASIO_DECL void set_async_mode(bool enabled);
+
+  // Get the file descriptor on which to wait for a paused asynchronous job, or
+  // -1 if the job does not have one.
+  ASIO_DECL int async_job_fd() const;
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
+
+#if defined(ASIO_HAS_SSL_DTLS)
+  // Whether the SSL implementation uses a datagram protocol, in which case
+  // each output datagram must be written to the transport whole, and each
+  // datagram read from the transport is put as input on its own.
+  ASIO_DECL bool is_datagram() const;
+
+  // Get the size of the datagram at the start of the output returned by
+  // get_output().
+  ASIO_DECL std::size_t datagram_size(const asio::const_buffer& output) const;
+
+  // Get the number of milliseconds until the handshake must be retransmitted,
+  // or -1 if no retransmission is pending. Once the time has passed the
+  // engine retransmits on the next operation, even if no input was received.
+  ASIO_DECL int retransmit_timeout() const;
+
+  // Set the maximum size of the datagrams written by the SSL implementation.
+  ASIO_DECL asio::error_code set_mtu(
+      std::size_t mtu, asio::error_code& ec);
+#endif // defined(ASIO_HAS_SSL_DTLS)
+
   // Set the peer verification mode.
   ASIO_DECL asio::error_code set_verify_mode(
       verify_mode v, asio::error_code& ec);
@@ -89,6 +151,12 @@ public:
   ASIO_DECL asio::error_code set_verify_callback(
       verify_callback_base* callback, asio::error_code& ec);
 
+#if defined(ASIO_HAS_SSL_SESSION_CACHE)
+  // Set the key under which the sessions of a client are cached, when the
+  // context has a session cache.
+  ASIO_DECL void set_session_cache_key(const std::string& key);
+#endif // defined(ASIO_HAS_SSL_SESSION_CACHE)
+
   // Perform an SSL handshake using either SSL_connect (client-side) or
   // SSL_accept (server-side).
   ASIO_DECL want handshake(
@@ -105,6 +173,13 @@ public:
   ASIO_DECL want read(const asio::mutable_buffer& data,
       asio::error_code& ec, std::size_t& bytes_transferred);
 
+  // Read bytes that can be decrypted from input already received, following a
+  // successful read. Returns want_output if output must be written to the
+  // transport before the read completes, and want_nothing otherwise. Any
+  // error is left to be reported by the next read.
+  ASIO_DECL want read_more(const asio::mutable_buffer& data,
+      std::size_t& bytes_transferred);
+
   // Get output data to be written to the transport.
   ASIO_DECL asio::mutable_buffer get_output(
       const asio::mutable_buffer& data);
@@ -113,6 +188,19 @@ public:
   ASIO_DECL asio::const_buffer put_input(
       const asio::const_buffer& data);
 
+  // Set the buffer space used for the transport. Output from the SSL
+  // implementation is written directly into the output space, and input in
+  // the input space is read without being copied. Fails if the engine holds
+  // data that has not yet been consumed.
+  ASIO_DECL asio::error_code set_buffers(
+      const asio::mutable_buffer& input,
+      const asio::mutable_buffer& output,
+      asio::error_code& ec);
+
+  // Release the output returned by get_output() once it has been written to
+  // the transport, so that its space may be reused.
+  ASIO_DECL void release_output();
+
   // Map an error::eof code returned by the underlying transport according to
   // the type and state of the SSL session. Returns a const reference to the
   // error code object, suitable for passing to a completion handler.
@@ -134,6 +222,29 @@ private:
   ASIO_DECL static asio::detail::static_mutex& accept_mutex();
 #endif // (OPENSSL_VERSION_NUMBER < 0x10000000L)
 
+  // Create the BIO through which the SSL implementation performs its I/O.
+  ASIO_DECL void create_bio();
+
+  // Get the number of bytes of output waiting to be returned by get_output().
+  ASIO_DECL std::size_t pending_output() const;
+
+#if defined(ASIO_HAS_SSL_CUSTOM_BIO)
+  // The transport buffers used by the BIO.
+  struct bio_buffers;
+
+  // Get the transport buffers used by the BIO.
+  ASIO_DECL bio_buffers* buffers() const;
+
+  // Get the method table for the BIO, which is shared by all engines.
+  ASIO_DECL static BIO_METHOD* bio_method();
+
+  // Callbacks used when the SSL implementation performs I/O on the BIO.
+  ASIO_DECL static int bio_write(BIO* bio, const char* data, int length);
+  ASIO_DECL static int bio_read(BIO* bio, char* data, int length);
+  ASIO_DECL static long bio_ctrl(BIO* bio, int cmd, long num, void* ptr);
+  ASIO_DECL static int bio_destroy(BIO* bio);
+#endif // defined(ASIO_HAS_SSL_CUSTOM_BIO)
+
   // Perform one operation. Returns >= 0 on success or error, want_read if the
   // operation needs more input, or want_write if it needs to write some output
   // before the operation can complete.
@@ -17,9 +17,14 @@
 
 #include "asio/detail/config.hpp"
 
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <vector>
 #include "asio/detail/throw_error.hpp"
 #include "asio/error.hpp"
 #include "asio/ssl/detail/engine.hpp"
+#include "asio/ssl/detail/session_cache.hpp"
 #include "asio/ssl/error.hpp"
 #include "asio/ssl/verify_context.hpp"
 
@@ -29,6 +34,59 @@ namespace asio {
 namespace ssl {
 namespace detail {
 
+#if defined(ASIO_HAS_SSL_CUSTOM_BIO)
+struct engine::bio_buffers
+{
+  bio_buffers()
+    : input_space(0),
+      input_space_size(0),
+      input(0),
+      input_size(0),
+      output(0),
+      output_size(0),
+      output_begin(0),
+      output_taken(0),
+      output_end(0)
+#if defined(ASIO_HAS_SSL_DTLS)
+      , datagram(false)
+#endif // defined(ASIO_HAS_SSL_DTLS)
+  {
+  }
+
+  // The space into which input is read from the transport. Input in this
+  // space is read by the SSL implementation without being copied.
+  const unsigned char* input_space;
+  std::size_t input_space_size;
+
+  // The input that has not yet been read by the SSL implementation.
+  const unsigned char* input;
+  std::size_t input_size;
+
+  // A copy of input that was put from outside the input space, such as the
+  // data passed to a buffered handshake, which may not outlive the operation.
+  std::vector<unsigned char> input_copy;
+
+  // The space into which the SSL implementation writes output.
+  unsigned char* output;
+  std::size_t output_size;
+
+  // The output in [output_begin, output_end) has not yet been released. The
+  // part before output_taken has been returned by get_output(), and may still
+  // be being written to the transport.
+  std::size_t output_begin;
+  std::size_t output_taken;
+  std::size_t output_end;
+
+#if defined(ASIO_HAS_SSL_DTLS)
+  // Whether the output is made up of datagrams, each written whole. The end of
+  // every datagram in the output space is kept until the datagram is
+  // released.
+  bool datagram;
+  std::deque<std::size_t> datagram_ends;
+#endif // defined(ASIO_HAS_SSL_DTLS)
+};
+#endif // defined(ASIO_HAS_SSL_CUSTOM_BIO)
+
 engine::engine(SSL_CTX* context)
   : ssl_(::SSL_new(context))
 {
@@ -50,9 +108,7 @@ engine::engine(SSL_CTX* context)
   ::SSL_set_mode(ssl_, SSL_MODE_RELEASE_BUFFERS);
 #endif // defined(SSL_MODE_RELEASE_BUFFERS)
 
-  ::BIO* int_bio = 0;
-  ::BIO_new_bio_pair(&int_bio, 0, &ext_bio_, 0);
-  ::SSL_set_bio(ssl_, int_bio, int_bio);
+  create_bio();
 }
 
 engine::engine(SSL* ssl_impl)
@@ -68,9 +124,7 @@ engine::engine(SSL* ssl_impl)
   ::SSL_set_mode(ssl_, SSL_MODE_RELEASE_BUFFERS);
 #endif // defined(SSL_MODE_RELEASE_BUFFERS)
 
-  ::BIO* int_bio = 0;
-  ::BIO_new_bio_pair(&int_bio, 0, &ext_bio_, 0);
-  ::SSL_set_bio(ssl_, int_bio, int_bio);
+  create_bio();
 }
 
 #if defined(ASIO_HAS_MOVE)
@@ -117,6 +171,121 @@ SSL* engine::native_handle()
   return ssl_;
 }
 
+#if defined(ASIO_HAS_SSL_KERNEL_TLS)
+asio::error_code engine::use_kernel_tls(
+    int socket, asio::error_code& ec)
+{
+  if (uses_socket())
+  {
+    ec = asio::error::already_open;
+    return ec;
+  }
+
+  ::ERR_clear_error();
+  ::BIO* socket_bio = ::BIO_new_socket(socket, BIO_NOCLOSE);
+  if (!socket_bio)
+  {
+    ec = asio::error_code(
+        static_cast<int>(::ERR_get_error()),
+        asio::error::get_ssl_category());
+    return ec;
+  }
+
+  // Replacing the BIOs frees the internal half of the pair.
+  ::SSL_set_options(ssl_, SSL_OP_ENABLE_KTLS);
+  ::SSL_set_bio(ssl_, socket_bio, socket_bio);
+  ::BIO_free(ext_bio_);
+  ext_bio_ = 0;
+
+  ec = asio::error_code();
+  return ec;
+}
+
+bool engine::kernel_tls_send() const
+{
+  return uses_socket() && BIO_get_ktls_send(::SSL_get_wbio(ssl_)) != 0;
+}
+
+bool engine::kernel_tls_receive() const
+{
+  return uses_socket() && BIO_get_ktls_recv(::SSL_get_rbio(ssl_)) != 0;
+}
+#endif // defined(ASIO_HAS_SSL_KERNEL_TLS)
+
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+void engine::set_async_mode(bool enabled)
+{
+  if (enabled)
+    ::SSL_set_mode(ssl_, SSL_MODE_ASYNC);
+  else
+    ::SSL_clear_mode(ssl_, SSL_MODE_ASYNC);
+}
+
+int engine::async_job_fd() const
+{
+  std::size_t count = 0;
+  if (::SSL_get_all_async_fds(ssl_, 0, &count) != 1 || count == 0)
+    return -1;
+
+  // A job is normally signalled through a single file descriptor. If there are
+  // several, waiting on the first is enough for the job to make progress.
+  std::vector<OSSL_ASYNC_FD> fds(count);
+  if (::SSL_get_all_async_fds(ssl_, &fds[0], &count) != 1 || count == 0)
+    return -1;
+  return fds[0];
+}
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
+
+#if defined(ASIO_HAS_SSL_DTLS)
+bool engine::is_datagram() const
+{
+  return ssl_ != 0 && ::SSL_is_dtls(ssl_) != 0;
+}
+
+std::size_t engine::datagram_size(const asio::const_buffer& output) const
+{
+  if (output.size() == 0 || !ext_bio_ || !is_datagram())
+    return output.size();
+
+  bio_buffers* b = buffers();
+  std::size_t begin = static_cast<const unsigned char*>(output.data())
+    - b->output;
+  for (std::deque<std::size_t>::const_iterator i = b->datagram_ends.begin();
+      i != b->datagram_ends.end(); ++i)
+    if (*i > begin)
+      return (std::min)(*i - begin, output.size());
+  return output.size();
+}
+
+int engine::retransmit_timeout() const
+{
+  struct timeval tv;
+  if (!is_datagram() || DTLSv1_get_timeout(ssl_, &tv) != 1)
+    return -1;
+
+  // Round up, so that the timer has expired when the engine is next called.
+  long ms = static_cast<long>(tv.tv_sec) * 1000
+    + (static_cast<long>(tv.tv_usec) + 999) / 1000;
+  return ms < INT_MAX ? static_cast<int>(ms) : INT_MAX;
+}
+
+asio::error_code engine::set_mtu(
+    std::size_t mtu, asio::error_code& ec)
+{
+  // The SSL implementation rejects sizes below the smallest it supports.
+  ::SSL_set_options(ssl_, SSL_OP_NO_QUERY_MTU);
+  if (mtu > INT_MAX || SSL_set_mtu(ssl_, static_cast<long>(mtu)) <= 0)
+  {
+    ::SSL_clear_options(ssl_, SSL_OP_NO_QUERY_MTU);
+    ec = asio::error::invalid_argument;
+    return ec;
+  }
+
+  ec = asio::error_code();
+  return ec;
+}
+#endif // defined(ASIO_HAS_SSL_DTLS)
+
 asio::error_code engine::set_verify_mode(
     verify_mode v, asio::error_code& ec)
 {
@@ -173,6 +342,13 @@ int engine::verify_callback_function(int preverified, X509_STORE_CTX* ctx)
   return 0;
 }
 
+#if defined(ASIO_HAS_SSL_SESSION_CACHE)
+void engine::set_session_cache_key(const std::string& key)
+{
+  session_cache::set_key(ssl_, key);
+}
+#endif // defined(ASIO_HAS_SSL_SESSION_CACHE)
+
 engine::want engine::handshake(
     stream_base::handshake_type type, asio::error_code& ec)
 {
@@ -212,24 +388,141 @@ engine::want engine::read(const asio::mutable_buffer& data,
       data.size(), ec, &bytes_transferred);
 }
 
+engine::want engine::read_more(const asio::mutable_buffer& data,
+    std::size_t& bytes_transferred)
+{
+  bytes_transferred = 0;
+  if (data.size() == 0)
+    return want_nothing;
+
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+  // A paused job must be resumed by a call with the same arguments.
+  if ((::SSL_get_mode(ssl_) & SSL_MODE_ASYNC) != 0)
+    return want_nothing;
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
+
+#if defined(ASIO_HAS_SSL_DTLS)
+  // Each read from a datagram session returns a single record.
+  if (::SSL_is_dtls(ssl_))
+    return want_nothing;
+#endif // defined(ASIO_HAS_SSL_DTLS)
+
+  // Avoid calling the SSL implementation when it has nothing to decrypt.
+  if (::SSL_pending(ssl_) == 0 && (ext_bio_ == 0
+        || ::BIO_ctrl_pending(::SSL_get_rbio(ssl_)) == 0))
+    return want_nothing;
+
+  // A failed read is repeated when the next read is performed, so that its
+  // error is not lost. A partial record is kept by the SSL implementation.
+  asio::error_code ec;
+  want w = perform(&engine::do_read, data.data(),
+      data.size(), ec, &bytes_transferred);
+  return (w == want_output || w == want_output_and_retry)
+    ? want_output : want_nothing;
+}
+
 asio::mutable_buffer engine::get_output(
     const asio::mutable_buffer& data)
 {
+  if (!ext_bio_)
+    return asio::buffer(data, 0);
+
+#if defined(ASIO_HAS_SSL_CUSTOM_BIO)
+  // The output is already in the output space, which is the data buffer.
+  (void)data;
+  bio_buffers* b = buffers();
+  std::size_t begin = b->output_taken;
+  b->output_taken = b->output_end;
+  return asio::buffer(b->output + begin, b->output_end - begin);
+#else // defined(ASIO_HAS_SSL_CUSTOM_BIO)
   int length = ::BIO_read(ext_bio_,
       data.data(), static_cast<int>(data.size()));
 
   return asio::buffer(data,
       length > 0 ? static_cast<std::size_t>(length) : 0);
+#endif // defined(ASIO_HAS_SSL_CUSTOM_BIO)
 }
 
 asio::const_buffer engine::put_input(
     const asio::const_buffer& data)
 {
+  if (!ext_bio_)
+    return data;
+
+#if defined(ASIO_HAS_SSL_CUSTOM_BIO)
+  // The SSL implementation reads input in place, so new input can only be
+  // accepted once the previous input has been consumed.
+  bio_buffers* b = buffers();
+  if (b->input_size != 0)
+    return data;
+
+  const unsigned char* p = static_cast<const unsigned char*>(data.data());
+  std::size_t length = data.size();
+  if (p < b->input_space || p + length > b->input_space + b->input_space_size)
+  {
+    // Copy input from elsewhere, taking no more than a BIO pair would.
+    length = (std::min)(length, std::size_t(17 * 1024));
+    b->input_copy.assign(p, p + length);
+    p = length ? &b->input_copy[0] : 0;
+  }
+
+  b->input = p;
+  b->input_size = length;
+  return asio::buffer(data + length);
+#else // defined(ASIO_HAS_SSL_CUSTOM_BIO)
   int length = ::BIO_write(ext_bio_,
       data.data(), static_cast<int>(data.size()));
 
   return asio::buffer(data +
       (length > 0 ? static_cast<std::size_t>(length) : 0));
+#endif // defined(ASIO_HAS_SSL_CUSTOM_BIO)
+}
+
+asio::error_code engine::set_buffers(
+    const asio::mutable_buffer& input,
+    const asio::mutable_buffer& output,
+    asio::error_code& ec)
+{
+#if defined(ASIO_HAS_SSL_CUSTOM_BIO)
+  if (ext_bio_)
+  {
+    bio_buffers* b = buffers();
+    if (b->input_size != 0 || b->output_end != 0)
+    {
+      ec = asio::error::in_progress;
+      return ec;
+    }
+
+    b->input_space = static_cast<const unsigned char*>(input.data());
+    b->input_space_size = input.size();
+    b->output = static_cast<unsigned char*>(output.data());
+    b->output_size = output.size();
+  }
+#else // defined(ASIO_HAS_SSL_CUSTOM_BIO)
+  (void)input;
+  (void)output;
+#endif // defined(ASIO_HAS_SSL_CUSTOM_BIO)
+
+  ec = asio::error_code();
+  return ec;
+}
+
+void engine::release_output()
+{
+#if defined(ASIO_HAS_SSL_CUSTOM_BIO)
+  if (ext_bio_)
+  {
+    bio_buffers* b = buffers();
+    b->output_begin = b->output_taken;
+#if defined(ASIO_HAS_SSL_DTLS)
+    while (!b->datagram_ends.empty()
+        && b->datagram_ends.front() <= b->output_begin)
+      b->datagram_ends.pop_front();
+#endif // defined(ASIO_HAS_SSL_DTLS)
+    if (b->output_begin == b->output_end)
+      b->output_begin = b->output_taken = b->output_end = 0;
+  }
+#endif // defined(ASIO_HAS_SSL_CUSTOM_BIO)
 }
 
 const asio::error_code& engine::map_error_code(
@@ -240,7 +533,11 @@ const asio::error_code& engine::map_error_code(
     return ec;
 
   // If there's data yet to be read, it's an error.
-  if (BIO_wpending(ext_bio_))
+#if defined(ASIO_HAS_SSL_CUSTOM_BIO)
+  if (ext_bio_ && buffers()->input_size != 0)
+#else // defined(ASIO_HAS_SSL_CUSTOM_BIO)
+  if (ext_bio_ && BIO_wpending(ext_bio_))
+#endif // defined(ASIO_HAS_SSL_CUSTOM_BIO)
   {
     ec = asio::ssl::error::stream_truncated;
     return ec;
@@ -262,6 +559,171 @@ const asio::error_code& engine::map_error_code(
   return ec;
 }
 
+void engine::create_bio()
+{
+#if defined(ASIO_HAS_SSL_CUSTOM_BIO)
+  // The SSL implementation and the engine each hold a reference to the BIO.
+  ::BIO* bio = ::BIO_new(bio_method());
+  bio_buffers* b = new bio_buffers;
+#if defined(ASIO_HAS_SSL_DTLS)
+  b->datagram = ::SSL_is_dtls(ssl_) != 0;
+#endif // defined(ASIO_HAS_SSL_DTLS)
+  ::BIO_set_data(bio, b);
+  ::BIO_set_init(bio, 1);
+  ::BIO_up_ref(bio);
+  ::SSL_set_bio(ssl_, bio, bio);
+  ext_bio_ = bio;
+#else // defined(ASIO_HAS_SSL_CUSTOM_BIO)
+  ::BIO* int_bio = 0;
+  ::BIO_new_bio_pair(&int_bio, 0, &ext_bio_, 0);
+  ::SSL_set_bio(ssl_, int_bio, int_bio);
+#endif // defined(ASIO_HAS_SSL_CUSTOM_BIO)
+}
+
+std::size_t engine::pending_output() const
+{
+  if (!ext_bio_)
+    return 0;
+
+#if defined(ASIO_HAS_SSL_CUSTOM_BIO)
+  bio_buffers* b = buffers();
+  return b->output_end - b->output_taken;
+#else // defined(ASIO_HAS_SSL_CUSTOM_BIO)
+  return ::BIO_ctrl_pending(ext_bio_);
+#endif // defined(ASIO_HAS_SSL_CUSTOM_BIO)
+}
+
+#if defined(ASIO_HAS_SSL_CUSTOM_BIO)
+engine::bio_buffers* engine::buffers() const
+{
+  return static_cast<bio_buffers*>(::BIO_get_data(ext_bio_));
+}
+
+BIO_METHOD* engine::bio_method()
+{
+  // The method table is created once and, like OpenSSL's own method tables,
+  // lasts for the lifetime of the program.
+  static asio::detail::static_mutex mutex = ASIO_STATIC_MUTEX_INIT;
+  static BIO_METHOD* method = 0;
+  mutex.init();
+  asio::detail::static_mutex::scoped_lock lock(mutex);
+  if (!method)
+  {
+    method = ::BIO_meth_new(BIO_TYPE_SOURCE_SINK, "asio transport buffers");
+    ::BIO_meth_set_write(method, &engine::bio_write);
+    ::BIO_meth_set_read(method, &engine::bio_read);
+    ::BIO_meth_set_ctrl(method, &engine::bio_ctrl);
+    ::BIO_meth_set_destroy(method, &engine::bio_destroy);
+  }
+  return method;
+}
+
+int engine::bio_write(BIO* bio, const char* data, int length)
+{
+  ::BIO_clear_retry_flags(bio);
+  bio_buffers* b = static_cast<bio_buffers*>(::BIO_get_data(bio));
+
+  // Move unreleased output to the start of the space when full, unless some
+  // of it may still be being written to the transport.
+  if (b->output_end == b->output_size && b->output_begin != 0
+      && b->output_begin == b->output_taken)
+  {
+    std::size_t size = b->output_end - b->output_begin;
+    std::memmove(b->output, b->output + b->output_begin, size);
+#if defined(ASIO_HAS_SSL_DTLS)
+    for (std::deque<std::size_t>::iterator i = b->datagram_ends.begin();
+        i != b->datagram_ends.end(); ++i)
+      *i -= b->output_begin;
+#endif // defined(ASIO_HAS_SSL_DTLS)
+    b->output_begin = b->output_taken = 0;
+    b->output_end = size;
+  }
+
+  std::size_t n = (std::min)(static_cast<std::size_t>(length),
+      b->output_size - b->output_end);
+#if defined(ASIO_HAS_SSL_DTLS)
+  // A datagram is written whole or not at all.
+  if (b->datagram && n < static_cast<std::size_t>(length))
+    n = 0;
+#endif // defined(ASIO_HAS_SSL_DTLS)
+  if (n == 0)
+  {
+    ::BIO_set_retry_write(bio);
+    return -1;
+  }
+
+  std::memcpy(b->output + b->output_end, data, n);
+  b->output_end += n;
+#if defined(ASIO_HAS_SSL_DTLS)
+  if (b->datagram)
+    b->datagram_ends.push_back(b->output_end);
+#endif // defined(ASIO_HAS_SSL_DTLS)
+  return static_cast<int>(n);
+}
+
+int engine::bio_read(BIO* bio, char* data, int length)
+{
+  ::BIO_clear_retry_flags(bio);
+  bio_buffers* b = static_cast<bio_buffers*>(::BIO_get_data(bio));
+
+  std::size_t n = (std::min)(static_cast<std::size_t>(length), b->input_size);
+  if (n == 0)
+  {
+    ::BIO_set_retry_read(bio);
+    return -1;
+  }
+
+  std::memcpy(data, b->input, n);
+  b->input += n;
+  b->input_size -= n;
+#if defined(ASIO_HAS_SSL_DTLS)
+  // As with a datagram socket, any part of a datagram that is not read is
+  // discarded.
+  if (b->datagram)
+    b->input_size = 0;
+#endif // defined(ASIO_HAS_SSL_DTLS)
+  if (b->input_size == 0 && !b->input_copy.empty())
+    std::vector<unsigned char>().swap(b->input_copy);
+  return static_cast<int>(n);
+}
+
+long engine::bio_ctrl(BIO* bio, int cmd, long, void*)
+{
+  bio_buffers* b = static_cast<bio_buffers*>(::BIO_get_data(bio));
+  switch (cmd)
+  {
+  case BIO_CTRL_PENDING:
+    return static_cast<long>(b->input_size);
+  case BIO_CTRL_WPENDING:
+#if defined(ASIO_HAS_SSL_DTLS)
+    // Datagrams are complete once written, so none are reported as pending.
+    // Otherwise the SSL implementation would shrink the records it writes.
+    if (b->datagram)
+      return 0;
+#endif // defined(ASIO_HAS_SSL_DTLS)
+    return static_cast<long>(b->output_end - b->output_taken);
+  case BIO_CTRL_FLUSH:
+    return 1;
+#if defined(ASIO_HAS_SSL_DTLS)
+  case BIO_CTRL_DGRAM_QUERY_MTU:
+  case BIO_CTRL_DGRAM_GET_FALLBACK_MTU:
+    // The largest UDP payload that fits in an Ethernet frame over both IPv4
+    // and IPv6.
+    return 1452;
+#endif // defined(ASIO_HAS_SSL_DTLS)
+  default:
+    return 0;
+  }
+}
+
+int engine::bio_destroy(BIO* bio)
+{
+  delete static_cast<bio_buffers*>(::BIO_get_data(bio));
+  ::BIO_set_data(bio, 0);
+  return 1;
+}
+#endif // defined(ASIO_HAS_SSL_CUSTOM_BIO)
+
 #if (OPENSSL_VERSION_NUMBER < 0x10000000L)
 asio::detail::static_mutex& engine::accept_mutex()
 {
@@ -274,15 +736,36 @@ engine::want engine::perform(int (engine::* op)(void*, std::size_t),
     void* data, std::size_t length, asio::error_code& ec,
     std::size_t* bytes_transferred)
 {
-  std::size_t pending_output_before = ::BIO_ctrl_pending(ext_bio_);
+  std::size_t pending_output_before = pending_output();
   ::ERR_clear_error();
+  if (!ext_bio_)
+    errno = 0;
+#if defined(ASIO_HAS_SSL_DTLS)
+  // The handshake of a datagram session is retransmitted once its timer has
+  // expired. Failure, such as after too many retransmissions, is reported as
+  // the operation's error.
+  int result = (::SSL_is_dtls(ssl_) && DTLSv1_handle_timeout(ssl_) < 0)
+    ? -1 : (this->*op)(data, length);
+#else // defined(ASIO_HAS_SSL_DTLS)
   int result = (this->*op)(data, length);
+#endif // defined(ASIO_HAS_SSL_DTLS)
   int ssl_error = ::SSL_get_error(ssl_, result);
   int sys_error = static_cast<int>(::ERR_get_error());
-  std::size_t pending_output_after = ::BIO_ctrl_pending(ext_bio_);
+  std::size_t pending_output_after = pending_output();
 
   if (ssl_error == SSL_ERROR_SSL)
   {
+#if defined(SSL_R_UNEXPECTED_EOF_WHILE_READING)
+    // When reading from a socket, an end of file that is not preceded by the
+    // peer's close_notify is detected by the SSL implementation itself.
+    if (!ext_bio_ && ERR_GET_LIB(sys_error) == ERR_LIB_SSL
+        && ERR_GET_REASON(sys_error) == SSL_R_UNEXPECTED_EOF_WHILE_READING)
+    {
+      ec = asio::ssl::error::stream_truncated;
+      return want_nothing;
+    }
+#endif // defined(SSL_R_UNEXPECTED_EOF_WHILE_READING)
+
     ec = asio::error_code(sys_error,
         asio::error::get_ssl_category());
     return pending_output_after > pending_output_before
@@ -291,7 +774,13 @@ engine::want engine::perform(int (engine::* op)(void*, std::size_t),
 
   if (ssl_error == SSL_ERROR_SYSCALL)
   {
-    if (sys_error == 0)
+    if (sys_error == 0 && !ext_bio_ && errno != 0)
+    {
+      // The SSL implementation's own I/O on the socket failed.
+      ec = asio::error_code(errno,
+          asio::error::get_system_category());
+    }
+    else if (sys_error == 0)
     {
       ec = asio::ssl::error::unspecified_system_error;
     }
@@ -317,6 +806,14 @@ engine::want engine::perform(int (engine::* op)(void*, std::size_t),
     ec = asio::error_code();
     return result > 0 ? want_output : want_output_and_retry;
   }
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+  else if (ssl_error == SSL_ERROR_WANT_ASYNC
+      || ssl_error == SSL_ERROR_WANT_ASYNC_JOB)
+  {
+    ec = asio::error_code();
+    return want_async_and_retry;
+  }
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
   else if (ssl_error == SSL_ERROR_WANT_READ)
   {
     ec = asio::error_code();
@@ -349,12 +846,30 @@ int engine::do_accept(void*, std::size_t)
 
 int engine::do_connect(void*, std::size_t)
 {
+#if defined(ASIO_HAS_SSL_SESSION_CACHE)
+  // A client has no session until its handshake starts, unless one has been
+  // set to be resumed.
+  if (::SSL_get_session(ssl_) == 0)
+    session_cache::resume(ssl_);
+
+  int result = ::SSL_connect(ssl_);
+  if (result == 1)
+    session_cache::handshake_complete(ssl_);
+  return result;
+#else // defined(ASIO_HAS_SSL_SESSION_CACHE)
   return ::SSL_connect(ssl_);
+#endif // defined(ASIO_HAS_SSL_SESSION_CACHE)
 }
 
 int engine::do_shutdown(void*, std::size_t)
 {
   int result = ::SSL_shutdown(ssl_);
+#if defined(ASIO_HAS_SSL_DTLS)
+  // The peer's close_notify may never arrive over a datagram transport, so
+  // the shutdown is complete once ours has been sent.
+  if (result == 0 && ::SSL_is_dtls(ssl_))
+    return 1;
+#endif // defined(ASIO_HAS_SSL_DTLS)
   if (result == 0)
     result = ::SSL_shutdown(ssl_);
   return result;
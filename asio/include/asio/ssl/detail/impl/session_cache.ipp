@@ -0,0 +1,445 @@
+//
+// ssl/detail/impl/session_cache.ipp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_SSL_DETAIL_IMPL_SESSION_CACHE_IPP
+#define ASIO_SSL_DETAIL_IMPL_SESSION_CACHE_IPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include "asio/ssl/detail/session_cache.hpp"
+
+#if defined(ASIO_HAS_SSL_SESSION_CACHE)
+
+#include <cstring>
+#include <ctime>
+#include "asio/detail/static_mutex.hpp"
+#include "asio/error.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace ssl {
+namespace detail {
+
+session_cache* session_cache::get(SSL_CTX* ctx)
+{
+  return static_cast<session_cache*>(
+      ::SSL_CTX_get_ex_data(ctx, context_index()));
+}
+
+session_cache* session_cache::get_or_create(SSL_CTX* ctx)
+{
+  session_cache* cache = get(ctx);
+  if (!cache)
+  {
+    cache = new session_cache;
+    ::SSL_CTX_set_ex_data(ctx, context_index(), cache);
+  }
+  return cache;
+}
+
+void session_cache::enable_client_cache(
+    SSL_CTX* ctx, std::size_t max_entries)
+{
+  asio::detail::mutex::scoped_lock lock(mutex_);
+
+  max_entries_ = max_entries;
+  while (entries_.size() > max_entries_)
+  {
+    entry_map::iterator iter = entries_.find(lru_.back());
+    for (std::size_t i = 0; i < iter->second.sessions.size(); ++i)
+      ::SSL_SESSION_free(iter->second.sessions[i]);
+    entries_.erase(iter);
+    lru_.pop_back();
+  }
+
+  // Sessions are delivered to the callback. OpenSSL's internal cache is only
+  // consulted by servers, so a client-only context need not store them there
+  // too. A context that may also act as a server must keep its internal cache
+  // working for its server-side sessions.
+  long mode = ::SSL_CTX_get_session_cache_mode(ctx) | SSL_SESS_CACHE_CLIENT;
+  const SSL_METHOD* method = ::SSL_CTX_get_ssl_method(ctx);
+  if (method == ::TLS_client_method() || method == ::DTLS_client_method())
+    mode |= SSL_SESS_CACHE_NO_INTERNAL_STORE;
+  ::SSL_CTX_set_session_cache_mode(ctx, mode);
+  ::SSL_CTX_sess_set_new_cb(ctx, &session_cache::new_session_callback);
+}
+
+asio::error_code session_cache::rotate_ticket_key(SSL_CTX* ctx,
+    const asio::const_buffer& key, asio::error_code& ec)
+{
+  if (key.size() != ticket_key_size)
+  {
+    ec = asio::error::invalid_argument;
+    return ec;
+  }
+
+  asio::detail::mutex::scoped_lock lock(mutex_);
+
+  ticket_keys_[1] = ticket_keys_[0];
+  const unsigned char* data = static_cast<const unsigned char*>(key.data());
+  std::memcpy(ticket_keys_[0].name, data, 16);
+  std::memcpy(ticket_keys_[0].hmac_key, data + 16, 32);
+  std::memcpy(ticket_keys_[0].aes_key, data + 48, 32);
+  if (ticket_key_count_ < 2)
+    ++ticket_key_count_;
+
+#if (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+  ::SSL_CTX_set_tlsext_ticket_key_evp_cb(ctx,
+      &session_cache::ticket_key_callback);
+#else // (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+  ::SSL_CTX_set_tlsext_ticket_key_cb(ctx,
+      &session_cache::ticket_key_callback);
+#endif // (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+
+  ec = asio::error_code();
+  return ec;
+}
+
+session_cache::counters session_cache::get_counters()
+{
+  asio::detail::mutex::scoped_lock lock(mutex_);
+  return counters_;
+}
+
+void session_cache::set_key(SSL* ssl, const std::string& key)
+{
+  std::string* old_key = static_cast<std::string*>(
+      ::SSL_get_ex_data(ssl, key_index()));
+  ::SSL_set_ex_data(ssl, key_index(), new std::string(key));
+  delete old_key;
+}
+
+void session_cache::resume(SSL* ssl)
+{
+  session_cache* cache = get(::SSL_get_SSL_CTX(ssl));
+  if (!cache)
+    return;
+
+  std::string key = key_for(ssl);
+  if (key.empty())
+    return;
+
+  SSL_SESSION* session = 0;
+  {
+    asio::detail::mutex::scoped_lock lock(cache->mutex_);
+
+    entry_map::iterator iter = cache->entries_.find(key);
+    if (iter == cache->entries_.end() || iter->second.sessions.empty())
+      return;
+
+    // Discard sessions that can no longer be resumed, falling back to older
+    // ones. OpenSSL marks a session as not resumable when its connection is
+    // closed without a shutdown.
+    std::vector<SSL_SESSION*>& sessions = iter->second.sessions;
+    while (!sessions.empty() && !is_resumable(sessions.back()))
+    {
+      ::SSL_SESSION_free(sessions.back());
+      sessions.pop_back();
+    }
+    if (sessions.empty())
+      return;
+
+    cache->lru_.splice(cache->lru_.begin(), cache->lru_, iter->second.lru);
+
+    // TLS 1.3 tickets are used only once, as recommended by RFC 8446, and
+    // the new connection receives fresh tickets in their place.
+    session = sessions.back();
+    if (::SSL_SESSION_get_protocol_version(session) >= TLS1_3_VERSION)
+      sessions.pop_back();
+    else
+      ::SSL_SESSION_up_ref(session);
+  }
+
+  ::SSL_set_session(ssl, session);
+  ::SSL_SESSION_free(session);
+}
+
+void session_cache::handshake_complete(SSL* ssl)
+{
+  session_cache* cache = get(::SSL_get_SSL_CTX(ssl));
+  if (!cache)
+    return;
+
+  std::string key = key_for(ssl);
+  if (key.empty())
+    return;
+
+  asio::detail::mutex::scoped_lock lock(cache->mutex_);
+  if (cache->max_entries_ == 0)
+    return;
+
+  if (::SSL_session_reused(ssl))
+  {
+    ++cache->counters_.hits;
+
+    // When a server renews the ticket of a resumed TLS 1.2 session, the
+    // client replaces the session with a new one that is not passed to the
+    // new session callback, so it is cached here.
+    SSL_SESSION* session = ::SSL_get_session(ssl);
+    if (::SSL_SESSION_get_protocol_version(session) < TLS1_3_VERSION)
+    {
+      entry_map::iterator iter = cache->entries_.find(key);
+      if (iter == cache->entries_.end() || iter->second.sessions.empty()
+          || iter->second.sessions.back() != session)
+      {
+        ::SSL_SESSION_up_ref(session);
+        cache->add(key, session);
+      }
+    }
+  }
+  else
+  {
+    ++cache->counters_.misses;
+  }
+}
+
+session_cache::session_cache()
+  : max_entries_(0),
+    ticket_key_count_(0)
+{
+  counters_.hits = 0;
+  counters_.misses = 0;
+  counters_.ticket_hits = 0;
+  counters_.ticket_misses = 0;
+}
+
+session_cache::~session_cache()
+{
+  for (entry_map::iterator iter = entries_.begin();
+      iter != entries_.end(); ++iter)
+  {
+    for (std::size_t i = 0; i < iter->second.sessions.size(); ++i)
+      ::SSL_SESSION_free(iter->second.sessions[i]);
+  }
+
+  // Scrub the ticket keys.
+  volatile unsigned char* p
+    = reinterpret_cast<volatile unsigned char*>(ticket_keys_);
+  for (std::size_t i = 0; i < sizeof(ticket_keys_); ++i)
+    p[i] = 0;
+}
+
+bool session_cache::is_resumable(SSL_SESSION* session)
+{
+#if (OPENSSL_VERSION_NUMBER >= 0x10101000L) \
+  && !defined(LIBRESSL_VERSION_NUMBER)
+  if (!::SSL_SESSION_is_resumable(session))
+    return false;
+#endif // (OPENSSL_VERSION_NUMBER >= 0x10101000L)
+       //   && !defined(LIBRESSL_VERSION_NUMBER)
+
+  return ::SSL_SESSION_get_time(session) + ::SSL_SESSION_get_timeout(session)
+    > static_cast<long>(std::time(0));
+}
+
+std::string session_cache::key_for(SSL* ssl)
+{
+  if (std::string* key = static_cast<std::string*>(
+        ::SSL_get_ex_data(ssl, key_index())))
+    return *key;
+
+  const char* server_name
+    = ::SSL_get_servername(ssl, TLSEXT_NAMETYPE_host_name);
+  return server_name ? server_name : std::string();
+}
+
+int session_cache::context_index()
+{
+  static asio::detail::static_mutex mutex = ASIO_STATIC_MUTEX_INIT;
+  static int index = -1;
+  mutex.init();
+  asio::detail::static_mutex::scoped_lock lock(mutex);
+  if (index < 0)
+    index = ::SSL_CTX_get_ex_new_index(0, 0, 0, 0,
+        &session_cache::free_cache);
+  return index;
+}
+
+int session_cache::key_index()
+{
+  static asio::detail::static_mutex mutex = ASIO_STATIC_MUTEX_INIT;
+  static int index = -1;
+  mutex.init();
+  asio::detail::static_mutex::scoped_lock lock(mutex);
+  if (index < 0)
+    index = ::SSL_get_ex_new_index(0, 0, 0, 0, &session_cache::free_key);
+  return index;
+}
+
+void session_cache::free_cache(void*, void* ptr,
+    CRYPTO_EX_DATA*, int, long, void*)
+{
+  delete static_cast<session_cache*>(ptr);
+}
+
+void session_cache::free_key(void*, void* ptr,
+    CRYPTO_EX_DATA*, int, long, void*)
+{
+  delete static_cast<std::string*>(ptr);
+}
+
+int session_cache::new_session_callback(SSL* ssl, SSL_SESSION* session)
+{
+  // Servers keep their sessions in OpenSSL's own cache.
+  session_cache* cache = get(::SSL_get_SSL_CTX(ssl));
+  if (!cache || ::SSL_is_server(ssl))
+    return 0;
+
+  std::string key = key_for(ssl);
+  if (key.empty())
+    return 0;
+
+  asio::detail::mutex::scoped_lock lock(cache->mutex_);
+  if (cache->max_entries_ == 0)
+    return 0;
+
+  cache->add(key, session);
+
+  // Returning 1 keeps the reference to the session.
+  return 1;
+}
+
+void session_cache::add(const std::string& key, SSL_SESSION* session)
+{
+  entry_map::iterator iter = entries_.find(key);
+  if (iter == entries_.end())
+  {
+    if (entries_.size() == max_entries_)
+    {
+      // Evict the least recently used host or endpoint.
+      entry_map::iterator oldest = entries_.find(lru_.back());
+      for (std::size_t i = 0; i < oldest->second.sessions.size(); ++i)
+        ::SSL_SESSION_free(oldest->second.sessions[i]);
+      entries_.erase(oldest);
+      lru_.pop_back();
+    }
+
+    lru_.push_front(key);
+    iter = entries_.insert(entry_map::value_type(key, entry())).first;
+    iter->second.lru = lru_.begin();
+  }
+  else
+  {
+    lru_.splice(lru_.begin(), lru_, iter->second.lru);
+  }
+
+  // A TLS 1.2 session may be resumed any number of times, so only the most
+  // recent is kept.
+  std::vector<SSL_SESSION*>& sessions = iter->second.sessions;
+  if (::SSL_SESSION_get_protocol_version(session) < TLS1_3_VERSION)
+  {
+    for (std::size_t i = 0; i < sessions.size(); ++i)
+      ::SSL_SESSION_free(sessions[i]);
+    sessions.clear();
+  }
+  else if (sessions.size() == max_sessions_per_entry)
+  {
+    ::SSL_SESSION_free(sessions.front());
+    sessions.erase(sessions.begin());
+  }
+  sessions.push_back(session);
+}
+
+#if (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+int session_cache::ticket_key_callback(SSL* ssl, unsigned char* name,
+    unsigned char* iv, EVP_CIPHER_CTX* cipher_ctx,
+    EVP_MAC_CTX* mac_ctx, int enc)
+#else // (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+int session_cache::ticket_key_callback(SSL* ssl, unsigned char* name,
+    unsigned char* iv, EVP_CIPHER_CTX* cipher_ctx,
+    HMAC_CTX* hmac_ctx, int enc)
+#endif // (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+{
+  session_cache* cache = get(::SSL_get_SSL_CTX(ssl));
+  if (!cache)
+    return -1;
+
+  // The result is 1 for the current key, or 2 to ask for a ticket that was
+  // encrypted with the previous key to be renewed. TLS 1.3 clients use each
+  // ticket only once, so their tickets are always renewed.
+  ticket_key key;
+  int result = ::SSL_version(ssl) >= TLS1_3_VERSION ? 2 : 1;
+  {
+    asio::detail::mutex::scoped_lock lock(cache->mutex_);
+
+    if (cache->ticket_key_count_ == 0)
+      return -1;
+
+    if (enc)
+    {
+      key = cache->ticket_keys_[0];
+    }
+    else if (std::memcmp(name, cache->ticket_keys_[0].name, 16) == 0)
+    {
+      key = cache->ticket_keys_[0];
+      ++cache->counters_.ticket_hits;
+    }
+    else if (cache->ticket_key_count_ > 1
+        && std::memcmp(name, cache->ticket_keys_[1].name, 16) == 0)
+    {
+      key = cache->ticket_keys_[1];
+      result = 2;
+      ++cache->counters_.ticket_hits;
+    }
+    else
+    {
+      // Unknown key. The client performs a full handshake.
+      ++cache->counters_.ticket_misses;
+      return 0;
+    }
+  }
+
+  if (enc)
+  {
+    std::memcpy(name, key.name, 16);
+    if (::RAND_bytes(iv, 16) != 1)
+      return -1;
+    if (::EVP_EncryptInit_ex(cipher_ctx,
+          ::EVP_aes_256_cbc(), 0, key.aes_key, iv) != 1)
+      return -1;
+  }
+  else if (::EVP_DecryptInit_ex(cipher_ctx,
+        ::EVP_aes_256_cbc(), 0, key.aes_key, iv) != 1)
+  {
+    return -1;
+  }
+
+#if (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+  char digest[] = "SHA256";
+  OSSL_PARAM params[3];
+  params[0] = ::OSSL_PARAM_construct_octet_string(
+      OSSL_MAC_PARAM_KEY, key.hmac_key, sizeof(key.hmac_key));
+  params[1] = ::OSSL_PARAM_construct_utf8_string(
+      OSSL_MAC_PARAM_DIGEST, digest, 0);
+  params[2] = ::OSSL_PARAM_construct_end();
+  if (::EVP_MAC_CTX_set_params(mac_ctx, params) != 1)
+    return -1;
+#else // (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+  if (::HMAC_Init_ex(hmac_ctx, key.hmac_key,
+        sizeof(key.hmac_key), ::EVP_sha256(), 0) != 1)
+    return -1;
+#endif // (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+
+  return result;
+}
+
+} // namespace detail
+} // namespace ssl
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_SSL_SESSION_CACHE)
+
+#endif // ASIO_SSL_DETAIL_IMPL_SESSION_CACHE_IPP
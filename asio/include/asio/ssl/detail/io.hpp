@@ -19,6 +19,10 @@
 
 #include "asio/detail/base_from_cancellation_state.hpp"
 #include "asio/detail/handler_tracking.hpp"
+#include "asio/detail/type_traits.hpp"
+#include "asio/executor_work_guard.hpp"
+#include "asio/post.hpp"
+#include "asio/socket_base.hpp"
 #include "asio/ssl/detail/engine.hpp"
 #include "asio/ssl/detail/stream_core.hpp"
 #include "asio/write.hpp"
@@ -29,6 +33,86 @@ namespace asio {
 namespace ssl {
 namespace detail {
 
+// Whether the lowest layer of a stream is a socket that the engine may use
+// for its own I/O.
+template <typename Stream>
+struct lowest_layer_is_socket
+  : integral_constant<bool, is_base_of<socket_base,
+      typename Stream::lowest_layer_type>::value>
+{
+};
+
+// Whether the engine performs its own I/O on the stream's lowest layer.
+template <typename Stream>
+inline bool uses_socket(stream_core& core)
+{
+  return lowest_layer_is_socket<Stream>::value && core.engine_.uses_socket();
+}
+
+template <typename Stream>
+inline void wait_for_socket(Stream& next_layer,
+    socket_base::wait_type w, asio::error_code& ec, true_type)
+{
+  next_layer.lowest_layer().wait(w, ec);
+}
+
+template <typename Stream>
+inline void wait_for_socket(Stream&,
+    socket_base::wait_type, asio::error_code& ec, false_type)
+{
+  // Not reached, as the engine only uses a socket for its I/O when the lowest
+  // layer is one.
+  ec = asio::error::operation_not_supported;
+}
+
+template <typename Stream, typename Handler>
+inline void async_wait_for_socket(Stream& next_layer,
+    socket_base::wait_type w, Handler& handler, true_type)
+{
+  next_layer.lowest_layer().async_wait(w,
+      ASIO_MOVE_CAST(Handler)(handler));
+}
+
+template <typename Stream, typename Handler>
+inline void async_wait_for_socket(Stream&,
+    socket_base::wait_type, Handler&, false_type)
+{
+  // Not reached, as the engine only uses a socket for its I/O when the lowest
+  // layer is one.
+}
+
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+// Wait for the engine's paused asynchronous job. If the job cannot be waited
+// on, the operation is simply retried.
+inline void wait_for_async_job(stream_core& core, asio::error_code& ec)
+{
+  if (core.begin_async_job_wait(core.engine_.async_job_fd(), ec))
+  {
+    core.async_job_descriptor_.wait(
+        posix::descriptor_base::wait_read, ec);
+  }
+  core.end_async_job_wait();
+}
+
+template <typename Handler>
+inline void async_wait_for_async_job(stream_core& core, Handler& handler)
+{
+  asio::error_code ec;
+  if (core.begin_async_job_wait(core.engine_.async_job_fd(), ec))
+  {
+    core.async_job_descriptor_.async_wait(
+        posix::descriptor_base::wait_read,
+        ASIO_MOVE_CAST(Handler)(handler));
+  }
+  else
+  {
+    asio::post(core.async_job_descriptor_.get_executor(),
+        asio::detail::bind_handler(
+          ASIO_MOVE_CAST(Handler)(handler), ec));
+  }
+}
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
+
 template <typename Stream, typename Operation>
 std::size_t io(Stream& next_layer, stream_core& core,
     const Operation& op, asio::error_code& ec)
@@ -39,6 +123,19 @@ std::size_t io(Stream& next_layer, stream_core& core,
   {
   case engine::want_input_and_retry:
 
+    // If the engine reads from the socket itself then we need to wait until
+    // the socket is readable.
+    if (uses_socket<Stream>(core))
+    {
+      wait_for_socket(next_layer, socket_base::wait_read,
+          io_ec, lowest_layer_is_socket<Stream>());
+      if (!ec)
+        ec = io_ec;
+
+      // Try the operation again.
+      continue;
+    }
+
     // If the input buffer is empty then we need to read some more data from
     // the underlying transport.
     if (core.input_.size() == 0)
@@ -57,10 +154,24 @@ std::size_t io(Stream& next_layer, stream_core& core,
 
   case engine::want_output_and_retry:
 
+    // If the engine writes to the socket itself then we need to wait until
+    // the socket is writable.
+    if (uses_socket<Stream>(core))
+    {
+      wait_for_socket(next_layer, socket_base::wait_write,
+          io_ec, lowest_layer_is_socket<Stream>());
+      if (!ec)
+        ec = io_ec;
+
+      // Try the operation again.
+      continue;
+    }
+
     // Get output data from the engine and write it to the underlying
     // transport.
     asio::write(next_layer,
         core.engine_.get_output(core.output_buffer_), io_ec);
+    core.engine_.release_output();
     if (!ec)
       ec = io_ec;
 
@@ -73,6 +184,7 @@ std::size_t io(Stream& next_layer, stream_core& core,
     // transport.
     asio::write(next_layer,
         core.engine_.get_output(core.output_buffer_), io_ec);
+    core.engine_.release_output();
     if (!ec)
       ec = io_ec;
 
@@ -80,6 +192,20 @@ std::size_t io(Stream& next_layer, stream_core& core,
     core.engine_.map_error_code(ec);
     return bytes_transferred;
 
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+  case engine::want_async_and_retry:
+
+    // The engine has paused an asynchronous job, such as a private key
+    // operation offloaded to an engine or provider. Wait until the job's file
+    // descriptor is readable.
+    wait_for_async_job(core, io_ec);
+    if (!ec)
+      ec = io_ec;
+
+    // Try the operation again.
+    continue;
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
+
   default:
 
     // Operation is complete. Return result to caller.
@@ -93,6 +219,59 @@ std::size_t io(Stream& next_layer, stream_core& core,
   return 0;
 }
 
+class handshake_op;
+template <typename ConstBufferSequence> class buffered_handshake_op;
+
+// Whether an operation's engine steps may be performed on the stream's
+// handshake executor. Only the handshake is CPU intensive enough to justify
+// the extra context switches.
+template <typename Operation>
+struct is_handshake_op : false_type
+{
+};
+
+template <>
+struct is_handshake_op<handshake_op> : true_type
+{
+};
+
+template <typename ConstBufferSequence>
+struct is_handshake_op<buffered_handshake_op<ConstBufferSequence> >
+  : true_type
+{
+};
+
+// Performs a single engine step of an io_op on the handshake executor, then
+// passes the io_op back to the stream's executor to act on the result. The
+// stream's executor is kept busy meanwhile so that it does not run out of
+// work.
+template <typename Stream, typename IoOp>
+class io_engine_step
+{
+public:
+  io_engine_step(Stream& next_layer, IoOp& op)
+    : work_(next_layer.get_executor()),
+      op_(ASIO_MOVE_CAST(IoOp)(op))
+  {
+  }
+
+  void operator()()
+  {
+    op_.want_ = op_.op_(op_.core_.engine_,
+        op_.ec_, op_.bytes_transferred_);
+
+    ASIO_HANDLER_LOCATION((__FILE__, __LINE__, "ssl::io_engine_step"));
+
+    asio::post(op_.next_layer_.get_executor(),
+        asio::detail::bind_handler(
+          ASIO_MOVE_CAST(IoOp)(op_), asio::error_code(), 0, 2));
+  }
+
+private:
+  executor_work_guard<typename Stream::executor_type> work_;
+  IoOp op_;
+};
+
 template <typename Stream, typename Operation, typename Handler>
 class io_op
   : public asio::detail::base_from_cancellation_state<Handler>
@@ -145,12 +324,41 @@ public:
   void operator()(asio::error_code ec,
       std::size_t bytes_transferred = ~std::size_t(0), int start = 0)
   {
+    bool engine_stepped = (start == 2);
     switch (start_ = start)
     {
     case 1: // Called after at least one async operation.
+    case 2: // Called after an engine step on the handshake executor.
       do
       {
-        switch (want_ = op_(core_.engine_, ec_, bytes_transferred_))
+        if (engine_stepped)
+        {
+          // The engine step has already been performed, and its result is in
+          // want_. Any further steps are performed as usual.
+          engine_stepped = false;
+        }
+        else if (is_handshake_op<Operation>::value
+            && core_.handshake_executor_)
+        {
+          // Handshake steps are performed on the handshake executor, if the
+          // stream has one, so that they do not hold up other work on the
+          // stream's executor.
+          ASIO_HANDLER_LOCATION((
+                __FILE__, __LINE__, Operation::tracking_name()));
+
+          asio::post(core_.handshake_executor_,
+              io_engine_step<Stream, io_op>(next_layer_, *this));
+
+          // Yield control until the engine step completes. Control resumes at
+          // the "case 2:" label above.
+          return;
+        }
+        else
+        {
+          want_ = op_(core_.engine_, ec_, bytes_transferred_);
+        }
+
+        switch (want_)
         {
         case engine::want_input_and_retry:
 
@@ -162,6 +370,21 @@ public:
             continue;
           }
 
+          // If the engine reads from the socket itself then wait until the
+          // socket is readable. Any number of operations may wait at once.
+          if (uses_socket<Stream>(core_))
+          {
+            ASIO_HANDLER_LOCATION((
+                  __FILE__, __LINE__, Operation::tracking_name()));
+
+            async_wait_for_socket(next_layer_, socket_base::wait_read,
+                *this, lowest_layer_is_socket<Stream>());
+
+            // Yield control until asynchronous operation completes. Control
+            // resumes at the "default:" label below.
+            return;
+          }
+
           // The engine wants more data to be read from input. However, we
           // cannot allow more than one read operation at a time on the
           // underlying transport. The pending_read_ timer's expiry is set to
@@ -195,6 +418,21 @@ public:
         case engine::want_output_and_retry:
         case engine::want_output:
 
+          // If the engine writes to the socket itself then wait until the
+          // socket is writable.
+          if (uses_socket<Stream>(core_))
+          {
+            ASIO_HANDLER_LOCATION((
+                  __FILE__, __LINE__, Operation::tracking_name()));
+
+            async_wait_for_socket(next_layer_, socket_base::wait_write,
+                *this, lowest_layer_is_socket<Stream>());
+
+            // Yield control until asynchronous operation completes. Control
+            // resumes at the "default:" label below.
+            return;
+          }
+
           // The engine wants some data to be written to the output. However, we
           // cannot allow more than one write operation at a time on the
           // underlying transport. The pending_write_ timer's expiry is set to
@@ -225,6 +463,24 @@ public:
           // resumes at the "default:" label below.
           return;
 
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+        case engine::want_async_and_retry:
+
+          // The engine has paused an asynchronous job, such as a private key
+          // operation offloaded to an engine or provider. Wait until the job's
+          // file descriptor is readable, without blocking the thread.
+          {
+            ASIO_HANDLER_LOCATION((
+                  __FILE__, __LINE__, Operation::tracking_name()));
+
+            async_wait_for_async_job(core_, *this);
+          }
+
+          // Yield control until asynchronous operation completes. Control
+          // resumes at the "default:" label below.
+          return;
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
+
         default:
 
           // The SSL operation is done and we can invoke the handler, but we
@@ -232,7 +488,7 @@ public:
           // the async operation's initiating function. In this case we're not
           // allowed to call the handler directly. Instead, issue a zero-sized
           // read so the handler runs "as-if" posted using io_context::post().
-          if (start)
+          if (start == 1)
           {
             ASIO_HANDLER_LOCATION((
                   __FILE__, __LINE__, Operation::tracking_name()));
@@ -254,9 +510,30 @@ public:
 
         default:
         if (bytes_transferred == ~std::size_t(0))
+        {
           bytes_transferred = 0; // Timer cancellation, no data transferred.
-        else if (!ec_)
-          ec_ = ec;
+
+          // A wait on the socket used by the engine may have failed.
+          if (uses_socket<Stream>(core_) && !ec_)
+            ec_ = ec;
+
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+          // As may a wait for a paused asynchronous job.
+          if (want_ == engine::want_async_and_retry && !ec_)
+            ec_ = ec;
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
+        }
+        else
+        {
+          // Output obtained from the engine has now been written to the
+          // transport, so its space may be reused.
+          if (want_ == engine::want_output_and_retry
+              || want_ == engine::want_output)
+            core_.engine_.release_output();
+
+          if (!ec_)
+            ec_ = ec;
+        }
 
         switch (want_)
         {
@@ -295,6 +572,23 @@ public:
           // Try the operation again.
           continue;
 
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+        case engine::want_async_and_retry:
+
+          // This operation no longer needs the job's file descriptor.
+          core_.end_async_job_wait();
+
+          // Check for cancellation before continuing.
+          if (this->cancelled() != cancellation_type::none)
+          {
+            ec_ = asio::error::operation_aborted;
+            break;
+          }
+
+          // Try the operation again.
+          continue;
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
+
         case engine::want_output:
 
           // Release any waiting write operations.
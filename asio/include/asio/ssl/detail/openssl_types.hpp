@@ -31,4 +31,78 @@
 #include <openssl/x509.h>
 #include <openssl/x509v3.h>
 
+// Kernel TLS offload, where OpenSSL has been built with support for it.
+#if !defined(ASIO_HAS_SSL_KERNEL_TLS)
+# if !defined(ASIO_DISABLE_SSL_KERNEL_TLS)
+#  if defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+#   if !defined(ASIO_WINDOWS) && !defined(__CYGWIN__)
+#    define ASIO_HAS_SSL_KERNEL_TLS 1
+#   endif // !defined(ASIO_WINDOWS) && !defined(__CYGWIN__)
+#  endif // defined(SSL_OP_ENABLE_KTLS) && !defined(OPENSSL_NO_KTLS)
+# endif // !defined(ASIO_DISABLE_SSL_KERNEL_TLS)
+#endif // !defined(ASIO_HAS_SSL_KERNEL_TLS)
+
+// Asynchronous jobs, which let private key operations that are offloaded to an
+// engine or provider pause the handshake until their file descriptor is ready.
+#if !defined(ASIO_HAS_SSL_ASYNC_JOBS)
+# if !defined(ASIO_DISABLE_SSL_ASYNC_JOBS)
+#  if defined(SSL_MODE_ASYNC) && !defined(OPENSSL_NO_ASYNC)
+#   if defined(ASIO_HAS_POSIX_STREAM_DESCRIPTOR)
+#    define ASIO_HAS_SSL_ASYNC_JOBS 1
+#   endif // defined(ASIO_HAS_POSIX_STREAM_DESCRIPTOR)
+#  endif // defined(SSL_MODE_ASYNC) && !defined(OPENSSL_NO_ASYNC)
+# endif // !defined(ASIO_DISABLE_SSL_ASYNC_JOBS)
+#endif // !defined(ASIO_HAS_SSL_ASYNC_JOBS)
+
+// Custom BIO methods, which let the engine exchange data with the transport
+// buffers directly rather than through a BIO pair.
+#if !defined(ASIO_HAS_SSL_CUSTOM_BIO)
+# if !defined(ASIO_DISABLE_SSL_CUSTOM_BIO)
+#  if (OPENSSL_VERSION_NUMBER >= 0x10100000L) && !defined(ASIO_USE_WOLFSSL)
+#   if !defined(LIBRESSL_VERSION_NUMBER) \
+     || (LIBRESSL_VERSION_NUMBER >= 0x2070000fL)
+#    define ASIO_HAS_SSL_CUSTOM_BIO 1
+#   endif // !defined(LIBRESSL_VERSION_NUMBER)
+          //   || (LIBRESSL_VERSION_NUMBER >= 0x2070000fL)
+#  endif // (OPENSSL_VERSION_NUMBER >= 0x10100000L)
+         //   && !defined(ASIO_USE_WOLFSSL)
+# endif // !defined(ASIO_DISABLE_SSL_CUSTOM_BIO)
+#endif // !defined(ASIO_HAS_SSL_CUSTOM_BIO)
+
+// Datagram TLS, which needs the custom BIO methods to keep the boundaries of
+// the datagrams exchanged with the transport.
+#if !defined(ASIO_HAS_SSL_DTLS)
+# if !defined(ASIO_DISABLE_SSL_DTLS)
+#  if defined(ASIO_HAS_SSL_CUSTOM_BIO) && !defined(OPENSSL_NO_DTLS)
+#   if !defined(LIBRESSL_VERSION_NUMBER)
+#    define ASIO_HAS_SSL_DTLS 1
+#   endif // !defined(LIBRESSL_VERSION_NUMBER)
+#  endif // defined(ASIO_HAS_SSL_CUSTOM_BIO) && !defined(OPENSSL_NO_DTLS)
+# endif // !defined(ASIO_DISABLE_SSL_DTLS)
+#endif // !defined(ASIO_HAS_SSL_DTLS)
+
+// Session resumption support, which keeps client sessions in a cache attached
+// to the context and encrypts server session tickets with rotated keys.
+#if !defined(ASIO_HAS_SSL_SESSION_CACHE)
+# if !defined(ASIO_DISABLE_SSL_SESSION_CACHE)
+#  if (OPENSSL_VERSION_NUMBER >= 0x10100000L) && !defined(ASIO_USE_WOLFSSL)
+#   if !defined(LIBRESSL_VERSION_NUMBER) \
+     || (LIBRESSL_VERSION_NUMBER >= 0x2070000fL)
+#    define ASIO_HAS_SSL_SESSION_CACHE 1
+#   endif // !defined(LIBRESSL_VERSION_NUMBER)
+          //   || (LIBRESSL_VERSION_NUMBER >= 0x2070000fL)
+#  endif // (OPENSSL_VERSION_NUMBER >= 0x10100000L)
+         //   && !defined(ASIO_USE_WOLFSSL)
+# endif // !defined(ASIO_DISABLE_SSL_SESSION_CACHE)
+#endif // !defined(ASIO_HAS_SSL_SESSION_CACHE)
+
+#if defined(ASIO_HAS_SSL_SESSION_CACHE)
+# include <openssl/rand.h>
+# if (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+#  include <openssl/core_names.h>
+# else // (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+#  include <openssl/hmac.h>
+# endif // (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+#endif // defined(ASIO_HAS_SSL_SESSION_CACHE)
+
 #endif // ASIO_SSL_DETAIL_OPENSSL_TYPES_HPP
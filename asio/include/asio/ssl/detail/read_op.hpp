@@ -17,7 +17,7 @@
 
 #include "asio/detail/config.hpp"
 
-#include "asio/detail/buffer_sequence_adapter.hpp"
+#include "asio/buffer.hpp"
 #include "asio/ssl/detail/engine.hpp"
 
 #include "asio/detail/push_options.hpp"
@@ -44,11 +44,8 @@ public:
       asio::error_code& ec,
       std::size_t& bytes_transferred) const
   {
-    asio::mutable_buffer buffer =
-      asio::detail::buffer_sequence_adapter<asio::mutable_buffer,
-        MutableBufferSequence>::first(buffers_);
-
-    return eng.read(buffer, ec, bytes_transferred);
+    return read(eng, asio::buffer_sequence_begin(buffers_),
+        asio::buffer_sequence_end(buffers_), ec, bytes_transferred);
   }
 
   template <typename Handler>
@@ -60,6 +57,43 @@ public:
   }
 
 private:
+  template <typename Iterator>
+  static engine::want read(engine& eng, Iterator begin, Iterator end,
+      asio::error_code& ec, std::size_t& bytes_transferred)
+  {
+    // Read a record into the first non-empty buffer.
+    Iterator iter = begin;
+    asio::mutable_buffer buffer;
+    while (iter != end && buffer.size() == 0)
+      buffer = asio::mutable_buffer(*iter++);
+
+    engine::want want = eng.read(buffer, ec, bytes_transferred);
+
+    // Decrypt any further records that have already been received into the
+    // rest of the buffer sequence, so that a large read is not completed one
+    // record at a time.
+    buffer += bytes_transferred;
+    while (want == engine::want_nothing && !ec && bytes_transferred > 0)
+    {
+      if (buffer.size() == 0)
+      {
+        if (iter == end)
+          break;
+        buffer = asio::mutable_buffer(*iter++);
+        continue;
+      }
+
+      std::size_t n = 0;
+      want = eng.read_more(buffer, n);
+      bytes_transferred += n;
+      buffer += n;
+      if (n == 0)
+        break;
+    }
+
+    return want;
+  }
+
   MutableBufferSequence buffers_;
 };
 
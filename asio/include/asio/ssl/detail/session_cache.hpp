@@ -0,0 +1,185 @@
+//
+// ssl/detail/session_cache.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_SSL_DETAIL_SESSION_CACHE_HPP
+#define ASIO_SSL_DETAIL_SESSION_CACHE_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+#include "asio/ssl/detail/openssl_types.hpp"
+
+#if defined(ASIO_HAS_SSL_SESSION_CACHE)
+
+#include <cstddef>
+#include <list>
+#include <map>
+#include <string>
+#include <vector>
+#include "asio/buffer.hpp"
+#include "asio/detail/mutex.hpp"
+#include "asio/detail/noncopyable.hpp"
+#include "asio/error_code.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace ssl {
+namespace detail {
+
+// Session resumption state that is attached to an SSL_CTX. Clients keep the
+// sessions they establish, keyed by host or endpoint, and resume them on
+// later connections. Servers encrypt session tickets with keys that are
+// rotated by the application.
+class session_cache
+  : private asio::detail::noncopyable
+{
+public:
+  // The size of a session ticket key: a 16 byte name, followed by a 32 byte
+  // HMAC key and a 32 byte AES key.
+  enum { ticket_key_size = 80 };
+
+  // The number of sessions kept for each host or endpoint, so that several
+  // connections to it may be resumed at once.
+  enum { max_sessions_per_entry = 4 };
+
+  // Counters for the outcomes of session resumption.
+  struct counters
+  {
+    // Client handshakes that resumed a session, and those that did not.
+    std::size_t hits;
+    std::size_t misses;
+
+    // Session tickets presented to a server that were encrypted with one of
+    // its keys, and those that were not.
+    std::size_t ticket_hits;
+    std::size_t ticket_misses;
+  };
+
+  // Get the cache attached to a context, or 0 if there is none.
+  ASIO_DECL static session_cache* get(SSL_CTX* ctx);
+
+  // Get the cache attached to a context, attaching a new one if required.
+  ASIO_DECL static session_cache* get_or_create(SSL_CTX* ctx);
+
+  // Keep the sessions established by clients using the context, for up to the
+  // specified number of hosts or endpoints.
+  ASIO_DECL void enable_client_cache(SSL_CTX* ctx, std::size_t max_entries);
+
+  // Start encrypting session tickets with a new key. Tickets encrypted with
+  // the previous key are still accepted, and are renewed.
+  ASIO_DECL asio::error_code rotate_ticket_key(SSL_CTX* ctx,
+      const asio::const_buffer& key, asio::error_code& ec);
+
+  // Get a snapshot of the counters.
+  ASIO_DECL counters get_counters();
+
+  // Set the key under which a client's sessions are cached. By default the
+  // server name sent in the handshake is used.
+  ASIO_DECL static void set_key(SSL* ssl, const std::string& key);
+
+  // Prepare a client to resume a cached session, if there is one. Must be
+  // called before the handshake starts.
+  ASIO_DECL static void resume(SSL* ssl);
+
+  // Record the outcome of a completed client handshake.
+  ASIO_DECL static void handshake_complete(SSL* ssl);
+
+private:
+  // A session ticket key.
+  struct ticket_key
+  {
+    unsigned char name[16];
+    unsigned char hmac_key[32];
+    unsigned char aes_key[32];
+  };
+
+  // The sessions cached for one host or endpoint, most recent last.
+  struct entry
+  {
+    std::vector<SSL_SESSION*> sessions;
+    std::list<std::string>::iterator lru;
+  };
+
+  typedef std::map<std::string, entry> entry_map;
+
+  ASIO_DECL session_cache();
+  ASIO_DECL ~session_cache();
+
+  // Add a client's session to the cache, which takes ownership of the
+  // caller's reference to it. The caller must hold the lock.
+  ASIO_DECL void add(const std::string& key, SSL_SESSION* session);
+
+  // Determine whether a cached session may still be resumed.
+  ASIO_DECL static bool is_resumable(SSL_SESSION* session);
+
+  // Get the key under which a client's sessions are cached.
+  ASIO_DECL static std::string key_for(SSL* ssl);
+
+  // Get the index of the cache in a context's extra data.
+  ASIO_DECL static int context_index();
+
+  // Get the index of a client's cache key in its extra data.
+  ASIO_DECL static int key_index();
+
+  // Callbacks used to free the extra data.
+  ASIO_DECL static void free_cache(void* parent, void* ptr,
+      CRYPTO_EX_DATA* ad, int index, long argl, void* argp);
+  ASIO_DECL static void free_key(void* parent, void* ptr,
+      CRYPTO_EX_DATA* ad, int index, long argl, void* argp);
+
+  // Callback used when a client receives a new session.
+  ASIO_DECL static int new_session_callback(SSL* ssl, SSL_SESSION* session);
+
+  // Callback used when a server encrypts or decrypts a session ticket.
+#if (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+  ASIO_DECL static int ticket_key_callback(SSL* ssl, unsigned char* name,
+      unsigned char* iv, EVP_CIPHER_CTX* cipher_ctx,
+      EVP_MAC_CTX* mac_ctx, int enc);
+#else // (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+  ASIO_DECL static int ticket_key_callback(SSL* ssl, unsigned char* name,
+      unsigned char* iv, EVP_CIPHER_CTX* cipher_ctx,
+      HMAC_CTX* hmac_ctx, int enc);
+#endif // (OPENSSL_VERSION_NUMBER >= 0x30000000L)
+
+  // Mutex to protect access to internal data.
+  asio::detail::mutex mutex_;
+
+  // The maximum number of hosts or endpoints with cached sessions, or 0 if
+  // the client cache is not enabled.
+  std::size_t max_entries_;
+
+  // The cached sessions, and their keys from most to least recently used.
+  entry_map entries_;
+  std::list<std::string> lru_;
+
+  // The current ticket key, followed by the previous one.
+  ticket_key ticket_keys_[2];
+  std::size_t ticket_key_count_;
+
+  // The outcomes of session resumption so far.
+  counters counters_;
+};
+
+} // namespace detail
+} // namespace ssl
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#if defined(ASIO_HEADER_ONLY)
+# include "asio/ssl/detail/impl/session_cache.ipp"
+#endif // defined(ASIO_HEADER_ONLY)
+
+#endif // defined(ASIO_HAS_SSL_SESSION_CACHE)
+
+#endif // ASIO_SSL_DETAIL_SESSION_CACHE_HPP
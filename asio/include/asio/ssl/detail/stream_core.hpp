@@ -22,8 +22,14 @@
 #else // defined(ASIO_HAS_BOOST_DATE_TIME)
 # include "asio/steady_timer.hpp"
 #endif // defined(ASIO_HAS_BOOST_DATE_TIME)
+#include <vector>
 #include "asio/ssl/detail/engine.hpp"
+#include "asio/any_io_executor.hpp"
 #include "asio/buffer.hpp"
+#include "asio/error.hpp"
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+# include "asio/posix/stream_descriptor.hpp"
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
 
 #include "asio/detail/push_options.hpp"
 
@@ -46,9 +52,15 @@ struct stream_core
       output_buffer_(asio::buffer(output_buffer_space_)),
       input_buffer_space_(max_tls_record_size),
       input_buffer_(asio::buffer(input_buffer_space_))
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+      , async_job_descriptor_(ex),
+      async_job_waiters_(0)
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
   {
     pending_read_.expires_at(neg_infin());
     pending_write_.expires_at(neg_infin());
+    asio::error_code ec;
+    engine_.set_buffers(input_buffer_, output_buffer_, ec);
   }
 
   template <typename Executor>
@@ -60,9 +72,15 @@ struct stream_core
       output_buffer_(asio::buffer(output_buffer_space_)),
       input_buffer_space_(max_tls_record_size),
       input_buffer_(asio::buffer(input_buffer_space_))
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+      , async_job_descriptor_(ex),
+      async_job_waiters_(0)
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
   {
     pending_read_.expires_at(neg_infin());
     pending_write_.expires_at(neg_infin());
+    asio::error_code ec;
+    engine_.set_buffers(input_buffer_, output_buffer_, ec);
   }
 
 #if defined(ASIO_HAS_MOVE)
@@ -91,8 +109,23 @@ struct stream_core
           ASIO_MOVE_CAST(std::vector<unsigned char>)(
             other.input_buffer_space_)),
       input_buffer_(other.input_buffer_),
-      input_(other.input_)
+      input_(other.input_),
+      write_buffer_space_(
+          ASIO_MOVE_CAST(std::vector<unsigned char>)(
+            other.write_buffer_space_)),
+      handshake_executor_(
+          ASIO_MOVE_CAST(any_io_executor)(
+            other.handshake_executor_))
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+      , async_job_descriptor_(
+          ASIO_MOVE_CAST(asio::posix::stream_descriptor)(
+            other.async_job_descriptor_)),
+      async_job_waiters_(other.async_job_waiters_)
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
   {
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+    other.async_job_waiters_ = 0;
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
     other.output_buffer_ = asio::mutable_buffer(0, 0);
     other.input_buffer_ = asio::mutable_buffer(0, 0);
     other.input_ = asio::const_buffer(0, 0);
@@ -101,6 +134,11 @@ struct stream_core
 
   ~stream_core()
   {
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+    // The file descriptor is owned by the SSL implementation.
+    if (async_job_descriptor_.is_open())
+      async_job_descriptor_.release();
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
   }
 
 #if defined(ASIO_HAS_MOVE)
@@ -133,6 +171,21 @@ struct stream_core
           other.input_buffer_space_);
       input_buffer_ = other.input_buffer_;
       input_ = other.input_;
+      write_buffer_space_ =
+        ASIO_MOVE_CAST(std::vector<unsigned char>)(
+          other.write_buffer_space_);
+      handshake_executor_ =
+        ASIO_MOVE_CAST(any_io_executor)(
+          other.handshake_executor_);
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+      if (async_job_descriptor_.is_open())
+        async_job_descriptor_.release();
+      async_job_descriptor_ =
+        ASIO_MOVE_CAST(asio::posix::stream_descriptor)(
+          other.async_job_descriptor_);
+      async_job_waiters_ = other.async_job_waiters_;
+      other.async_job_waiters_ = 0;
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
       other.output_buffer_ = asio::mutable_buffer(0, 0);
       other.input_buffer_ = asio::mutable_buffer(0, 0);
       other.input_ = asio::const_buffer(0, 0);
@@ -141,6 +194,71 @@ struct stream_core
   }
 #endif // defined(ASIO_HAS_MOVE)
 
+  // Replace the buffers used to exchange data with the transport. Fails if
+  // either buffer holds data that has not yet been consumed.
+  asio::error_code set_buffer_sizes(std::size_t input_size,
+      std::size_t output_size, asio::error_code& ec)
+  {
+    if (input_size == 0 || output_size == 0)
+    {
+      ec = asio::error::invalid_argument;
+      return ec;
+    }
+
+    if (input_.size() != 0)
+    {
+      ec = asio::error::in_progress;
+      return ec;
+    }
+
+#if !defined(ASIO_HAS_SSL_CUSTOM_BIO)
+    // Output is copied out of a BIO pair, which must be drained in one go.
+    if (output_size < max_tls_record_size)
+      output_size = max_tls_record_size;
+#endif // !defined(ASIO_HAS_SSL_CUSTOM_BIO)
+
+    std::vector<unsigned char> input_buffer_space(input_size);
+    std::vector<unsigned char> output_buffer_space(output_size);
+    if (engine_.set_buffers(asio::buffer(input_buffer_space),
+          asio::buffer(output_buffer_space), ec))
+      return ec;
+
+    // Swapping the vectors leaves the engine's view of the storage intact.
+    input_buffer_space_.swap(input_buffer_space);
+    input_buffer_ = asio::buffer(input_buffer_space_);
+    output_buffer_space_.swap(output_buffer_space);
+    output_buffer_ = asio::buffer(output_buffer_space_);
+    return ec;
+  }
+
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+  // Start waiting for a paused asynchronous job, given the job's file
+  // descriptor. A read and a write may both be paused on the same job, in
+  // which case they share the descriptor. Returns true if the descriptor may be
+  // waited on. Otherwise the operation should simply be retried. Every call
+  // must be matched by a call to end_async_job_wait().
+  bool begin_async_job_wait(int fd, asio::error_code& ec)
+  {
+    ++async_job_waiters_;
+    if (fd == -1)
+      return false;
+    if (!async_job_descriptor_.is_open())
+      async_job_descriptor_.assign(fd, ec);
+    else if (async_job_descriptor_.native_handle() != fd)
+      return false;
+    return !ec;
+  }
+
+  // Finish waiting for a paused asynchronous job. The file descriptor is owned
+  // by the SSL implementation, so it is released rather than closed once no
+  // operations are waiting on it.
+  void end_async_job_wait()
+  {
+    if (--async_job_waiters_ == 0 && async_job_descriptor_.is_open())
+      async_job_descriptor_.release();
+  }
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
+
   // The SSL engine.
   engine engine_;
 
@@ -210,6 +328,22 @@ struct stream_core
 
   // The buffer pointing to the engine's unconsumed input.
   asio::const_buffer input_;
+
+  // Buffer space used to gather a buffer sequence that is written to the
+  // engine. It is allocated by the first write that needs it.
+  std::vector<unsigned char> write_buffer_space_;
+
+  // The executor on which asynchronous handshake steps are performed, if any.
+  any_io_executor handshake_executor_;
+
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS)
+  // Descriptor used to wait for a paused asynchronous job. It is assigned the
+  // job's file descriptor only while a wait is in progress.
+  asio::posix::stream_descriptor async_job_descriptor_;
+
+  // The number of operations waiting for a paused asynchronous job.
+  std::size_t async_job_waiters_;
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
 };
 
 } // namespace detail
@@ -17,6 +17,7 @@
 
 #include "asio/detail/config.hpp"
 
+#include <vector>
 #include "asio/detail/buffer_sequence_adapter.hpp"
 #include "asio/ssl/detail/engine.hpp"
 
@@ -35,8 +36,10 @@ public:
     return "ssl::stream<>::async_write_some";
   }
 
-  write_op(const ConstBufferSequence& buffers)
-    : buffers_(buffers)
+  write_op(const ConstBufferSequence& buffers,
+      std::vector<unsigned char>& storage)
+    : buffers_(buffers),
+      storage_(storage)
   {
   }
 
@@ -44,13 +47,21 @@ public:
       asio::error_code& ec,
       std::size_t& bytes_transferred) const
   {
-    unsigned char storage[
-      asio::detail::buffer_sequence_adapter<asio::const_buffer,
-        ConstBufferSequence>::linearisation_storage_size];
-
-    asio::const_buffer buffer =
-      asio::detail::buffer_sequence_adapter<asio::const_buffer,
-        ConstBufferSequence>::linearise(buffers_, asio::buffer(storage));
+    typedef asio::detail::buffer_sequence_adapter<
+      asio::const_buffer, ConstBufferSequence> adapter_type;
+
+    // The buffer sequence is gathered into a full-size record, so that, for
+    // example, a small header and a large body fill the first record. A first
+    // buffer that fills a record by itself is encrypted in place instead.
+    asio::const_buffer buffer = adapter_type::first(buffers_);
+    if (!adapter_type::is_single_buffer
+        && buffer.size() < SSL3_RT_MAX_PLAIN_LENGTH)
+    {
+      if (storage_.size() < SSL3_RT_MAX_PLAIN_LENGTH)
+        storage_.resize(SSL3_RT_MAX_PLAIN_LENGTH);
+      buffer = adapter_type::linearise(buffers_,
+          asio::buffer(storage_, SSL3_RT_MAX_PLAIN_LENGTH));
+    }
 
     return eng.write(buffer, ec, bytes_transferred);
   }
@@ -65,6 +76,7 @@ public:
 
 private:
   ConstBufferSequence buffers_;
+  std::vector<unsigned char>& storage_;
 };
 
 } // namespace detail
@@ -22,6 +22,7 @@
 #include "asio/detail/throw_error.hpp"
 #include "asio/error.hpp"
 #include "asio/ssl/context.hpp"
+#include "asio/ssl/detail/session_cache.hpp"
 #include "asio/ssl/error.hpp"
 
 #include "asio/detail/push_options.hpp"
@@ -352,6 +353,61 @@ context::context(context::method m)
     break;
 #endif // (OPENSSL_VERSION_NUMBER >= 0x10100000L)
 
+    // Any supported DTLS version.
+#if defined(ASIO_HAS_SSL_DTLS)
+  case context::dtls:
+    handle_ = ::SSL_CTX_new(::DTLS_method());
+    if (handle_)
+      SSL_CTX_set_min_proto_version(handle_, DTLS1_VERSION);
+    break;
+  case context::dtls_client:
+    handle_ = ::SSL_CTX_new(::DTLS_client_method());
+    if (handle_)
+      SSL_CTX_set_min_proto_version(handle_, DTLS1_VERSION);
+    break;
+  case context::dtls_server:
+    handle_ = ::SSL_CTX_new(::DTLS_server_method());
+    if (handle_)
+      SSL_CTX_set_min_proto_version(handle_, DTLS1_VERSION);
+    break;
+
+    // DTLS v1.2.
+  case context::dtlsv12:
+    handle_ = ::SSL_CTX_new(::DTLS_method());
+    if (handle_)
+    {
+      SSL_CTX_set_min_proto_version(handle_, DTLS1_2_VERSION);
+      SSL_CTX_set_max_proto_version(handle_, DTLS1_2_VERSION);
+    }
+    break;
+  case context::dtlsv12_client:
+    handle_ = ::SSL_CTX_new(::DTLS_client_method());
+    if (handle_)
+    {
+      SSL_CTX_set_min_proto_version(handle_, DTLS1_2_VERSION);
+      SSL_CTX_set_max_proto_version(handle_, DTLS1_2_VERSION);
+    }
+    break;
+  case context::dtlsv12_server:
+    handle_ = ::SSL_CTX_new(::DTLS_server_method());
+    if (handle_)
+    {
+      SSL_CTX_set_min_proto_version(handle_, DTLS1_2_VERSION);
+      SSL_CTX_set_max_proto_version(handle_, DTLS1_2_VERSION);
+    }
+    break;
+#else // defined(ASIO_HAS_SSL_DTLS)
+  case context::dtls:
+  case context::dtls_client:
+  case context::dtls_server:
+  case context::dtlsv12:
+  case context::dtlsv12_client:
+  case context::dtlsv12_server:
+    asio::detail::throw_error(
+        asio::error::invalid_argument, "context");
+    break;
+#endif // defined(ASIO_HAS_SSL_DTLS)
+
   default:
     handle_ = ::SSL_CTX_new(0);
     break;
@@ -1195,6 +1251,87 @@ ASIO_SYNC_OP_VOID context::do_use_tmp_dh(
   ASIO_SYNC_OP_VOID_RETURN(ec);
 }
 
+#if defined(ASIO_HAS_SSL_SESSION_CACHE)
+void context::enable_session_cache(std::size_t max_entries)
+{
+  asio::error_code ec;
+  enable_session_cache(max_entries, ec);
+  asio::detail::throw_error(ec, "enable_session_cache");
+}
+
+ASIO_SYNC_OP_VOID context::enable_session_cache(
+    std::size_t max_entries, asio::error_code& ec)
+{
+  detail::session_cache::get_or_create(handle_)->enable_client_cache(
+      handle_, max_entries);
+  ec = asio::error_code();
+  ASIO_SYNC_OP_VOID_RETURN(ec);
+}
+
+void context::rotate_session_ticket_key()
+{
+  asio::error_code ec;
+  rotate_session_ticket_key(ec);
+  asio::detail::throw_error(ec, "rotate_session_ticket_key");
+}
+
+ASIO_SYNC_OP_VOID context::rotate_session_ticket_key(
+    asio::error_code& ec)
+{
+  ::ERR_clear_error();
+
+  unsigned char key[detail::session_cache::ticket_key_size];
+  if (::RAND_bytes(key, sizeof(key)) != 1)
+  {
+    ec = translate_error(::ERR_get_error());
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  rotate_session_ticket_key(asio::buffer(key), ec);
+  ::OPENSSL_cleanse(key, sizeof(key));
+  ASIO_SYNC_OP_VOID_RETURN(ec);
+}
+
+void context::rotate_session_ticket_key(const const_buffer& key)
+{
+  asio::error_code ec;
+  rotate_session_ticket_key(key, ec);
+  asio::detail::throw_error(ec, "rotate_session_ticket_key");
+}
+
+ASIO_SYNC_OP_VOID context::rotate_session_ticket_key(
+    const const_buffer& key, asio::error_code& ec)
+{
+  detail::session_cache::get_or_create(handle_)->rotate_ticket_key(
+      handle_, key, ec);
+  ASIO_SYNC_OP_VOID_RETURN(ec);
+}
+
+std::size_t context::session_cache_hits() const
+{
+  detail::session_cache* cache = detail::session_cache::get(handle_);
+  return cache ? cache->get_counters().hits : 0;
+}
+
+std::size_t context::session_cache_misses() const
+{
+  detail::session_cache* cache = detail::session_cache::get(handle_);
+  return cache ? cache->get_counters().misses : 0;
+}
+
+std::size_t context::session_ticket_hits() const
+{
+  detail::session_cache* cache = detail::session_cache::get(handle_);
+  return cache ? cache->get_counters().ticket_hits : 0;
+}
+
+std::size_t context::session_ticket_misses() const
+{
+  detail::session_cache* cache = detail::session_cache::get(handle_);
+  return cache ? cache->get_counters().ticket_misses : 0;
+}
+#endif // defined(ASIO_HAS_SSL_SESSION_CACHE)
+
 ASIO_SYNC_OP_VOID context::do_set_verify_callback(
     detail::verify_callback_base* callback, asio::error_code& ec)
 {
@@ -23,6 +23,7 @@
 #include "asio/ssl/impl/error.ipp"
 #include "asio/ssl/detail/impl/engine.ipp"
 #include "asio/ssl/detail/impl/openssl_init.ipp"
+#include "asio/ssl/detail/impl/session_cache.ipp"
 #include "asio/ssl/impl/host_name_verification.ipp"
 #include "asio/ssl/impl/rfc2818_verification.ipp"
 
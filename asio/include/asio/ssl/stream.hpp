@@ -403,6 +403,231 @@ public:
     ASIO_SYNC_OP_VOID_RETURN(ec);
   }
 
+  /// Set the sizes of the buffers used to exchange data with the next layer.
+  /**
+   * The stream reads data from the next layer into an input buffer, and writes
+   * data to the next layer from an output buffer. By default, each buffer can
+   * hold the largest possible TLS record. Smaller buffers reduce the memory
+   * used by each stream, such as when a server holds many idle connections,
+   * at the cost of more operations on the next layer for larger records.
+   * Conversely, a larger input buffer lets a single read from the next layer
+   * receive several records, all of which are decrypted by one read operation
+   * on the stream if the buffers passed to it are large enough.
+   *
+   * Must not be called while an operation is in progress on the stream.
+   *
+   * @param input_size The size of the input buffer, in bytes.
+   *
+   * @param output_size The size of the output buffer, in bytes.
+   *
+   * @throws asio::system_error Thrown on failure. Fails with
+   * asio::error::in_progress if either buffer holds data that has not yet
+   * been consumed.
+   *
+   * @note When the SSL implementation does not support custom BIO methods, the
+   * output buffer is never made smaller than the largest possible TLS record.
+   */
+  void set_buffer_sizes(std::size_t input_size, std::size_t output_size)
+  {
+    asio::error_code ec;
+    set_buffer_sizes(input_size, output_size, ec);
+    asio::detail::throw_error(ec, "set_buffer_sizes");
+  }
+
+  /// Set the sizes of the buffers used to exchange data with the next layer.
+  /**
+   * The stream reads data from the next layer into an input buffer, and writes
+   * data to the next layer from an output buffer. By default, each buffer can
+   * hold the largest possible TLS record. Smaller buffers reduce the memory
+   * used by each stream, such as when a server holds many idle connections,
+   * at the cost of more operations on the next layer for larger records.
+   * Conversely, a larger input buffer lets a single read from the next layer
+   * receive several records, all of which are decrypted by one read operation
+   * on the stream if the buffers passed to it are large enough.
+   *
+   * Must not be called while an operation is in progress on the stream.
+   *
+   * @param input_size The size of the input buffer, in bytes.
+   *
+   * @param output_size The size of the output buffer, in bytes.
+   *
+   * @param ec Set to indicate what error occurred, if any. Set to
+   * asio::error::in_progress if either buffer holds data that has not yet
+   * been consumed.
+   *
+   * @note When the SSL implementation does not support custom BIO methods, the
+   * output buffer is never made smaller than the largest possible TLS record.
+   */
+  ASIO_SYNC_OP_VOID set_buffer_sizes(std::size_t input_size,
+      std::size_t output_size, asio::error_code& ec)
+  {
+    core_.set_buffer_sizes(input_size, output_size, ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+#if defined(ASIO_HAS_SSL_KERNEL_TLS) \
+  || defined(GENERATING_DOCUMENTATION)
+  /// Use kernel TLS for the stream.
+  /**
+   * This function makes the SSL implementation read from and write to the
+   * lowest layer's socket directly, and enables OpenSSL's kernel TLS support
+   * with @c SSL_OP_ENABLE_KTLS. The handshake and shutdown are performed in
+   * user space as usual. Once the session is established, OpenSSL hands record
+   * encryption and decryption to the kernel where the kernel supports the
+   * negotiated cipher suite, such as the AES-GCM suites. Otherwise the stream
+   * continues to work, with OpenSSL encrypting records itself.
+   *
+   * Must be called after the lowest layer has been opened and before the
+   * handshake. The socket is put into non-blocking mode with
+   * @c native_non_blocking.
+   *
+   * @throws asio::system_error Thrown on failure.
+   *
+   * @note A handshake that is passed data that has already been read from the
+   * socket fails with asio::error::operation_not_supported.
+   */
+  void use_kernel_tls()
+  {
+    asio::error_code ec;
+    use_kernel_tls(ec);
+    asio::detail::throw_error(ec, "use_kernel_tls");
+  }
+
+  /// Use kernel TLS for the stream.
+  /**
+   * This function makes the SSL implementation read from and write to the
+   * lowest layer's socket directly, and enables OpenSSL's kernel TLS support
+   * with @c SSL_OP_ENABLE_KTLS. The handshake and shutdown are performed in
+   * user space as usual. Once the session is established, OpenSSL hands record
+   * encryption and decryption to the kernel where the kernel supports the
+   * negotiated cipher suite, such as the AES-GCM suites. Otherwise the stream
+   * continues to work, with OpenSSL encrypting records itself.
+   *
+   * Must be called after the lowest layer has been opened and before the
+   * handshake. The socket is put into non-blocking mode with
+   * @c native_non_blocking.
+   *
+   * @param ec Set to indicate what error occurred, if any.
+   *
+   * @note A handshake that is passed data that has already been read from the
+   * socket fails with asio::error::operation_not_supported.
+   */
+  ASIO_SYNC_OP_VOID use_kernel_tls(asio::error_code& ec)
+  {
+    lowest_layer_type& socket = next_layer_.lowest_layer();
+    if (!socket.is_open())
+    {
+      ec = asio::error::bad_descriptor;
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+    }
+
+    socket.native_non_blocking(true, ec);
+    if (ec)
+    {
+      ASIO_SYNC_OP_VOID_RETURN(ec);
+    }
+
+    core_.engine_.use_kernel_tls(socket.native_handle(), ec);
+    ASIO_SYNC_OP_VOID_RETURN(ec);
+  }
+
+  /// Determine whether the kernel encrypts records written to the stream.
+  /**
+   * When this function returns @c true, data written to the stream is passed
+   * to the lowest layer's socket directly. The lowest layer may then also be
+   * used for other operations that write to the socket, such as
+   * asio::async_sendfile, with the kernel encrypting the data.
+   */
+  bool kernel_tls_send() const
+  {
+    return core_.engine_.kernel_tls_send();
+  }
+
+  /// Determine whether the kernel decrypts records read from the stream.
+  bool kernel_tls_receive() const
+  {
+    return core_.engine_.kernel_tls_receive();
+  }
+#endif // defined(ASIO_HAS_SSL_KERNEL_TLS)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+  /// Set the executor used to perform the work of asynchronous handshakes.
+  /**
+   * The key exchange, signing and certificate verification performed during a
+   * handshake can take a significant amount of CPU time. When a handshake
+   * executor is set, each step of an asynchronous handshake that runs the SSL
+   * implementation is submitted to that executor, such as a
+   * asio::thread_pool's executor, so that the handshake does not hold up
+   * other work on the stream's executor. Operations on the next layer are
+   * still started from the stream's executor.
+   *
+   * Must not be called while a handshake is in progress on the stream.
+   *
+   * @param ex The executor to use, or a default constructed
+   * asio::any_io_executor to perform handshakes on the stream's executor.
+   *
+   * @note Any verification callback is called on the handshake executor.
+   * Synchronous handshakes are not affected.
+   */
+  void set_handshake_executor(const any_io_executor& ex)
+  {
+    core_.handshake_executor_ = ex;
+  }
+
+#if defined(ASIO_HAS_SSL_SESSION_CACHE) \
+  || defined(GENERATING_DOCUMENTATION)
+  /// Set the key under which the stream's sessions are cached.
+  /**
+   * When the context's session cache is enabled, a client handshake resumes a
+   * session that was cached under the same key by an earlier stream, if there
+   * is one. By default, the server name that the stream sends in its handshake
+   * is used as the key. Another key, such as the remote endpoint, may be used
+   * to distinguish servers that share a name, or to cache the sessions of
+   * streams that do not send a name.
+   *
+   * Must be called before the handshake.
+   *
+   * @param key The key, which identifies the host or endpoint to which the
+   * stream connects.
+   */
+  void set_session_cache_key(const std::string& key)
+  {
+    core_.engine_.set_session_cache_key(key);
+  }
+#endif // defined(ASIO_HAS_SSL_SESSION_CACHE)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#if defined(ASIO_HAS_SSL_ASYNC_JOBS) \
+  || defined(GENERATING_DOCUMENTATION)
+  /// Enable or disable asynchronous jobs for the stream's SSL operations.
+  /**
+   * When asynchronous jobs are enabled, the SSL implementation runs each
+   * operation in a job that an engine or provider may pause, for example while
+   * a private key operation is performed by a hardware accelerator or by a
+   * batching service. The stream then waits for the job's file descriptor to
+   * become readable, using the stream's executor for asynchronous operations,
+   * before resuming the job.
+   *
+   * This corresponds to OpenSSL's @c SSL_MODE_ASYNC mode, which may also be
+   * enabled for all streams using a context by calling @c SSL_CTX_set_mode on
+   * the context's native handle. It has no effect unless the private key is
+   * held by an engine or provider that supports asynchronous jobs.
+   *
+   * Must not be called while an operation is in progress on the stream.
+   *
+   * @param enabled Whether asynchronous jobs are enabled.
+   *
+   * @note A paused job must be resumed by the same kind of operation that
+   * started it, so the application should not start a read or write on the
+   * stream while an asynchronous handshake is in progress.
+   */
+  void set_async_mode(bool enabled)
+  {
+    core_.engine_.set_async_mode(enabled);
+  }
+#endif // defined(ASIO_HAS_SSL_ASYNC_JOBS)
+       //   || defined(GENERATING_DOCUMENTATION)
+
   /// Perform SSL handshaking.
   /**
    * This function is used to perform SSL handshaking on the stream. The
@@ -718,8 +943,14 @@ public:
   std::size_t write_some(const ConstBufferSequence& buffers,
       asio::error_code& ec)
   {
+#if defined(ASIO_HAS_SSL_KERNEL_TLS)
+    if (core_.engine_.kernel_tls_send())
+      return next_layer_.write_some(buffers, ec);
+#endif // defined(ASIO_HAS_SSL_KERNEL_TLS)
+
     return detail::io(next_layer_, core_,
-        detail::write_op<ConstBufferSequence>(buffers), ec);
+        detail::write_op<ConstBufferSequence>(
+          buffers, core_.write_buffer_space_), ec);
   }
 
   /// Start an asynchronous write.
@@ -1021,8 +1252,21 @@ private:
       ASIO_WRITE_HANDLER_CHECK(WriteHandler, handler) type_check;
 
       asio::detail::non_const_lvalue<WriteHandler> handler2(handler);
+
+#if defined(ASIO_HAS_SSL_KERNEL_TLS)
+      // The kernel encrypts the data, so it may be written directly.
+      if (self_->core_.engine_.kernel_tls_send())
+      {
+        self_->next_layer_.async_write_some(buffers,
+            ASIO_MOVE_CAST(typename decay<WriteHandler>::type)(
+              handler2.value));
+        return;
+      }
+#endif // defined(ASIO_HAS_SSL_KERNEL_TLS)
+
       detail::async_io(self_->next_layer_, self_->core_,
-          detail::write_op<ConstBufferSequence>(buffers), handler2.value);
+          detail::write_op<ConstBufferSequence>(
+            buffers, self_->core_.write_buffer_space_), handler2.value);
     }
 
   private:
@@ -0,0 +1,66 @@
+//
+// wheel_wait_traits.hpp
+// ~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_WHEEL_WAIT_TRAITS_HPP
+#define ASIO_WHEEL_WAIT_TRAITS_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_CHRONO) || defined(GENERATING_DOCUMENTATION)
+
+#include "asio/detail/chrono.hpp"
+#include "asio/wait_traits.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+
+/// Wait traits that keep timers in a hierarchical timing wheel.
+/**
+ * Timers that use these traits with the basic_waitable_timer class template
+ * are stored in a hierarchical timing wheel rather than a binary heap.
+ * Scheduling and cancelling a timer take constant time, regardless of how many
+ * timers are outstanding, which suits programs that keep very large numbers of
+ * timers such as a per-connection idle timeout.
+ *
+ * Expiry times are rounded up to a whole number of ticks of the @c Resolution
+ * duration type. A timer never completes before its expiry time, but may
+ * complete up to one tick after it.
+ *
+ * @par Example
+ * @code
+ * typedef asio::basic_waitable_timer<
+ *     asio::chrono::steady_clock,
+ *     asio::wheel_wait_traits<asio::chrono::steady_clock>
+ *   > idle_timer;
+ * @endcode
+ *
+ * @note The timing wheel is selected only when the traits are used directly.
+ * A class derived from wheel_wait_traits uses the binary heap.
+ */
+template <typename Clock, typename Resolution = chrono::milliseconds>
+struct wheel_wait_traits
+  : wait_traits<Clock>
+{
+  /// The duration type, a single tick of which is the wheel's resolution.
+  typedef Resolution resolution_type;
+};
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_CHRONO) || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_WHEEL_WAIT_TRAITS_HPP
@@ -0,0 +1,140 @@
+//
+// zero_copy_receive_buffer.hpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef ASIO_ZERO_COPY_RECEIVE_BUFFER_HPP
+#define ASIO_ZERO_COPY_RECEIVE_BUFFER_HPP
+
+#if defined(_MSC_VER) && (_MSC_VER >= 1200)
+# pragma once
+#endif // defined(_MSC_VER) && (_MSC_VER >= 1200)
+
+#include "asio/detail/config.hpp"
+
+#if defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE) \
+  || defined(GENERATING_DOCUMENTATION)
+
+#include <cstddef>
+#include <unistd.h>
+#include "asio/buffer.hpp"
+#include "asio/detail/socket_ops.hpp"
+#include "asio/detail/socket_types.hpp"
+
+#include "asio/detail/push_options.hpp"
+
+namespace asio {
+namespace detail {
+
+class zero_copy_receive_engine;
+
+} // namespace detail
+
+/// Holds the data received by a zero-copy receive operation.
+/**
+ * The zero_copy_receive_buffer class is used with
+ * basic_stream_socket::async_receive_zero_copy to receive data from a TCP
+ * socket without copying it from the kernel's socket buffers. Whole pages of
+ * received data are mapped read-only into a region of the buffer's address
+ * space, using the @c TCP_ZEROCOPY_RECEIVE socket option. Data that cannot be
+ * mapped, such as a tail that does not fill a page, is copied into a smaller
+ * internal buffer instead.
+ *
+ * The data received by the most recent operation is available from data(). It
+ * remains valid until the next receive operation using the buffer is started,
+ * or the buffer is destroyed. The mapping is created on first use and is tied
+ * to the socket with which it is used, so a buffer should be used with only one
+ * socket at a time.
+ *
+ * @par Thread Safety
+ * @e Distinct @e objects: Safe.@n
+ * @e Shared @e objects: Unsafe.
+ */
+class zero_copy_receive_buffer
+{
+public:
+  /// Construct a buffer.
+  /**
+   * @param map_size The size of the region into which received data is mapped.
+   * This is rounded up to a multiple of the page size, and limits the amount
+   * of data that one operation may receive.
+   *
+   * @param copy_size The size of the buffer into which data that cannot be
+   * mapped is copied.
+   */
+  explicit zero_copy_receive_buffer(std::size_t map_size,
+      std::size_t copy_size = 65536)
+    : socket_(detail::invalid_socket),
+      map_(0),
+      map_size_(round_to_page_size(map_size)),
+      copy_(new char[copy_size ? copy_size : 1]),
+      copy_size_(copy_size ? copy_size : 1),
+      data_()
+  {
+  }
+
+  /// Destructor.
+  ~zero_copy_receive_buffer()
+  {
+    detail::socket_ops::unmap_receive_queue(map_, map_size_);
+    delete[] copy_;
+  }
+
+  /// Get the data received by the most recent operation.
+  asio::const_buffer data() const ASIO_NOEXCEPT
+  {
+    return data_;
+  }
+
+  /// Get the number of bytes received by the most recent operation.
+  std::size_t size() const ASIO_NOEXCEPT
+  {
+    return data_.size();
+  }
+
+  /// Determine whether the most recently received data was mapped.
+  /**
+   * @returns @c true if the data is mapped from the socket's receive queue,
+   * or @c false if it was copied.
+   */
+  bool mapped() const ASIO_NOEXCEPT
+  {
+    return map_ != 0 && data_.data() == map_;
+  }
+
+private:
+  friend class detail::zero_copy_receive_engine;
+
+  // Disallow copying and assignment.
+  zero_copy_receive_buffer(
+      const zero_copy_receive_buffer&) ASIO_DELETED;
+  zero_copy_receive_buffer& operator=(
+      const zero_copy_receive_buffer&) ASIO_DELETED;
+
+  static std::size_t round_to_page_size(std::size_t n)
+  {
+    std::size_t page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return n ? (n + page_size - 1) / page_size * page_size : page_size;
+  }
+
+  detail::socket_type socket_;
+  void* map_;
+  std::size_t map_size_;
+  char* copy_;
+  std::size_t copy_size_;
+  asio::const_buffer data_;
+};
+
+} // namespace asio
+
+#include "asio/detail/pop_options.hpp"
+
+#endif // defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+       //   || defined(GENERATING_DOCUMENTATION)
+
+#endif // ASIO_ZERO_COPY_RECEIVE_BUFFER_HPP
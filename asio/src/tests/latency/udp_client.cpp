@@ -17,19 +17,116 @@
 #include <vector>
 #include "high_res_clock.hpp"
 
+#if defined(ASIO_HAS_MMSG) && defined(ASIO_HAS_SO_TIMESTAMPING)
+# include <time.h>
+#endif // defined(ASIO_HAS_MMSG) && defined(ASIO_HAS_SO_TIMESTAMPING)
+
 using asio::ip::udp;
 using boost::posix_time::ptime;
 using boost::posix_time::microsec_clock;
 
 const int num_samples = 100000;
 
+// Sorts the samples and prints their distribution, scaled to microseconds.
+void print_distribution(boost::uint64_t* samples, double scale)
+{
+  std::sort(samples, samples + num_samples);
+  std::printf("  0.0%%\t%f\n", samples[0] * scale);
+  std::printf("  0.1%%\t%f\n", samples[num_samples / 1000 - 1] * scale);
+  std::printf("  1.0%%\t%f\n", samples[num_samples / 100 - 1] * scale);
+  std::printf(" 10.0%%\t%f\n", samples[num_samples / 10 - 1] * scale);
+  std::printf(" 20.0%%\t%f\n", samples[num_samples * 2 / 10 - 1] * scale);
+  std::printf(" 30.0%%\t%f\n", samples[num_samples * 3 / 10 - 1] * scale);
+  std::printf(" 40.0%%\t%f\n", samples[num_samples * 4 / 10 - 1] * scale);
+  std::printf(" 50.0%%\t%f\n", samples[num_samples * 5 / 10 - 1] * scale);
+  std::printf(" 60.0%%\t%f\n", samples[num_samples * 6 / 10 - 1] * scale);
+  std::printf(" 70.0%%\t%f\n", samples[num_samples * 7 / 10 - 1] * scale);
+  std::printf(" 80.0%%\t%f\n", samples[num_samples * 8 / 10 - 1] * scale);
+  std::printf(" 90.0%%\t%f\n", samples[num_samples * 9 / 10 - 1] * scale);
+  std::printf(" 99.0%%\t%f\n", samples[num_samples * 99 / 100 - 1] * scale);
+  std::printf(" 99.9%%\t%f\n", samples[num_samples * 999 / 1000 - 1] * scale);
+  std::printf("100.0%%\t%f\n", samples[num_samples - 1] * scale);
+
+  double total = 0.0;
+  for (int i = 0; i < num_samples; ++i) total += samples[i] * scale;
+  std::printf("  mean\t%f\n", total / num_samples);
+}
+
+#if defined(ASIO_HAS_MMSG)
+
+// Sends the samples in batches, waiting for every echo of one batch before
+// sending the next, and reports the number of datagrams echoed per second.
+int measure_throughput(udp::socket& socket, udp::endpoint target,
+    unsigned short first_port, unsigned short last_port,
+    std::size_t buf_size, std::size_t batch_size)
+{
+  std::vector<unsigned char> write_buf(buf_size);
+  std::vector<unsigned char> read_buf(buf_size * batch_size);
+  std::vector<udp::socket::message_type> requests(batch_size);
+  std::vector<udp::socket::message_type> replies(batch_size);
+  for (std::size_t i = 0; i < batch_size; ++i)
+  {
+    requests[i].buffer(asio::buffer(write_buf));
+    replies[i].buffer(asio::buffer(&read_buf[i * buf_size], buf_size));
+  }
+
+  int num_batches = std::max<int>(1, num_samples / batch_size);
+
+  ptime start = microsec_clock::universal_time();
+
+  for (int i = 0; i < num_batches; ++i)
+  {
+    for (std::size_t j = 0; j < batch_size; ++j)
+    {
+      requests[j].endpoint(target);
+      if (target.port() == last_port)
+        target.port(first_port);
+      else
+        target.port(target.port() + 1);
+    }
+
+    asio::error_code ec;
+    for (std::size_t sent = 0; sent < batch_size; )
+    {
+      sent += socket.send_many(requests.begin() + sent,
+          requests.end(), 0, ec);
+      if (ec && ec != asio::error::would_block)
+      {
+        std::fprintf(stderr, "send_many: %s\n", ec.message().c_str());
+        return 1;
+      }
+    }
+
+    for (std::size_t received = 0; received < batch_size; )
+    {
+      received += socket.receive_many(replies.begin(),
+          replies.begin() + (batch_size - received), 0, ec);
+      if (ec && ec != asio::error::would_block)
+      {
+        std::fprintf(stderr, "receive_many: %s\n", ec.message().c_str());
+        return 1;
+      }
+    }
+  }
+
+  ptime stop = microsec_clock::universal_time();
+  double elapsed_sec = (stop - start).total_microseconds() / 1000000.0;
+  double datagrams = 1.0 * num_batches * batch_size;
+
+  std::printf("%.0f datagrams echoed in %f seconds\n", datagrams, elapsed_sec);
+  std::printf("%f datagrams per second\n", datagrams / elapsed_sec);
+  return 0;
+}
+
+#endif // defined(ASIO_HAS_MMSG)
+
 int main(int argc, char* argv[])
 {
-  if (argc != 6)
+  if (argc != 6 && argc != 7)
   {
     std::fprintf(stderr,
         "Usage: udp_client <ip> <port1> "
-        "<nports> <bufsize> {spin|block}\n");
+        "<nports> <bufsize> {spin|block} [<batchsize>]\n");
     return 1;
   }
 
@@ -38,6 +135,7 @@ int main(int argc, char* argv[])
   unsigned short num_ports = static_cast<unsigned short>(std::atoi(argv[3]));
   std::size_t buf_size = static_cast<std::size_t>(std::atoi(argv[4]));
   bool spin = (std::strcmp(argv[5], "spin") == 0);
+  std::size_t batch_size = (argc == 7) ? std::atoi(argv[6]) : 0;
 
   asio::io_context io_context;
 
@@ -50,12 +148,32 @@ int main(int argc, char* argv[])
 
   udp::endpoint target(asio::ip::make_address(ip), first_port);
   unsigned short last_port = first_port + num_ports - 1;
+
+  if (batch_size > 0)
+  {
+#if defined(ASIO_HAS_MMSG)
+    return measure_throughput(socket, target,
+        first_port, last_port, buf_size, batch_size);
+#else // defined(ASIO_HAS_MMSG)
+    std::fprintf(stderr, "Batched operations are not supported\n");
+    return 1;
+#endif // defined(ASIO_HAS_MMSG)
+  }
+
   std::vector<unsigned char> write_buf(buf_size);
   std::vector<unsigned char> read_buf(buf_size);
 
   ptime start = microsec_clock::universal_time();
   boost::uint64_t start_hr = high_res_clock();
 
+#if defined(ASIO_HAS_MMSG) && defined(ASIO_HAS_SO_TIMESTAMPING)
+  // The kernel's receive timestamp separates the time taken by the network
+  // from the time the reply then waits before the receive completes.
+  socket.set_option(asio::socket_base::receive_timestamps(true));
+  udp::socket::message_type reply(asio::buffer(read_buf));
+  std::vector<boost::uint64_t> queue_samples(num_samples);
+#endif // defined(ASIO_HAS_MMSG) && defined(ASIO_HAS_SO_TIMESTAMPING)
+
   boost::uint64_t samples[num_samples];
   for (int i = 0; i < num_samples; ++i)
   {
@@ -64,10 +182,23 @@ int main(int argc, char* argv[])
     asio::error_code ec;
     socket.send_to(asio::buffer(write_buf), target, 0, ec);
     
+#if defined(ASIO_HAS_MMSG) && defined(ASIO_HAS_SO_TIMESTAMPING)
+    do socket.receive_many(&reply, &reply + 1, 0, ec);
+    while (ec == asio::error::would_block);
+
+    samples[i] = high_res_clock() - t;
+
+    timespec now;
+    ::clock_gettime(CLOCK_REALTIME, &now);
+    boost::uint64_t now_ns = now.tv_sec * 1000000000ULL + now.tv_nsec;
+    queue_samples[i] = reply.timestamp() && now_ns > reply.timestamp()
+      ? now_ns - reply.timestamp() : 0;
+#else // defined(ASIO_HAS_MMSG) && defined(ASIO_HAS_SO_TIMESTAMPING)
     do socket.receive(asio::buffer(read_buf), 0, ec);
     while (ec == asio::error::would_block);
 
     samples[i] = high_res_clock() - t;
+#endif // defined(ASIO_HAS_MMSG) && defined(ASIO_HAS_SO_TIMESTAMPING)
 
     if (target.port() == last_port)
       target.port(first_port);
@@ -81,24 +212,10 @@ int main(int argc, char* argv[])
   boost::uint64_t elapsed_hr = stop_hr - start_hr;
   double scale = 1.0 * elapsed_usec / elapsed_hr;
 
-  std::sort(samples, samples + num_samples);
-  std::printf("  0.0%%\t%f\n", samples[0] * scale);
-  std::printf("  0.1%%\t%f\n", samples[num_samples / 1000 - 1] * scale);
-  std::printf("  1.0%%\t%f\n", samples[num_samples / 100 - 1] * scale);
-  std::printf(" 10.0%%\t%f\n", samples[num_samples / 10 - 1] * scale);
-  std::printf(" 20.0%%\t%f\n", samples[num_samples * 2 / 10 - 1] * scale);
-  std::printf(" 30.0%%\t%f\n", samples[num_samples * 3 / 10 - 1] * scale);
-  std::printf(" 40.0%%\t%f\n", samples[num_samples * 4 / 10 - 1] * scale);
-  std::printf(" 50.0%%\t%f\n", samples[num_samples * 5 / 10 - 1] * scale);
-  std::printf(" 60.0%%\t%f\n", samples[num_samples * 6 / 10 - 1] * scale);
-  std::printf(" 70.0%%\t%f\n", samples[num_samples * 7 / 10 - 1] * scale);
-  std::printf(" 80.0%%\t%f\n", samples[num_samples * 8 / 10 - 1] * scale);
-  std::printf(" 90.0%%\t%f\n", samples[num_samples * 9 / 10 - 1] * scale);
-  std::printf(" 99.0%%\t%f\n", samples[num_samples * 99 / 100 - 1] * scale);
-  std::printf(" 99.9%%\t%f\n", samples[num_samples * 999 / 1000 - 1] * scale);
-  std::printf("100.0%%\t%f\n", samples[num_samples - 1] * scale);
+  print_distribution(samples, scale);
 
-  double total = 0.0;
-  for (int i = 0; i < num_samples; ++i) total += samples[i] * scale;
-  std::printf("  mean\t%f\n", total / num_samples);
-}
+#if defined(ASIO_HAS_MMSG) && defined(ASIO_HAS_SO_TIMESTAMPING)
+  std::printf("\nTime from kernel receipt to completion:\n");
+  print_distribution(&queue_samples[0], 0.001);
+#endif // defined(ASIO_HAS_MMSG) && defined(ASIO_HAS_SO_TIMESTAMPING)
+}
\ No newline at end of file
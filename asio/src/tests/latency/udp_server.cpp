@@ -90,15 +90,103 @@ private:
   allocator allocator_;
 };
 
+#if defined(ASIO_HAS_MMSG)
+
+// Echoes datagrams in batches, receiving all datagrams that are queued on the
+// socket with a single call and replying to them with another.
+class udp_batch_server : asio::coroutine
+{
+public:
+  udp_batch_server(asio::io_context& io_context, unsigned short port,
+      std::size_t buf_size, std::size_t batch_size) :
+    socket_(io_context, udp::endpoint(udp::v4(), port)),
+    buffer_(buf_size * batch_size),
+    messages_(batch_size),
+    replies_(batch_size)
+  {
+    for (std::size_t i = 0; i < batch_size; ++i)
+      messages_[i].buffer(asio::buffer(&buffer_[i * buf_size], buf_size));
+  }
+
+  void operator()(asio::error_code ec, std::size_t n = 0)
+  {
+    reenter (this) for (;;)
+    {
+      yield socket_.async_receive_many(
+          messages_.begin(), messages_.end(), ref(this));
+
+      if (!ec)
+      {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+          unsigned char* data = static_cast<unsigned char*>(
+              messages_[i].buffer().data());
+          for (std::size_t j = 0; j < messages_[i].size(); ++j)
+            data[j] = ~data[j];
+          replies_[i].buffer(asio::buffer(data, messages_[i].size()));
+          replies_[i].endpoint(messages_[i].endpoint());
+        }
+        socket_.send_many(replies_.begin(), replies_.begin() + n, 0, ec);
+      }
+    }
+  }
+
+  friend void* asio_handler_allocate(std::size_t n, udp_batch_server* s)
+  {
+    return s->allocator_.allocate(n);
+  }
+
+  friend void asio_handler_deallocate(void* p, std::size_t,
+      udp_batch_server* s)
+  {
+    s->allocator_.deallocate(p);
+  }
+
+  struct ref
+  {
+    explicit ref(udp_batch_server* p)
+      : p_(p)
+    {
+    }
+
+    void operator()(asio::error_code ec, std::size_t n = 0)
+    {
+      (*p_)(ec, n);
+    }
+
+  private:
+    udp_batch_server* p_;
+
+    friend void* asio_handler_allocate(std::size_t n, ref* r)
+    {
+      return asio_handler_allocate(n, r->p_);
+    }
+
+    friend void asio_handler_deallocate(void* p, std::size_t n, ref* r)
+    {
+      asio_handler_deallocate(p, n, r->p_);
+    }
+  };
+
+private:
+  udp::socket socket_;
+  std::vector<unsigned char> buffer_;
+  std::vector<udp::socket::message_type> messages_;
+  std::vector<udp::socket::message_type> replies_;
+  allocator allocator_;
+};
+
+#endif // defined(ASIO_HAS_MMSG)
+
 #include <asio/unyield.hpp>
 
 int main(int argc, char* argv[])
 {
-  if (argc != 5)
+  if (argc != 5 && argc != 6)
   {
     std::fprintf(stderr,
         "Usage: udp_server <port1> <nports> "
-        "<bufsize> {spin|block}\n");
+        "<bufsize> {spin|block} [<batchsize>]\n");
     return 1;
   }
 
@@ -106,13 +194,33 @@ int main(int argc, char* argv[])
   unsigned short num_ports = static_cast<unsigned short>(std::atoi(argv[2]));
   std::size_t buf_size = std::atoi(argv[3]);
   bool spin = (std::strcmp(argv[4], "spin") == 0);
+  std::size_t batch_size = (argc == 6) ? std::atoi(argv[5]) : 0;
 
   asio::io_context io_context(1);
   std::vector<boost::shared_ptr<udp_server> > servers;
+#if defined(ASIO_HAS_MMSG)
+  std::vector<boost::shared_ptr<udp_batch_server> > batch_servers;
+#else // defined(ASIO_HAS_MMSG)
+  if (batch_size > 0)
+  {
+    std::fprintf(stderr, "Batched operations are not supported\n");
+    return 1;
+  }
+#endif // defined(ASIO_HAS_MMSG)
 
   for (unsigned short i = 0; i < num_ports; ++i)
   {
     unsigned short port = first_port + i;
+#if defined(ASIO_HAS_MMSG)
+    if (batch_size > 0)
+    {
+      boost::shared_ptr<udp_batch_server> s(
+          new udp_batch_server(io_context, port, buf_size, batch_size));
+      batch_servers.push_back(s);
+      (*s)(asio::error_code());
+      continue;
+    }
+#endif // defined(ASIO_HAS_MMSG)
     boost::shared_ptr<udp_server> s(new udp_server(io_context, port, buf_size));
     servers.push_back(s);
     (*s)(asio::error_code());
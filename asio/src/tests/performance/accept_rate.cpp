@@ -0,0 +1,207 @@
+//
+// accept_rate.cpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the rate at which loopback connections are accepted while a number
+// of clients connect repeatedly, so that connections arrive in bursts. The
+// server accepts either one connection per operation with async_accept, or a
+// batch per operation with async_accept_some, e.g.:
+//
+//   accept_rate 64 0 10
+//   accept_rate 64 16 10
+
+#include "asio.hpp"
+#include <boost/bind/bind.hpp>
+#include <iostream>
+#include <vector>
+
+class server
+{
+public:
+  server(asio::io_context& ioc, std::size_t batch_size)
+    : acceptor_(ioc, asio::ip::tcp::endpoint(
+          asio::ip::address_v4::loopback(), 0)),
+      sockets_(),
+      sockets_per_accept_(batch_size),
+      accepted_(0),
+      accept_operations_(0)
+  {
+    for (std::size_t i = 0; i < (batch_size ? batch_size : 1); ++i)
+      sockets_.push_back(new asio::ip::tcp::socket(ioc));
+    start_accept();
+  }
+
+  ~server()
+  {
+    for (std::size_t i = 0; i < sockets_.size(); ++i)
+      delete sockets_[i];
+  }
+
+  asio::ip::tcp::endpoint endpoint() const
+  {
+    return acceptor_.local_endpoint();
+  }
+
+  std::size_t accepted() const
+  {
+    return accepted_;
+  }
+
+  std::size_t accept_operations() const
+  {
+    return accept_operations_;
+  }
+
+private:
+  // An iterator over the sockets, which are held by pointer.
+  struct socket_iterator
+  {
+    std::vector<asio::ip::tcp::socket*>::iterator iter_;
+
+    asio::ip::tcp::socket* operator->() const { return *iter_; }
+    asio::ip::tcp::socket& operator*() const { return **iter_; }
+    socket_iterator& operator++() { ++iter_; return *this; }
+    bool operator!=(const socket_iterator& other) const
+    {
+      return iter_ != other.iter_;
+    }
+  };
+
+  void start_accept()
+  {
+    if (sockets_per_accept_ == 0)
+    {
+      acceptor_.async_accept(*sockets_[0],
+          boost::bind(&server::handle_accept, this,
+            asio::placeholders::error, 1));
+    }
+    else
+    {
+#if !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
+      socket_iterator begin = { sockets_.begin() };
+      socket_iterator end = { sockets_.end() };
+      acceptor_.async_accept_some(begin, end,
+          boost::bind(&server::handle_accept, this,
+            asio::placeholders::error,
+            asio::placeholders::bytes_transferred));
+#endif // !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
+    }
+  }
+
+  void handle_accept(const asio::error_code& err, std::size_t n)
+  {
+    if (!err)
+    {
+      accepted_ += n;
+      ++accept_operations_;
+      for (std::size_t i = 0; i < n; ++i)
+        sockets_[i]->close();
+      start_accept();
+    }
+  }
+
+  asio::ip::tcp::acceptor acceptor_;
+  std::vector<asio::ip::tcp::socket*> sockets_;
+  std::size_t sockets_per_accept_;
+  std::size_t accepted_;
+  std::size_t accept_operations_;
+};
+
+class client
+{
+public:
+  client(asio::io_context& ioc, const asio::ip::tcp::endpoint& endpoint)
+    : socket_(ioc),
+      endpoint_(endpoint)
+  {
+    start_connect();
+  }
+
+private:
+  void start_connect()
+  {
+    socket_.async_connect(endpoint_,
+        boost::bind(&client::handle_connect, this,
+          asio::placeholders::error));
+  }
+
+  void handle_connect(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      // Reset the connection on close to avoid exhausting ephemeral ports.
+      socket_.set_option(asio::socket_base::linger(true, 0));
+      socket_.close();
+      start_connect();
+    }
+  }
+
+  asio::ip::tcp::socket socket_;
+  asio::ip::tcp::endpoint endpoint_;
+};
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    if (argc != 4)
+    {
+      std::cerr << "Usage: accept_rate <clients> <batchsize> <time>\n";
+      return 1;
+    }
+
+    using namespace std; // For atoi.
+    int client_count = atoi(argv[1]);
+    std::size_t batch_size = atoi(argv[2]);
+    int timeout = atoi(argv[3]);
+
+#if defined(ASIO_HAS_IOCP) || defined(ASIO_WINDOWS_RUNTIME)
+    if (batch_size > 0)
+    {
+      std::cerr << "Batched accept is not supported on this platform\n";
+      return 1;
+    }
+#endif // defined(ASIO_HAS_IOCP) || defined(ASIO_WINDOWS_RUNTIME)
+
+    asio::io_context ioc(1);
+    server s(ioc, batch_size);
+
+    std::vector<client*> clients;
+    for (int i = 0; i < client_count; ++i)
+      clients.push_back(new client(ioc, s.endpoint()));
+
+    asio::steady_timer timer(ioc, asio::chrono::seconds(timeout));
+    timer.async_wait(boost::bind(&asio::io_context::stop, &ioc));
+
+    asio::chrono::steady_clock::time_point start
+      = asio::chrono::steady_clock::now();
+
+    ioc.run();
+
+    asio::chrono::steady_clock::duration elapsed
+      = asio::chrono::steady_clock::now() - start;
+    double seconds = asio::chrono::duration_cast<
+      asio::chrono::microseconds>(elapsed).count() / 1000000.0;
+
+    std::cout << s.accepted() << " connections in "
+      << seconds << " seconds\n";
+    std::cout << (s.accepted() / seconds) << " connections per second\n";
+    std::cout << (s.accept_operations() ? 1.0 * s.accepted()
+        / s.accept_operations() : 0.0) << " connections per accept\n";
+
+    for (int i = 0; i < client_count; ++i)
+      delete clients[i];
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << "\n";
+  }
+
+  return 0;
+}
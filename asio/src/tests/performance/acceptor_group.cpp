@@ -0,0 +1,249 @@
+//
+// acceptor_group.cpp
+// ~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the rate at which loopback connections are accepted by a group of
+// SO_REUSEPORT acceptors, one per io_context, with each io_context running on
+// its own thread pinned to a CPU. A client on each io_context connects to the
+// group repeatedly. The acceptors are either steered by receiving CPU using
+// basic_acceptor_group, or left to the kernel's hashing. The output includes
+// the proportion of connections accepted on the CPU that received them, e.g.:
+//
+//   acceptor_group 4 0 10
+//   acceptor_group 4 1 10
+
+#include "asio.hpp"
+#include <boost/bind/bind.hpp>
+#include <iostream>
+#include <vector>
+
+#if defined(ASIO_HAS_REUSEPORT_CBPF)
+
+#include <sched.h>
+
+class shard
+{
+public:
+  explicit shard(int cpu)
+    : io_context_(1),
+      cpu_(cpu),
+      acceptor_(0),
+      server_socket_(io_context_),
+      client_socket_(io_context_),
+      accepted_(0),
+      accepted_locally_(0)
+  {
+  }
+
+  asio::io_context& context()
+  {
+    return io_context_;
+  }
+
+  void start(asio::ip::tcp::acceptor& acceptor)
+  {
+    acceptor_ = &acceptor;
+    endpoint_ = acceptor.local_endpoint();
+    start_accept();
+    start_connect();
+  }
+
+  void run()
+  {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(cpu_, &cpus);
+    ::sched_setaffinity(0, sizeof(cpus), &cpus);
+    io_context_.run();
+  }
+
+  std::size_t accepted() const
+  {
+    return accepted_;
+  }
+
+  std::size_t accepted_locally() const
+  {
+    return accepted_locally_;
+  }
+
+private:
+  void start_accept()
+  {
+    acceptor_->async_accept(server_socket_,
+        boost::bind(&shard::handle_accept, this,
+          asio::placeholders::error));
+  }
+
+  void handle_accept(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      ++accepted_;
+      asio::socket_base::incoming_cpu incoming_cpu;
+      asio::error_code ec;
+      server_socket_.get_option(incoming_cpu, ec);
+      if (!ec && incoming_cpu.value() == cpu_)
+        ++accepted_locally_;
+      server_socket_.close();
+      start_accept();
+    }
+  }
+
+  void start_connect()
+  {
+    client_socket_.async_connect(endpoint_,
+        boost::bind(&shard::handle_connect, this,
+          asio::placeholders::error));
+  }
+
+  void handle_connect(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      // Reset the connection on close to avoid exhausting ephemeral ports.
+      client_socket_.set_option(asio::socket_base::linger(true, 0));
+      client_socket_.close();
+      start_connect();
+    }
+  }
+
+  asio::io_context io_context_;
+  int cpu_;
+  asio::ip::tcp::acceptor* acceptor_;
+  asio::ip::tcp::endpoint endpoint_;
+  asio::ip::tcp::socket server_socket_;
+  asio::ip::tcp::socket client_socket_;
+  std::size_t accepted_;
+  std::size_t accepted_locally_;
+};
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    if (argc != 4)
+    {
+      std::cerr << "Usage: acceptor_group <shards> <steered> <time>\n";
+      return 1;
+    }
+
+    using namespace std; // For atoi.
+    int shard_count = atoi(argv[1]);
+    bool steered = atoi(argv[2]) != 0;
+    int timeout = atoi(argv[3]);
+
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    ::sched_getaffinity(0, sizeof(cpus), &cpus);
+    std::vector<int> cpu_numbers;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+      if (CPU_ISSET(cpu, &cpus))
+        cpu_numbers.push_back(cpu);
+
+    // The steering program selects acceptor n % shards for CPU n, so shard i
+    // is pinned to CPU i where there are enough CPUs.
+    std::vector<shard*> shards;
+    for (int i = 0; i < shard_count; ++i)
+      shards.push_back(new shard(cpu_numbers[i % cpu_numbers.size()]));
+
+    asio::ip::tcp::endpoint endpoint(asio::ip::address_v4::loopback(), 0);
+    asio::basic_acceptor_group<asio::ip::tcp>* group
+      = new asio::basic_acceptor_group<asio::ip::tcp>(endpoint);
+    std::vector<asio::ip::tcp::acceptor*> acceptors;
+    for (int i = 0; i < shard_count; ++i)
+    {
+      if (steered)
+      {
+        acceptors.push_back(&group->add(shards[i]->context()));
+      }
+      else
+      {
+        acceptors.push_back(new asio::ip::tcp::acceptor(
+              shards[i]->context(), endpoint.protocol()));
+        acceptors[i]->set_option(asio::socket_base::reuse_address(true));
+        acceptors[i]->set_option(asio::socket_base::reuse_port(true));
+        acceptors[i]->bind(endpoint);
+        acceptors[i]->listen();
+        endpoint = acceptors[i]->local_endpoint();
+      }
+    }
+    if (steered)
+      group->listen();
+
+    for (int i = 0; i < shard_count; ++i)
+      shards[i]->start(*acceptors[i]);
+
+    asio::chrono::steady_clock::time_point start
+      = asio::chrono::steady_clock::now();
+
+    std::vector<asio::thread*> threads;
+    for (int i = 0; i < shard_count; ++i)
+    {
+      threads.push_back(new asio::thread(
+            boost::bind(&shard::run, shards[i])));
+    }
+
+    asio::io_context timer_ioc;
+    asio::steady_timer timer(timer_ioc, asio::chrono::seconds(timeout));
+    timer.wait();
+
+    for (int i = 0; i < shard_count; ++i)
+      shards[i]->context().stop();
+
+    asio::chrono::steady_clock::duration elapsed
+      = asio::chrono::steady_clock::now() - start;
+    double seconds = asio::chrono::duration_cast<
+      asio::chrono::microseconds>(elapsed).count() / 1000000.0;
+
+    for (int i = 0; i < shard_count; ++i)
+    {
+      threads[i]->join();
+      delete threads[i];
+    }
+
+    std::size_t total_accepted = 0;
+    std::size_t total_accepted_locally = 0;
+    for (int i = 0; i < shard_count; ++i)
+    {
+      total_accepted += shards[i]->accepted();
+      total_accepted_locally += shards[i]->accepted_locally();
+    }
+
+    std::cout << total_accepted << " connections in "
+      << seconds << " seconds\n";
+    std::cout << (total_accepted / seconds) << " connections per second\n";
+    std::cout << (total_accepted ? 100.0 * total_accepted_locally
+        / total_accepted : 0.0) << "% accepted on the receiving CPU\n";
+
+    // The acceptors must be destroyed before the io_contexts they use.
+    delete group;
+    if (!steered)
+      for (int i = 0; i < shard_count; ++i)
+        delete acceptors[i];
+    for (int i = 0; i < shard_count; ++i)
+      delete shards[i];
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << "\n";
+  }
+
+  return 0;
+}
+
+#else // defined(ASIO_HAS_REUSEPORT_CBPF)
+
+int main()
+{
+  std::cerr << "Acceptor groups are not supported on this platform\n";
+  return 1;
+}
+
+#endif // defined(ASIO_HAS_REUSEPORT_CBPF)
@@ -0,0 +1,171 @@
+//
+// cross_post.cpp
+// ~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the cost of posting between io_contexts that each run on their own
+// thread. Messages are passed around a ring of shards, with every hop being a
+// post to the next shard's executor. Run with one message per shard to obtain
+// the hop latency, and with many to obtain the throughput, e.g.:
+//
+//   cross_post 2 1 10
+//   cross_post 4 256 10
+
+#include "asio.hpp"
+#include <boost/bind/bind.hpp>
+#include <iostream>
+#include <vector>
+
+class shard
+{
+public:
+  shard()
+    : io_context_(1),
+      timer_(io_context_),
+      work_(asio::make_work_guard(io_context_)),
+      hops_(0)
+  {
+  }
+
+  asio::io_context& context()
+  {
+    return io_context_;
+  }
+
+  void count_hop()
+  {
+    ++hops_;
+  }
+
+  std::size_t hops() const
+  {
+    return hops_;
+  }
+
+  void finish()
+  {
+    work_.reset();
+  }
+
+private:
+  asio::io_context io_context_;
+
+  // Unused, but ensures that the context has its I/O task.
+  asio::steady_timer timer_;
+
+  asio::executor_work_guard<asio::io_context::executor_type> work_;
+  std::size_t hops_;
+};
+
+class message
+{
+public:
+  message(std::vector<shard*>& shards, std::size_t index,
+      asio::detail::atomic_count& stopped)
+    : shards_(&shards),
+      index_(index),
+      stopped_(&stopped)
+  {
+  }
+
+  void operator()()
+  {
+    (*shards_)[index_]->count_hop();
+    if (*stopped_ == 0)
+    {
+      index_ = (index_ + 1) % shards_->size();
+      asio::post((*shards_)[index_]->context(), *this);
+    }
+  }
+
+private:
+  std::vector<shard*>* shards_;
+  std::size_t index_;
+  asio::detail::atomic_count* stopped_;
+};
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    if (argc != 4)
+    {
+      std::cerr << "Usage: cross_post <shards> <messages_per_shard> <time>\n";
+      return 1;
+    }
+
+    using namespace std; // For atoi.
+    std::size_t shard_count = atoi(argv[1]);
+    std::size_t message_count = atoi(argv[2]);
+    int timeout = atoi(argv[3]);
+
+    if (shard_count < 2)
+    {
+      std::cerr << "At least two shards are required\n";
+      return 1;
+    }
+
+    asio::detail::atomic_count stopped(0);
+
+    std::vector<shard*> shards;
+    for (std::size_t i = 0; i < shard_count; ++i)
+      shards.push_back(new shard);
+
+    for (std::size_t i = 0; i < shard_count; ++i)
+      for (std::size_t j = 0; j < message_count; ++j)
+        asio::post(shards[i]->context(), message(shards, i, stopped));
+
+    asio::chrono::steady_clock::time_point start
+      = asio::chrono::steady_clock::now();
+
+    std::vector<asio::thread*> threads;
+    for (std::size_t i = 0; i < shard_count; ++i)
+    {
+      threads.push_back(new asio::thread(
+            boost::bind(&asio::io_context::run, &shards[i]->context())));
+    }
+
+    asio::io_context ioc;
+    asio::steady_timer timer(ioc, asio::chrono::seconds(timeout));
+    timer.wait();
+
+    ++stopped;
+    for (std::size_t i = 0; i < shard_count; ++i)
+      shards[i]->finish();
+
+    for (std::size_t i = 0; i < shard_count; ++i)
+    {
+      threads[i]->join();
+      delete threads[i];
+    }
+
+    asio::chrono::steady_clock::duration elapsed
+      = asio::chrono::steady_clock::now() - start;
+    double seconds = asio::chrono::duration_cast<
+      asio::chrono::microseconds>(elapsed).count() / 1000000.0;
+
+    std::size_t total_hops = 0;
+    for (std::size_t i = 0; i < shard_count; ++i)
+    {
+      total_hops += shards[i]->hops();
+      delete shards[i];
+    }
+
+    std::size_t in_flight = shard_count * message_count;
+    std::cout << total_hops << " hops in " << seconds << " seconds\n";
+    std::cout << (total_hops / seconds) << " hops per second\n";
+    std::cout << (seconds * 1000000.0 * in_flight / total_hops)
+      << " us mean hop latency\n";
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << "\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,233 @@
+//
+// echo.cpp
+// ~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the round trip rate of many loopback echo sessions that share a
+// single io_context, which is run from a pool of threads. Build it once as is
+// and once with ASIO_DISABLE_EPOLL defined to compare the epoll reactor with
+// io_uring at the same thread count, e.g.:
+//
+//   echo 16 256 64 10
+
+#include "asio.hpp"
+#include <boost/bind/bind.hpp>
+#include <iostream>
+#include <vector>
+#include "handler_allocator.hpp"
+
+class session
+{
+public:
+  session(asio::io_context& ioc, size_t block_size)
+    : client_socket_(ioc),
+      server_socket_(ioc),
+      block_size_(block_size),
+      client_data_(new char[block_size]),
+      server_data_(new char[block_size]),
+      round_trips_(0)
+  {
+  }
+
+  ~session()
+  {
+    delete[] client_data_;
+    delete[] server_data_;
+  }
+
+  void connect(asio::ip::tcp::acceptor& acceptor)
+  {
+    client_socket_.connect(acceptor.local_endpoint());
+    acceptor.accept(server_socket_);
+
+    asio::ip::tcp::no_delay no_delay(true);
+    client_socket_.set_option(no_delay);
+    server_socket_.set_option(no_delay);
+  }
+
+  void start()
+  {
+    for (size_t i = 0; i < block_size_; ++i)
+      client_data_[i] = static_cast<char>(i % 128);
+
+    start_server_read();
+    start_client_write();
+  }
+
+  void stop()
+  {
+    client_socket_.close();
+    server_socket_.close();
+  }
+
+  std::size_t round_trips() const
+  {
+    return round_trips_;
+  }
+
+private:
+  void start_client_write()
+  {
+    asio::async_write(client_socket_,
+        asio::buffer(client_data_, block_size_),
+        make_custom_alloc_handler(client_write_allocator_,
+          boost::bind(&session::handle_client_write, this,
+            asio::placeholders::error)));
+  }
+
+  void handle_client_write(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      asio::async_read(client_socket_,
+          asio::buffer(client_data_, block_size_),
+          make_custom_alloc_handler(client_read_allocator_,
+            boost::bind(&session::handle_client_read, this,
+              asio::placeholders::error)));
+    }
+  }
+
+  void handle_client_read(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      ++round_trips_;
+      start_client_write();
+    }
+  }
+
+  void start_server_read()
+  {
+    server_socket_.async_read_some(
+        asio::buffer(server_data_, block_size_),
+        make_custom_alloc_handler(server_read_allocator_,
+          boost::bind(&session::handle_server_read, this,
+            asio::placeholders::error,
+            asio::placeholders::bytes_transferred)));
+  }
+
+  void handle_server_read(const asio::error_code& err, size_t length)
+  {
+    if (!err)
+    {
+      asio::async_write(server_socket_,
+          asio::buffer(server_data_, length),
+          make_custom_alloc_handler(server_write_allocator_,
+            boost::bind(&session::handle_server_write, this,
+              asio::placeholders::error)));
+    }
+  }
+
+  void handle_server_write(const asio::error_code& err)
+  {
+    if (!err)
+      start_server_read();
+  }
+
+  asio::ip::tcp::socket client_socket_;
+  asio::ip::tcp::socket server_socket_;
+  size_t block_size_;
+  char* client_data_;
+  char* server_data_;
+  std::size_t round_trips_;
+  handler_allocator client_read_allocator_;
+  handler_allocator client_write_allocator_;
+  handler_allocator server_read_allocator_;
+  handler_allocator server_write_allocator_;
+};
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    if (argc != 5)
+    {
+      std::cerr << "Usage: echo <threads> <sessions> <blocksize> <time>\n";
+      return 1;
+    }
+
+    using namespace std; // For atoi.
+    int thread_count = atoi(argv[1]);
+    int session_count = atoi(argv[2]);
+    size_t block_size = atoi(argv[3]);
+    int timeout = atoi(argv[4]);
+
+    asio::io_context ioc(thread_count);
+
+    asio::ip::tcp::acceptor acceptor(ioc,
+        asio::ip::tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+
+    std::vector<session*> sessions;
+    for (int i = 0; i < session_count; ++i)
+    {
+      sessions.push_back(new session(ioc, block_size));
+      sessions.back()->connect(acceptor);
+      sessions.back()->start();
+    }
+
+    asio::chrono::steady_clock::time_point start
+      = asio::chrono::steady_clock::now();
+
+    std::vector<asio::thread*> threads;
+    for (int i = 0; i < thread_count; ++i)
+    {
+      threads.push_back(new asio::thread(
+            boost::bind(&asio::io_context::run, &ioc)));
+    }
+
+    asio::io_context timer_ioc;
+    asio::steady_timer timer(timer_ioc, asio::chrono::seconds(timeout));
+    timer.wait();
+
+    ioc.stop();
+
+    asio::chrono::steady_clock::duration elapsed
+      = asio::chrono::steady_clock::now() - start;
+    double seconds = asio::chrono::duration_cast<
+      asio::chrono::microseconds>(elapsed).count() / 1000000.0;
+
+    for (int i = 0; i < thread_count; ++i)
+    {
+      threads[i]->join();
+      delete threads[i];
+    }
+
+    std::size_t total_round_trips = 0;
+    for (int i = 0; i < session_count; ++i)
+      total_round_trips += sessions[i]->round_trips();
+
+    std::cout << total_round_trips << " round trips in "
+      << seconds << " seconds\n";
+    std::cout << (total_round_trips / seconds) << " round trips per second\n";
+
+#if defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+    asio::detail::io_uring_service::submission_statistics statistics
+      = asio::use_service<asio::detail::io_uring_service>(
+          ioc).get_submission_statistics();
+    std::cout << statistics.direct_sqes << " entries submitted directly\n";
+    std::cout << statistics.lock_contentions << " times the lock was held\n";
+    std::cout << statistics.staged_sqes << " entries staged in "
+      << statistics.staged_flushes << " batches\n";
+#endif // defined(ASIO_HAS_IO_URING_AS_DEFAULT)
+
+    // The sessions' handlers must complete before the sessions are deleted.
+    for (int i = 0; i < session_count; ++i)
+      sessions[i]->stop();
+    ioc.restart();
+    ioc.run();
+
+    for (int i = 0; i < session_count; ++i)
+      delete sessions[i];
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << "\n";
+  }
+
+  return 0;
+}
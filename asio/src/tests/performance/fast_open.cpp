@@ -0,0 +1,214 @@
+//
+// fast_open.cpp
+// ~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the time taken by short-lived request/response connections, each of
+// which connects, sends a request, reads the response and closes. Connections
+// are made either with async_connect followed by async_write, or with
+// async_connect_and_send so that the request may be carried in the SYN using
+// TCP Fast Open. Emulate a network delay on the loopback interface to see the
+// round trip that is saved, e.g.:
+//
+//   sysctl -w net.ipv4.tcp_fastopen=3
+//   tc qdisc add dev lo root netem delay 10ms
+//   fast_open 0 100 64
+//   fast_open 1 100 64
+//   tc qdisc del dev lo root
+
+#include "asio.hpp"
+#include <boost/bind/bind.hpp>
+#include <iostream>
+#include <vector>
+
+class server
+{
+public:
+  server(asio::io_context& ioc, size_t block_size)
+    : acceptor_(ioc, asio::ip::tcp::v4()),
+      socket_(ioc),
+      data_(block_size)
+  {
+#if defined(ASIO_HAS_TCP_FAST_OPEN)
+    acceptor_.set_option(asio::ip::tcp::fast_open(256));
+#endif // defined(ASIO_HAS_TCP_FAST_OPEN)
+    acceptor_.bind(asio::ip::tcp::endpoint(
+          asio::ip::address_v4::loopback(), 0));
+    acceptor_.listen();
+    start_accept();
+  }
+
+  asio::ip::tcp::endpoint endpoint() const
+  {
+    return acceptor_.local_endpoint();
+  }
+
+private:
+  void start_accept()
+  {
+    socket_.close();
+    acceptor_.async_accept(socket_,
+        boost::bind(&server::handle_accept, this,
+          asio::placeholders::error));
+  }
+
+  void handle_accept(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      asio::async_read(socket_, asio::buffer(data_),
+          boost::bind(&server::handle_read, this,
+            asio::placeholders::error));
+    }
+  }
+
+  void handle_read(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      asio::async_write(socket_, asio::buffer(data_),
+          boost::bind(&server::handle_write, this,
+            asio::placeholders::error));
+    }
+    else
+    {
+      start_accept();
+    }
+  }
+
+  void handle_write(const asio::error_code&)
+  {
+    start_accept();
+  }
+
+  asio::ip::tcp::acceptor acceptor_;
+  asio::ip::tcp::socket socket_;
+  std::vector<char> data_;
+};
+
+class client
+{
+public:
+  client(asio::io_context& ioc, const asio::ip::tcp::endpoint& endpoint,
+      bool fast_open, size_t block_size, int connection_count)
+    : io_context_(ioc),
+      socket_(ioc),
+      endpoint_(endpoint),
+      fast_open_(fast_open),
+      data_(block_size),
+      connections_remaining_(connection_count)
+  {
+    start_connect();
+  }
+
+private:
+  void start_connect()
+  {
+    socket_.close();
+    if (connections_remaining_-- == 0)
+    {
+      // The server accepts connections until the io_context is stopped.
+      io_context_.stop();
+      return;
+    }
+
+    if (fast_open_)
+    {
+      socket_.async_connect_and_send(endpoint_, asio::buffer(data_),
+          boost::bind(&client::handle_send, this,
+            asio::placeholders::error,
+            asio::placeholders::bytes_transferred));
+    }
+    else
+    {
+      socket_.async_connect(endpoint_,
+          boost::bind(&client::handle_send, this,
+            asio::placeholders::error, 0));
+    }
+  }
+
+  void handle_send(const asio::error_code& err, size_t bytes_transferred)
+  {
+    if (!err)
+    {
+      asio::async_write(socket_, asio::buffer(data_) + bytes_transferred,
+          boost::bind(&client::handle_write, this,
+            asio::placeholders::error));
+    }
+  }
+
+  void handle_write(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      asio::async_read(socket_, asio::buffer(data_),
+          boost::bind(&client::handle_read, this,
+            asio::placeholders::error));
+    }
+  }
+
+  void handle_read(const asio::error_code& err)
+  {
+    if (!err)
+      start_connect();
+  }
+
+  asio::io_context& io_context_;
+  asio::ip::tcp::socket socket_;
+  asio::ip::tcp::endpoint endpoint_;
+  bool fast_open_;
+  std::vector<char> data_;
+  int connections_remaining_;
+};
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    if (argc != 4)
+    {
+      std::cerr << "Usage: fast_open <0|1> <connections> <blocksize>\n";
+      return 1;
+    }
+
+    using namespace std; // For atoi.
+    bool fast_open = atoi(argv[1]) != 0;
+    int connection_count = atoi(argv[2]);
+    size_t block_size = atoi(argv[3]);
+
+    asio::io_context ioc;
+    server s(ioc, block_size);
+
+    // Make one connection first so that the client has a Fast Open cookie.
+    client c1(ioc, s.endpoint(), fast_open, block_size, 1);
+    ioc.run();
+    ioc.restart();
+
+    asio::chrono::steady_clock::time_point start
+      = asio::chrono::steady_clock::now();
+
+    client c2(ioc, s.endpoint(), fast_open, block_size, connection_count);
+    ioc.run();
+
+    asio::chrono::steady_clock::duration elapsed
+      = asio::chrono::steady_clock::now() - start;
+    double seconds = asio::chrono::duration_cast<
+      asio::chrono::microseconds>(elapsed).count() / 1000000.0;
+
+    std::cout << connection_count << " connections in "
+      << seconds << " seconds\n";
+    std::cout << (seconds * 1000000.0 / connection_count)
+      << " us per connection\n";
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << "\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,266 @@
+//
+// proxy.cpp
+// ~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// A TCP proxy used to compare the throughput of relaying data with
+// asio::async_splice against copying it through user memory. Place it
+// between the performance client and server, e.g.:
+//
+//   server 127.0.0.1 5001 1 65536
+//   proxy 127.0.0.1 5000 127.0.0.1 5001 splice 65536
+//   client 127.0.0.1 5000 1 65536 1 10
+
+#include "asio.hpp"
+#include <boost/bind/bind.hpp>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include "handler_allocator.hpp"
+
+class session;
+
+// Relays data in one direction between a pair of sockets.
+class relay
+{
+public:
+  relay(session* owner, asio::ip::tcp::socket& from,
+      asio::ip::tcp::socket& to, bool use_splice, size_t block_size)
+    : owner_(owner),
+      from_(from),
+      to_(to),
+      use_splice_(use_splice),
+      block_size_(block_size),
+      data_(new char[block_size])
+  {
+  }
+
+  ~relay()
+  {
+    delete[] data_;
+  }
+
+  void start()
+  {
+#if defined(ASIO_HAS_SPLICE)
+    if (use_splice_)
+    {
+      asio::async_splice(from_, to_, (std::numeric_limits<size_t>::max)(),
+          make_custom_alloc_handler(allocator_,
+            boost::bind(&relay::handle_splice, this,
+              asio::placeholders::error)));
+      return;
+    }
+#endif // defined(ASIO_HAS_SPLICE)
+
+    from_.async_read_some(asio::buffer(data_, block_size_),
+        make_custom_alloc_handler(allocator_,
+          boost::bind(&relay::handle_read, this,
+            asio::placeholders::error,
+            asio::placeholders::bytes_transferred)));
+  }
+
+  void handle_splice(const asio::error_code&)
+  {
+    finish();
+  }
+
+  void handle_read(const asio::error_code& err, size_t length)
+  {
+    if (!err)
+    {
+      asio::async_write(to_, asio::buffer(data_, length),
+          make_custom_alloc_handler(allocator_,
+            boost::bind(&relay::handle_write, this,
+              asio::placeholders::error)));
+    }
+    else
+    {
+      finish();
+    }
+  }
+
+  void handle_write(const asio::error_code& err)
+  {
+    if (!err)
+      start();
+    else
+      finish();
+  }
+
+private:
+  void finish();
+
+  session* owner_;
+  asio::ip::tcp::socket& from_;
+  asio::ip::tcp::socket& to_;
+  bool use_splice_;
+  size_t block_size_;
+  char* data_;
+  handler_allocator allocator_;
+};
+
+class session
+{
+public:
+  session(asio::io_context& ioc, bool use_splice, size_t block_size)
+    : client_socket_(ioc),
+      server_socket_(ioc),
+      upstream_(this, client_socket_, server_socket_, use_splice, block_size),
+      downstream_(this, server_socket_, client_socket_, use_splice, block_size),
+      relay_count_(0)
+  {
+  }
+
+  asio::ip::tcp::socket& socket()
+  {
+    return client_socket_;
+  }
+
+  void start(const asio::ip::tcp::endpoint& target)
+  {
+    server_socket_.async_connect(target,
+        boost::bind(&session::handle_connect, this,
+          asio::placeholders::error));
+  }
+
+  void handle_connect(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      asio::error_code set_option_err;
+      asio::ip::tcp::no_delay no_delay(true);
+      client_socket_.set_option(no_delay, set_option_err);
+      server_socket_.set_option(no_delay, set_option_err);
+
+      relay_count_ = 2;
+      upstream_.start();
+      downstream_.start();
+    }
+    else
+    {
+      delete this;
+    }
+  }
+
+  void relay_finished()
+  {
+    // Closing both sockets makes the other direction complete too.
+    asio::error_code ignored_err;
+    client_socket_.close(ignored_err);
+    server_socket_.close(ignored_err);
+
+    if (--relay_count_ == 0)
+      delete this;
+  }
+
+private:
+  asio::ip::tcp::socket client_socket_;
+  asio::ip::tcp::socket server_socket_;
+  relay upstream_;
+  relay downstream_;
+  int relay_count_;
+};
+
+void relay::finish()
+{
+  owner_->relay_finished();
+}
+
+class proxy
+{
+public:
+  proxy(asio::io_context& ioc, const asio::ip::tcp::endpoint& endpoint,
+      const asio::ip::tcp::endpoint& target, bool use_splice,
+      size_t block_size)
+    : io_context_(ioc),
+      acceptor_(ioc),
+      target_(target),
+      use_splice_(use_splice),
+      block_size_(block_size)
+  {
+    acceptor_.open(endpoint.protocol());
+    acceptor_.set_option(asio::ip::tcp::acceptor::reuse_address(1));
+    acceptor_.bind(endpoint);
+    acceptor_.listen();
+
+    start_accept();
+  }
+
+  void start_accept()
+  {
+    session* new_session = new session(io_context_, use_splice_, block_size_);
+    acceptor_.async_accept(new_session->socket(),
+        boost::bind(&proxy::handle_accept, this, new_session,
+          asio::placeholders::error));
+  }
+
+  void handle_accept(session* new_session, const asio::error_code& err)
+  {
+    if (!err)
+    {
+      new_session->start(target_);
+    }
+    else
+    {
+      delete new_session;
+    }
+
+    start_accept();
+  }
+
+private:
+  asio::io_context& io_context_;
+  asio::ip::tcp::acceptor acceptor_;
+  asio::ip::tcp::endpoint target_;
+  bool use_splice_;
+  size_t block_size_;
+};
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    if (argc != 7)
+    {
+      std::cerr << "Usage: proxy <address> <port> <target_address>"
+        " <target_port> <splice|copy> <blocksize>\n";
+      return 1;
+    }
+
+    using namespace std; // For atoi and strcmp.
+    asio::ip::address address = asio::ip::make_address(argv[1]);
+    short port = atoi(argv[2]);
+    asio::ip::address target_address = asio::ip::make_address(argv[3]);
+    short target_port = atoi(argv[4]);
+    bool use_splice = strcmp(argv[5], "splice") == 0;
+    size_t block_size = atoi(argv[6]);
+
+#if !defined(ASIO_HAS_SPLICE)
+    if (use_splice)
+    {
+      std::cerr << "Splice is not supported on this platform\n";
+      return 1;
+    }
+#endif // !defined(ASIO_HAS_SPLICE)
+
+    asio::io_context ioc;
+
+    proxy p(ioc, asio::ip::tcp::endpoint(address, port),
+        asio::ip::tcp::endpoint(target_address, target_port),
+        use_splice, block_size);
+
+    ioc.run();
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << "\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,246 @@
+//
+// ssl_bulk_read.cpp
+// ~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the rate at which a client downloads data over a TLS 1.3
+// connection on loopback, and the number of read operations it performs per
+// MiB. A server thread writes data as fast as it can, and a client thread
+// reads it using a stream with the specified input buffer size, e.g.:
+//
+//   ssl_bulk_read 17408 262144 10
+//   ssl_bulk_read 262144 262144 10
+
+#include "asio.hpp"
+#include "asio/ssl.hpp"
+#include <boost/bind/bind.hpp>
+#include <iostream>
+#include <vector>
+
+typedef asio::ssl::stream<asio::ip::tcp::socket> ssl_socket;
+
+// Give the server a self-signed certificate for a new P-256 key.
+void use_self_signed_certificate(asio::ssl::context& ctx)
+{
+  EVP_PKEY* key = 0;
+  EVP_PKEY_CTX* key_ctx = ::EVP_PKEY_CTX_new_id(EVP_PKEY_EC, 0);
+  ::EVP_PKEY_keygen_init(key_ctx);
+  ::EVP_PKEY_CTX_set_ec_paramgen_curve_nid(key_ctx, NID_X9_62_prime256v1);
+  ::EVP_PKEY_keygen(key_ctx, &key);
+  ::EVP_PKEY_CTX_free(key_ctx);
+
+  X509* cert = ::X509_new();
+  ::X509_set_version(cert, 2);
+  ::ASN1_INTEGER_set(::X509_get_serialNumber(cert), 1);
+  ::X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+  ::X509_gmtime_adj(X509_getm_notAfter(cert), 60 * 60);
+  ::X509_set_pubkey(cert, key);
+  X509_NAME* name = ::X509_get_subject_name(cert);
+  ::X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+      reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+  ::X509_set_issuer_name(cert, name);
+  ::X509_sign(cert, key, ::EVP_sha256());
+
+  ::SSL_CTX_use_certificate(ctx.native_handle(), cert);
+  ::SSL_CTX_use_PrivateKey(ctx.native_handle(), key);
+  ::X509_free(cert);
+  ::EVP_PKEY_free(key);
+}
+
+class server
+{
+public:
+  server(asio::io_context& ioc, asio::ssl::context& ctx)
+    : acceptor_(ioc, asio::ip::tcp::endpoint(
+          asio::ip::address_v4::loopback(), 0)),
+      socket_(ioc, ctx),
+      buffer_(1024 * 1024, 'x')
+  {
+    acceptor_.async_accept(socket_.next_layer(),
+        boost::bind(&server::handle_accept, this,
+          asio::placeholders::error));
+  }
+
+  asio::ip::tcp::endpoint endpoint() const
+  {
+    return acceptor_.local_endpoint();
+  }
+
+private:
+  void handle_accept(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      socket_.async_handshake(asio::ssl::stream_base::server,
+          boost::bind(&server::handle_handshake, this,
+            asio::placeholders::error));
+    }
+  }
+
+  void handle_handshake(const asio::error_code& err)
+  {
+    if (!err)
+      start_write();
+    else
+      std::cerr << "Server handshake: " << err.message() << "\n";
+  }
+
+  void start_write()
+  {
+    asio::async_write(socket_, asio::buffer(buffer_),
+        boost::bind(&server::handle_write, this,
+          asio::placeholders::error));
+  }
+
+  void handle_write(const asio::error_code& err)
+  {
+    if (!err)
+      start_write();
+  }
+
+  asio::ip::tcp::acceptor acceptor_;
+  ssl_socket socket_;
+  std::vector<char> buffer_;
+};
+
+class client
+{
+public:
+  client(asio::io_context& ioc, asio::ssl::context& ctx,
+      const asio::ip::tcp::endpoint& endpoint,
+      std::size_t input_size, std::size_t read_size)
+    : socket_(ioc, ctx),
+      buffer_(read_size),
+      bytes_read_(0),
+      reads_(0)
+  {
+    socket_.set_buffer_sizes(input_size, 17 * 1024);
+    socket_.next_layer().async_connect(endpoint,
+        boost::bind(&client::handle_connect, this,
+          asio::placeholders::error));
+  }
+
+  std::size_t bytes_read() const
+  {
+    return bytes_read_;
+  }
+
+  std::size_t reads() const
+  {
+    return reads_;
+  }
+
+private:
+  void handle_connect(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      socket_.async_handshake(asio::ssl::stream_base::client,
+          boost::bind(&client::handle_handshake, this,
+            asio::placeholders::error));
+    }
+  }
+
+  void handle_handshake(const asio::error_code& err)
+  {
+    if (!err)
+      start_read();
+    else
+      std::cerr << "Client handshake: " << err.message() << "\n";
+  }
+
+  void start_read()
+  {
+    socket_.async_read_some(asio::buffer(buffer_),
+        boost::bind(&client::handle_read, this,
+          asio::placeholders::error,
+          asio::placeholders::bytes_transferred));
+  }
+
+  void handle_read(const asio::error_code& err, std::size_t n)
+  {
+    if (!err)
+    {
+      bytes_read_ += n;
+      ++reads_;
+      start_read();
+    }
+  }
+
+  ssl_socket socket_;
+  std::vector<char> buffer_;
+  std::size_t bytes_read_;
+  std::size_t reads_;
+};
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    if (argc != 4)
+    {
+      std::cerr << "Usage: ssl_bulk_read <inputsize> <readsize> <time>\n";
+      return 1;
+    }
+
+    using namespace std; // For atoi.
+    std::size_t input_size = atoi(argv[1]);
+    std::size_t read_size = atoi(argv[2]);
+    int timeout = atoi(argv[3]);
+
+    asio::ssl::context server_ctx(asio::ssl::context::tlsv13_server);
+    use_self_signed_certificate(server_ctx);
+    ::SSL_CTX_set_ciphersuites(server_ctx.native_handle(),
+        "TLS_AES_128_GCM_SHA256");
+
+    asio::ssl::context client_ctx(asio::ssl::context::tlsv13_client);
+    ::SSL_CTX_set_ciphersuites(client_ctx.native_handle(),
+        "TLS_AES_128_GCM_SHA256");
+
+    asio::io_context server_ioc(1);
+    server s(server_ioc, server_ctx);
+
+    asio::io_context client_ioc(1);
+    client c(client_ioc, client_ctx, s.endpoint(), input_size, read_size);
+
+    asio::chrono::steady_clock::time_point start
+      = asio::chrono::steady_clock::now();
+
+    asio::thread server_thread(
+        boost::bind(&asio::io_context::run, &server_ioc));
+    asio::thread client_thread(
+        boost::bind(&asio::io_context::run, &client_ioc));
+
+    asio::io_context timer_ioc;
+    asio::steady_timer timer(timer_ioc, asio::chrono::seconds(timeout));
+    timer.wait();
+
+    server_ioc.stop();
+    client_ioc.stop();
+
+    asio::chrono::steady_clock::duration elapsed
+      = asio::chrono::steady_clock::now() - start;
+    double seconds = asio::chrono::duration_cast<
+      asio::chrono::microseconds>(elapsed).count() / 1000000.0;
+
+    server_thread.join();
+    client_thread.join();
+
+    double mebibytes = c.bytes_read() / 1048576.0;
+    std::cout << c.bytes_read() << " bytes in " << seconds << " seconds\n";
+    std::cout << (mebibytes / seconds) << " MiB/s\n";
+    if (mebibytes > 0)
+      std::cout << (c.reads() / mebibytes) << " reads per MiB\n";
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << "\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,327 @@
+//
+// ssl_handshake_latency.cpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures how late a periodic timer runs on a server's io_context while a
+// number of clients repeatedly connect and perform TLS 1.3 handshakes, so that
+// handshakes arrive in a storm. The server performs its handshakes either on
+// its io_context's thread, or on a thread pool that is set as each stream's
+// handshake executor, e.g.:
+//
+//   ssl_handshake_latency 16 0 10
+//   ssl_handshake_latency 16 2 10
+
+#include "asio.hpp"
+#include "asio/ssl.hpp"
+#include <boost/bind/bind.hpp>
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+typedef asio::ssl::stream<asio::ip::tcp::socket> ssl_socket;
+
+// Give the server a self-signed certificate for a new P-256 key.
+void use_self_signed_certificate(asio::ssl::context& ctx)
+{
+  EVP_PKEY* key = 0;
+  EVP_PKEY_CTX* key_ctx = ::EVP_PKEY_CTX_new_id(EVP_PKEY_EC, 0);
+  ::EVP_PKEY_keygen_init(key_ctx);
+  ::EVP_PKEY_CTX_set_ec_paramgen_curve_nid(key_ctx, NID_X9_62_prime256v1);
+  ::EVP_PKEY_keygen(key_ctx, &key);
+  ::EVP_PKEY_CTX_free(key_ctx);
+
+  X509* cert = ::X509_new();
+  ::X509_set_version(cert, 2);
+  ::ASN1_INTEGER_set(::X509_get_serialNumber(cert), 1);
+  ::X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+  ::X509_gmtime_adj(X509_getm_notAfter(cert), 60 * 60);
+  ::X509_set_pubkey(cert, key);
+  X509_NAME* name = ::X509_get_subject_name(cert);
+  ::X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+      reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+  ::X509_set_issuer_name(cert, name);
+  ::X509_sign(cert, key, ::EVP_sha256());
+
+  ::SSL_CTX_use_certificate(ctx.native_handle(), cert);
+  ::SSL_CTX_use_PrivateKey(ctx.native_handle(), key);
+  ::X509_free(cert);
+  ::EVP_PKEY_free(key);
+}
+
+class session
+{
+public:
+  session(asio::io_context& ioc, asio::ssl::context& ctx,
+      std::size_t& handshakes)
+    : socket_(ioc, ctx),
+      handshakes_(handshakes)
+  {
+  }
+
+  ssl_socket::lowest_layer_type& socket()
+  {
+    return socket_.lowest_layer();
+  }
+
+  void start(asio::thread_pool* pool)
+  {
+    if (pool)
+      socket_.set_handshake_executor(pool->get_executor());
+    socket_.async_handshake(asio::ssl::stream_base::server,
+        boost::bind(&session::handle_handshake, this,
+          asio::placeholders::error));
+  }
+
+private:
+  void handle_handshake(const asio::error_code& err)
+  {
+    if (!err)
+      ++handshakes_;
+    delete this;
+  }
+
+  ssl_socket socket_;
+  std::size_t& handshakes_;
+};
+
+class server
+{
+public:
+  server(asio::io_context& ioc, asio::ssl::context& ctx,
+      asio::thread_pool* pool)
+    : io_context_(ioc),
+      context_(ctx),
+      pool_(pool),
+      acceptor_(ioc, asio::ip::tcp::endpoint(
+          asio::ip::address_v4::loopback(), 0)),
+      timer_(ioc),
+      handshakes_(0)
+  {
+    start_accept();
+    timer_.expires_after(asio::chrono::milliseconds(1));
+    start_timer();
+  }
+
+  asio::ip::tcp::endpoint endpoint() const
+  {
+    return acceptor_.local_endpoint();
+  }
+
+  std::size_t handshakes() const
+  {
+    return handshakes_;
+  }
+
+  // The amounts by which the timer was late, in microseconds.
+  std::vector<long>& lateness()
+  {
+    return lateness_;
+  }
+
+private:
+  void start_accept()
+  {
+    session* new_session = new session(io_context_, context_, handshakes_);
+    acceptor_.async_accept(new_session->socket(),
+        boost::bind(&server::handle_accept, this, new_session,
+          asio::placeholders::error));
+  }
+
+  void handle_accept(session* new_session, const asio::error_code& err)
+  {
+    if (!err)
+    {
+      new_session->start(pool_);
+      start_accept();
+    }
+    else
+    {
+      delete new_session;
+    }
+  }
+
+  void start_timer()
+  {
+    timer_.async_wait(boost::bind(&server::handle_timer, this,
+          asio::placeholders::error));
+  }
+
+  void handle_timer(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      asio::steady_timer::time_point now
+        = asio::steady_timer::clock_type::now();
+      lateness_.push_back(static_cast<long>(
+            asio::chrono::duration_cast<asio::chrono::microseconds>(
+              now - timer_.expiry()).count()));
+      timer_.expires_at(now + asio::chrono::milliseconds(1));
+      start_timer();
+    }
+  }
+
+  asio::io_context& io_context_;
+  asio::ssl::context& context_;
+  asio::thread_pool* pool_;
+  asio::ip::tcp::acceptor acceptor_;
+  asio::steady_timer timer_;
+  std::size_t handshakes_;
+  std::vector<long> lateness_;
+};
+
+class client
+{
+public:
+  client(asio::io_context& ioc, asio::ssl::context& ctx,
+      const asio::ip::tcp::endpoint& endpoint)
+    : io_context_(ioc),
+      context_(ctx),
+      socket_(0),
+      endpoint_(endpoint)
+  {
+    start_connect();
+  }
+
+  ~client()
+  {
+    delete socket_;
+  }
+
+private:
+  void start_connect()
+  {
+    delete socket_;
+    socket_ = new ssl_socket(io_context_, context_);
+    socket_->lowest_layer().async_connect(endpoint_,
+        boost::bind(&client::handle_connect, this,
+          asio::placeholders::error));
+  }
+
+  void handle_connect(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      socket_->async_handshake(asio::ssl::stream_base::client,
+          boost::bind(&client::handle_handshake, this,
+            asio::placeholders::error));
+    }
+  }
+
+  void handle_handshake(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      // Reset the connection on close to avoid exhausting ephemeral ports.
+      socket_->lowest_layer().set_option(
+          asio::socket_base::linger(true, 0));
+      start_connect();
+    }
+  }
+
+  asio::io_context& io_context_;
+  asio::ssl::context& context_;
+  ssl_socket* socket_;
+  asio::ip::tcp::endpoint endpoint_;
+};
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    if (argc != 4)
+    {
+      std::cerr << "Usage: ssl_handshake_latency"
+        " <clients> <poolthreads> <time>\n";
+      return 1;
+    }
+
+    using namespace std; // For atoi.
+    int client_count = atoi(argv[1]);
+    int pool_threads = atoi(argv[2]);
+    int timeout = atoi(argv[3]);
+
+    asio::ssl::context server_ctx(asio::ssl::context::tlsv13_server);
+    use_self_signed_certificate(server_ctx);
+    ::SSL_CTX_set_session_cache_mode(server_ctx.native_handle(),
+        SSL_SESS_CACHE_OFF);
+    ::SSL_CTX_set_num_tickets(server_ctx.native_handle(), 0);
+
+    asio::ssl::context client_ctx(asio::ssl::context::tlsv13_client);
+
+    asio::thread_pool* pool = 0;
+    if (pool_threads > 0)
+      pool = new asio::thread_pool(pool_threads);
+
+    asio::io_context server_ioc(1);
+    server s(server_ioc, server_ctx, pool);
+
+    asio::io_context client_ioc;
+    std::vector<client*> clients;
+    for (int i = 0; i < client_count; ++i)
+      clients.push_back(new client(client_ioc, client_ctx, s.endpoint()));
+
+    asio::chrono::steady_clock::time_point start
+      = asio::chrono::steady_clock::now();
+
+    asio::thread server_thread(
+        boost::bind(&asio::io_context::run, &server_ioc));
+    std::vector<asio::thread*> client_threads;
+    for (int i = 0; i < 2; ++i)
+    {
+      client_threads.push_back(new asio::thread(
+            boost::bind(&asio::io_context::run, &client_ioc)));
+    }
+
+    asio::io_context timer_ioc;
+    asio::steady_timer timer(timer_ioc, asio::chrono::seconds(timeout));
+    timer.wait();
+
+    server_ioc.stop();
+    client_ioc.stop();
+
+    asio::chrono::steady_clock::duration elapsed
+      = asio::chrono::steady_clock::now() - start;
+    double seconds = asio::chrono::duration_cast<
+      asio::chrono::microseconds>(elapsed).count() / 1000000.0;
+
+    server_thread.join();
+    for (std::size_t i = 0; i < client_threads.size(); ++i)
+    {
+      client_threads[i]->join();
+      delete client_threads[i];
+    }
+
+    if (pool)
+      pool->join();
+
+    std::cout << s.handshakes() << " handshakes in "
+      << seconds << " seconds\n";
+    std::cout << (s.handshakes() / seconds) << " handshakes per second\n";
+
+    std::vector<long>& lateness = s.lateness();
+    if (!lateness.empty())
+    {
+      std::sort(lateness.begin(), lateness.end());
+      std::cout << "Timer lateness (usec): median "
+        << lateness[lateness.size() / 2] << ", 99th percentile "
+        << lateness[lateness.size() * 99 / 100] << ", maximum "
+        << lateness.back() << "\n";
+    }
+
+    for (int i = 0; i < client_count; ++i)
+      delete clients[i];
+    delete pool;
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << "\n";
+  }
+
+  return 0;
+}
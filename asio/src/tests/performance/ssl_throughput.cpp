@@ -0,0 +1,275 @@
+//
+// ssl_throughput.cpp
+// ~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the rate at which data is transferred over a TLS 1.3 connection on
+// loopback using the TLS_AES_128_GCM_SHA256 cipher suite. A client thread
+// writes blocks of data as fast as it can, and a server thread reads them.
+// The streams either encrypt records in user space, or use kernel TLS, e.g.:
+//
+//   ssl_throughput 65536 10 0
+//   ssl_throughput 65536 10 1
+
+#include "asio.hpp"
+#include "asio/ssl.hpp"
+#include <boost/bind/bind.hpp>
+#include <iostream>
+#include <vector>
+
+typedef asio::ssl::stream<asio::ip::tcp::socket> ssl_socket;
+
+// Give the server a self-signed certificate for a new P-256 key.
+void use_self_signed_certificate(asio::ssl::context& ctx)
+{
+  EVP_PKEY* key = 0;
+  EVP_PKEY_CTX* key_ctx = ::EVP_PKEY_CTX_new_id(EVP_PKEY_EC, 0);
+  ::EVP_PKEY_keygen_init(key_ctx);
+  ::EVP_PKEY_CTX_set_ec_paramgen_curve_nid(key_ctx, NID_X9_62_prime256v1);
+  ::EVP_PKEY_keygen(key_ctx, &key);
+  ::EVP_PKEY_CTX_free(key_ctx);
+
+  X509* cert = ::X509_new();
+  ::X509_set_version(cert, 2);
+  ::ASN1_INTEGER_set(::X509_get_serialNumber(cert), 1);
+  ::X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+  ::X509_gmtime_adj(X509_getm_notAfter(cert), 60 * 60);
+  ::X509_set_pubkey(cert, key);
+  X509_NAME* name = ::X509_get_subject_name(cert);
+  ::X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+      reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+  ::X509_set_issuer_name(cert, name);
+  ::X509_sign(cert, key, ::EVP_sha256());
+
+  ::SSL_CTX_use_certificate(ctx.native_handle(), cert);
+  ::SSL_CTX_use_PrivateKey(ctx.native_handle(), key);
+  ::X509_free(cert);
+  ::EVP_PKEY_free(key);
+}
+
+class server
+{
+public:
+  server(asio::io_context& ioc, asio::ssl::context& ctx,
+      std::size_t block_size, bool kernel_tls)
+    : acceptor_(ioc, asio::ip::tcp::endpoint(
+          asio::ip::address_v4::loopback(), 0)),
+      socket_(ioc, ctx),
+      kernel_tls_(kernel_tls),
+      buffer_(block_size),
+      bytes_read_(0)
+  {
+    acceptor_.async_accept(socket_.next_layer(),
+        boost::bind(&server::handle_accept, this,
+          asio::placeholders::error));
+  }
+
+  asio::ip::tcp::endpoint endpoint() const
+  {
+    return acceptor_.local_endpoint();
+  }
+
+  std::size_t bytes_read() const
+  {
+    return bytes_read_;
+  }
+
+  bool kernel_tls_receive() const
+  {
+#if defined(ASIO_HAS_SSL_KERNEL_TLS)
+    return socket_.kernel_tls_receive();
+#else // defined(ASIO_HAS_SSL_KERNEL_TLS)
+    return false;
+#endif // defined(ASIO_HAS_SSL_KERNEL_TLS)
+  }
+
+private:
+  void handle_accept(const asio::error_code& err)
+  {
+    if (!err)
+    {
+#if defined(ASIO_HAS_SSL_KERNEL_TLS)
+      if (kernel_tls_)
+        socket_.use_kernel_tls();
+#endif // defined(ASIO_HAS_SSL_KERNEL_TLS)
+      socket_.async_handshake(asio::ssl::stream_base::server,
+          boost::bind(&server::handle_handshake, this,
+            asio::placeholders::error));
+    }
+  }
+
+  void handle_handshake(const asio::error_code& err)
+  {
+    if (!err)
+      start_read();
+    else
+      std::cerr << "Server handshake: " << err.message() << "\n";
+  }
+
+  void start_read()
+  {
+    socket_.async_read_some(asio::buffer(buffer_),
+        boost::bind(&server::handle_read, this,
+          asio::placeholders::error,
+          asio::placeholders::bytes_transferred));
+  }
+
+  void handle_read(const asio::error_code& err, std::size_t n)
+  {
+    if (!err)
+    {
+      bytes_read_ += n;
+      start_read();
+    }
+  }
+
+  asio::ip::tcp::acceptor acceptor_;
+  ssl_socket socket_;
+  bool kernel_tls_;
+  std::vector<char> buffer_;
+  std::size_t bytes_read_;
+};
+
+class client
+{
+public:
+  client(asio::io_context& ioc, asio::ssl::context& ctx,
+      const asio::ip::tcp::endpoint& endpoint,
+      std::size_t block_size, bool kernel_tls)
+    : socket_(ioc, ctx),
+      kernel_tls_(kernel_tls),
+      buffer_(block_size, 'x')
+  {
+    socket_.next_layer().async_connect(endpoint,
+        boost::bind(&client::handle_connect, this,
+          asio::placeholders::error));
+  }
+
+  bool kernel_tls_send() const
+  {
+#if defined(ASIO_HAS_SSL_KERNEL_TLS)
+    return socket_.kernel_tls_send();
+#else // defined(ASIO_HAS_SSL_KERNEL_TLS)
+    return false;
+#endif // defined(ASIO_HAS_SSL_KERNEL_TLS)
+  }
+
+private:
+  void handle_connect(const asio::error_code& err)
+  {
+    if (!err)
+    {
+#if defined(ASIO_HAS_SSL_KERNEL_TLS)
+      if (kernel_tls_)
+        socket_.use_kernel_tls();
+#endif // defined(ASIO_HAS_SSL_KERNEL_TLS)
+      socket_.async_handshake(asio::ssl::stream_base::client,
+          boost::bind(&client::handle_handshake, this,
+            asio::placeholders::error));
+    }
+  }
+
+  void handle_handshake(const asio::error_code& err)
+  {
+    if (!err)
+      start_write();
+    else
+      std::cerr << "Client handshake: " << err.message() << "\n";
+  }
+
+  void start_write()
+  {
+    asio::async_write(socket_, asio::buffer(buffer_),
+        boost::bind(&client::handle_write, this,
+          asio::placeholders::error));
+  }
+
+  void handle_write(const asio::error_code& err)
+  {
+    if (!err)
+      start_write();
+  }
+
+  ssl_socket socket_;
+  bool kernel_tls_;
+  std::vector<char> buffer_;
+};
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    if (argc != 4)
+    {
+      std::cerr << "Usage: ssl_throughput <blocksize> <time> <kerneltls>\n";
+      return 1;
+    }
+
+    using namespace std; // For atoi.
+    std::size_t block_size = atoi(argv[1]);
+    int timeout = atoi(argv[2]);
+    bool kernel_tls = atoi(argv[3]) != 0;
+
+#if !defined(ASIO_HAS_SSL_KERNEL_TLS)
+    if (kernel_tls)
+    {
+      std::cerr << "Kernel TLS is not supported on this platform\n";
+      return 1;
+    }
+#endif // !defined(ASIO_HAS_SSL_KERNEL_TLS)
+
+    asio::ssl::context server_ctx(asio::ssl::context::tlsv13_server);
+    use_self_signed_certificate(server_ctx);
+    ::SSL_CTX_set_ciphersuites(server_ctx.native_handle(),
+        "TLS_AES_128_GCM_SHA256");
+
+    asio::ssl::context client_ctx(asio::ssl::context::tlsv13_client);
+    ::SSL_CTX_set_ciphersuites(client_ctx.native_handle(),
+        "TLS_AES_128_GCM_SHA256");
+
+    asio::io_context server_ioc(1);
+    server s(server_ioc, server_ctx, block_size, kernel_tls);
+
+    asio::io_context client_ioc(1);
+    client c(client_ioc, client_ctx, s.endpoint(), block_size, kernel_tls);
+
+    asio::chrono::steady_clock::time_point start
+      = asio::chrono::steady_clock::now();
+
+    asio::thread server_thread(
+        boost::bind(&asio::io_context::run, &server_ioc));
+    asio::thread client_thread(
+        boost::bind(&asio::io_context::run, &client_ioc));
+
+    asio::io_context timer_ioc;
+    asio::steady_timer timer(timer_ioc, asio::chrono::seconds(timeout));
+    timer.wait();
+
+    server_ioc.stop();
+    client_ioc.stop();
+
+    asio::chrono::steady_clock::duration elapsed
+      = asio::chrono::steady_clock::now() - start;
+    double seconds = asio::chrono::duration_cast<
+      asio::chrono::microseconds>(elapsed).count() / 1000000.0;
+
+    server_thread.join();
+    client_thread.join();
+
+    std::cout << s.bytes_read() << " bytes in " << seconds << " seconds\n";
+    std::cout << (s.bytes_read() / seconds / 1048576.0) << " MiB/s\n";
+    std::cout << "Kernel TLS send: " << (c.kernel_tls_send() ? "yes" : "no")
+      << ", receive: " << (s.kernel_tls_receive() ? "yes" : "no") << "\n";
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << "\n";
+  }
+
+  return 0;
+}
@@ -0,0 +1,276 @@
+//
+// ssl_write_records.cpp
+// ~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the number of TLS records, and the rate at which data is
+// transferred, when a client repeatedly writes a message made up of a header
+// and a body as a two-element buffer sequence over a TLS 1.3 connection on
+// loopback, e.g.:
+//
+//   ssl_write_records 200 1024 10
+//   ssl_write_records 10000 100 10
+//   ssl_write_records 400 65536 10
+
+#include "asio.hpp"
+#include "asio/ssl.hpp"
+#include <boost/bind/bind.hpp>
+#include <iostream>
+#include <vector>
+
+typedef asio::ssl::stream<asio::ip::tcp::socket> ssl_socket;
+
+// Give the server a self-signed certificate for a new P-256 key.
+void use_self_signed_certificate(asio::ssl::context& ctx)
+{
+  EVP_PKEY* key = 0;
+  EVP_PKEY_CTX* key_ctx = ::EVP_PKEY_CTX_new_id(EVP_PKEY_EC, 0);
+  ::EVP_PKEY_keygen_init(key_ctx);
+  ::EVP_PKEY_CTX_set_ec_paramgen_curve_nid(key_ctx, NID_X9_62_prime256v1);
+  ::EVP_PKEY_keygen(key_ctx, &key);
+  ::EVP_PKEY_CTX_free(key_ctx);
+
+  X509* cert = ::X509_new();
+  ::X509_set_version(cert, 2);
+  ::ASN1_INTEGER_set(::X509_get_serialNumber(cert), 1);
+  ::X509_gmtime_adj(X509_getm_notBefore(cert), 0);
+  ::X509_gmtime_adj(X509_getm_notAfter(cert), 60 * 60);
+  ::X509_set_pubkey(cert, key);
+  X509_NAME* name = ::X509_get_subject_name(cert);
+  ::X509_NAME_add_entry_by_txt(name, "CN", MBSTRING_ASC,
+      reinterpret_cast<const unsigned char*>("localhost"), -1, -1, 0);
+  ::X509_set_issuer_name(cert, name);
+  ::X509_sign(cert, key, ::EVP_sha256());
+
+  ::SSL_CTX_use_certificate(ctx.native_handle(), cert);
+  ::SSL_CTX_use_PrivateKey(ctx.native_handle(), key);
+  ::X509_free(cert);
+  ::EVP_PKEY_free(key);
+}
+
+class server
+{
+public:
+  server(asio::io_context& ioc, asio::ssl::context& ctx)
+    : acceptor_(ioc, asio::ip::tcp::endpoint(
+          asio::ip::address_v4::loopback(), 0)),
+      socket_(ioc, ctx),
+      buffer_(65536),
+      bytes_read_(0)
+  {
+    acceptor_.async_accept(socket_.next_layer(),
+        boost::bind(&server::handle_accept, this,
+          asio::placeholders::error));
+  }
+
+  asio::ip::tcp::endpoint endpoint() const
+  {
+    return acceptor_.local_endpoint();
+  }
+
+  std::size_t bytes_read() const
+  {
+    return bytes_read_;
+  }
+
+private:
+  void handle_accept(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      socket_.async_handshake(asio::ssl::stream_base::server,
+          boost::bind(&server::handle_handshake, this,
+            asio::placeholders::error));
+    }
+  }
+
+  void handle_handshake(const asio::error_code& err)
+  {
+    if (!err)
+      start_read();
+    else
+      std::cerr << "Server handshake: " << err.message() << "\n";
+  }
+
+  void start_read()
+  {
+    socket_.async_read_some(asio::buffer(buffer_),
+        boost::bind(&server::handle_read, this,
+          asio::placeholders::error,
+          asio::placeholders::bytes_transferred));
+  }
+
+  void handle_read(const asio::error_code& err, std::size_t n)
+  {
+    if (!err)
+    {
+      bytes_read_ += n;
+      start_read();
+    }
+  }
+
+  asio::ip::tcp::acceptor acceptor_;
+  ssl_socket socket_;
+  std::vector<char> buffer_;
+  std::size_t bytes_read_;
+};
+
+class client
+{
+public:
+  client(asio::io_context& ioc, asio::ssl::context& ctx,
+      const asio::ip::tcp::endpoint& endpoint,
+      std::size_t header_size, std::size_t body_size)
+    : socket_(ioc, ctx),
+      header_(header_size, 'h'),
+      body_(body_size, 'b'),
+      messages_written_(0),
+      records_written_(0)
+  {
+    buffers_.push_back(asio::buffer(header_));
+    buffers_.push_back(asio::buffer(body_));
+    socket_.next_layer().async_connect(endpoint,
+        boost::bind(&client::handle_connect, this,
+          asio::placeholders::error));
+  }
+
+  std::size_t messages_written() const
+  {
+    return messages_written_;
+  }
+
+  std::size_t records_written() const
+  {
+    return records_written_;
+  }
+
+private:
+  // Count the application data records written once the handshake is done.
+  static void count_record(int write_p, int /*version*/, int content_type,
+      const void* /*buf*/, size_t /*len*/, SSL* /*ssl*/, void* arg)
+  {
+    if (write_p && content_type == SSL3_RT_HEADER)
+      ++static_cast<client*>(arg)->records_written_;
+  }
+
+  void handle_connect(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      socket_.async_handshake(asio::ssl::stream_base::client,
+          boost::bind(&client::handle_handshake, this,
+            asio::placeholders::error));
+    }
+  }
+
+  void handle_handshake(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      ::SSL_set_msg_callback(socket_.native_handle(), &client::count_record);
+      ::SSL_set_msg_callback_arg(socket_.native_handle(), this);
+      start_write();
+    }
+    else
+    {
+      std::cerr << "Client handshake: " << err.message() << "\n";
+    }
+  }
+
+  void start_write()
+  {
+    asio::async_write(socket_, buffers_,
+        boost::bind(&client::handle_write, this,
+          asio::placeholders::error));
+  }
+
+  void handle_write(const asio::error_code& err)
+  {
+    if (!err)
+    {
+      ++messages_written_;
+      start_write();
+    }
+  }
+
+  ssl_socket socket_;
+  std::vector<char> header_;
+  std::vector<char> body_;
+  std::vector<asio::const_buffer> buffers_;
+  std::size_t messages_written_;
+  std::size_t records_written_;
+};
+
+int main(int argc, char* argv[])
+{
+  try
+  {
+    if (argc != 4)
+    {
+      std::cerr << "Usage: ssl_write_records <headersize> <bodysize> <time>\n";
+      return 1;
+    }
+
+    using namespace std; // For atoi.
+    std::size_t header_size = atoi(argv[1]);
+    std::size_t body_size = atoi(argv[2]);
+    int timeout = atoi(argv[3]);
+
+    asio::ssl::context server_ctx(asio::ssl::context::tlsv13_server);
+    use_self_signed_certificate(server_ctx);
+    ::SSL_CTX_set_ciphersuites(server_ctx.native_handle(),
+        "TLS_AES_128_GCM_SHA256");
+
+    asio::ssl::context client_ctx(asio::ssl::context::tlsv13_client);
+    ::SSL_CTX_set_ciphersuites(client_ctx.native_handle(),
+        "TLS_AES_128_GCM_SHA256");
+
+    asio::io_context server_ioc(1);
+    server s(server_ioc, server_ctx);
+
+    asio::io_context client_ioc(1);
+    client c(client_ioc, client_ctx, s.endpoint(), header_size, body_size);
+
+    asio::chrono::steady_clock::time_point start
+      = asio::chrono::steady_clock::now();
+
+    asio::thread server_thread(
+        boost::bind(&asio::io_context::run, &server_ioc));
+    asio::thread client_thread(
+        boost::bind(&asio::io_context::run, &client_ioc));
+
+    asio::io_context timer_ioc;
+    asio::steady_timer timer(timer_ioc, asio::chrono::seconds(timeout));
+    timer.wait();
+
+    server_ioc.stop();
+    client_ioc.stop();
+
+    asio::chrono::steady_clock::duration elapsed
+      = asio::chrono::steady_clock::now() - start;
+    double seconds = asio::chrono::duration_cast<
+      asio::chrono::microseconds>(elapsed).count() / 1000000.0;
+
+    server_thread.join();
+    client_thread.join();
+
+    std::size_t messages = c.messages_written();
+    std::size_t records = c.records_written();
+    std::cout << messages << " messages in " << seconds << " seconds\n";
+    std::cout << (messages / seconds) << " messages per second\n";
+    std::cout << (s.bytes_read() / seconds / 1048576.0) << " MiB/s\n";
+    std::cout << (messages ? 1.0 * records / messages : 0.0)
+      << " records per message\n";
+  }
+  catch (std::exception& e)
+  {
+    std::cerr << "Exception: " << e.what() << "\n";
+  }
+
+  return 0;
+}
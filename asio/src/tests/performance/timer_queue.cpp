@@ -0,0 +1,159 @@
+//
+// timer_queue.cpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Measures the cost of maintaining large numbers of timers in the binary heap
+// timer queue, used with asio::wait_traits, and in the timing wheel, used with
+// asio::wheel_wait_traits. Each timer is scheduled with a random expiry of
+// between 1 and 61 seconds, then cancelled and rescheduled as an idle timeout
+// would be, and finally expired by advancing a simulated clock 1ms at a time,
+// e.g.:
+//
+//   timer_queue 10000 1000000 10000000
+
+#include "asio.hpp"
+#include <cstdlib>
+#include <iostream>
+
+struct simulated_clock
+{
+  typedef asio::chrono::steady_clock::duration duration;
+  typedef duration::rep rep;
+  typedef duration::period period;
+  typedef asio::chrono::time_point<simulated_clock> time_point;
+  static const bool is_steady = true;
+
+  static time_point now()
+  {
+    return current;
+  }
+
+  static time_point current;
+};
+
+simulated_clock::time_point simulated_clock::current;
+
+class null_op
+  : public asio::detail::wait_op
+{
+public:
+  null_op()
+    : asio::detail::wait_op(&null_op::do_complete)
+  {
+  }
+
+  static void do_complete(void*, asio::detail::operation*,
+      const asio::error_code&, std::size_t)
+  {
+  }
+};
+
+class random_expiry
+{
+public:
+  random_expiry()
+    : state_(12345)
+  {
+  }
+
+  simulated_clock::time_point operator()()
+  {
+    state_ = state_ * 6364136223846793005ULL + 1442695040888963407ULL;
+    return simulated_clock::now() + asio::chrono::milliseconds(
+        1000 + static_cast<int>((state_ >> 33) % 60000));
+  }
+
+private:
+  asio::uint64_t state_;
+};
+
+double nsec_per_timer(asio::chrono::steady_clock::time_point start,
+    std::size_t num_timers)
+{
+  asio::chrono::steady_clock::duration elapsed
+    = asio::chrono::steady_clock::now() - start;
+  return static_cast<double>(asio::chrono::duration_cast<
+      asio::chrono::nanoseconds>(elapsed).count()) / num_timers;
+}
+
+template <typename WaitTraits>
+void run_test(const char* name, std::size_t num_timers)
+{
+  typedef asio::detail::timer_queue<
+    asio::detail::chrono_time_traits<simulated_clock, WaitTraits> >
+      queue_type;
+
+  simulated_clock::current = simulated_clock::time_point();
+
+  queue_type* queue = new queue_type;
+  typename queue_type::per_timer_data* timers
+    = new typename queue_type::per_timer_data[num_timers];
+  null_op* ops = new null_op[num_timers];
+  asio::detail::op_queue<asio::detail::operation> ready;
+  random_expiry expiry;
+
+  asio::chrono::steady_clock::time_point start
+    = asio::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < num_timers; ++i)
+    queue->enqueue_timer(expiry(), timers[i], &ops[i]);
+  double schedule = nsec_per_timer(start, num_timers);
+
+  start = asio::chrono::steady_clock::now();
+  for (std::size_t i = 0; i < num_timers; ++i)
+  {
+    queue->cancel_timer(timers[i], ready);
+    ready.pop();
+    queue->enqueue_timer(expiry(), timers[i], &ops[i]);
+  }
+  double reschedule = nsec_per_timer(start, num_timers);
+
+  std::size_t num_expired = 0;
+  start = asio::chrono::steady_clock::now();
+  while (!queue->empty())
+  {
+    simulated_clock::current += asio::chrono::milliseconds(1);
+    queue->get_ready_timers(ready);
+    while (ready.front())
+    {
+      ready.pop();
+      ++num_expired;
+    }
+  }
+  double expire = nsec_per_timer(start, num_timers);
+
+  std::cout << name << " " << num_timers << " timers:"
+    << " schedule " << schedule << " ns,"
+    << " reschedule " << reschedule << " ns,"
+    << " expire " << expire << " ns per timer";
+  if (num_expired != num_timers)
+    std::cout << " (only " << num_expired << " expired)";
+  std::cout << std::endl;
+
+  delete[] ops;
+  delete[] timers;
+  delete queue;
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: timer_queue <num_timers> [<num_timers> ...]\n";
+    return 1;
+  }
+
+  for (int arg = 1; arg < argc; ++arg)
+  {
+    std::size_t num_timers = std::atoi(argv[arg]);
+    run_test<asio::wait_traits<simulated_clock> >("heap ", num_timers);
+    run_test<asio::wheel_wait_traits<simulated_clock> >("wheel", num_timers);
+  }
+
+  return 0;
+}
@@ -0,0 +1,181 @@
+//
+// timer_slack.cpp
+// ~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Counts the wake-ups per second needed to run a large number of idle timers,
+// each of which is restarted with a random timeout of between 1 and 2 seconds
+// whenever it expires. A wake-up is a batch of timer completions that the
+// scheduler delivers together. Run without slack, and with slack that lets
+// the timers' wake-ups be coalesced, e.g.:
+//
+//   timer_slack 100000 0 10
+//   timer_slack 100000 100 10
+
+#include "asio.hpp"
+#include <boost/bind/bind.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+struct idle_wait_traits
+  : asio::wait_traits<asio::chrono::steady_clock>
+{
+  static asio::chrono::steady_clock::duration timer_slack()
+  {
+    return slack;
+  }
+
+  static asio::chrono::steady_clock::duration slack;
+};
+
+asio::chrono::steady_clock::duration idle_wait_traits::slack;
+
+typedef asio::basic_waitable_timer<
+    asio::chrono::steady_clock, idle_wait_traits> idle_timer;
+
+class wakeup_counter
+{
+public:
+  wakeup_counter(asio::io_context& ioc)
+    : io_context_(ioc),
+      in_wakeup_(false),
+      stopped_(false),
+      wakeups_(0),
+      completions_(0)
+  {
+  }
+
+  void count_completion()
+  {
+    // Completions that the scheduler delivers together are all run before
+    // the posted handler, which marks the end of the wake-up.
+    if (!in_wakeup_)
+    {
+      in_wakeup_ = true;
+      ++wakeups_;
+      asio::post(io_context_,
+          boost::bind(&wakeup_counter::end_wakeup, this));
+    }
+    ++completions_;
+  }
+
+  void stop()
+  {
+    stopped_ = true;
+  }
+
+  bool stopped() const
+  {
+    return stopped_;
+  }
+
+  std::size_t wakeups() const
+  {
+    return wakeups_;
+  }
+
+  std::size_t completions() const
+  {
+    return completions_;
+  }
+
+private:
+  void end_wakeup()
+  {
+    in_wakeup_ = false;
+  }
+
+  asio::io_context& io_context_;
+  bool in_wakeup_;
+  bool stopped_;
+  std::size_t wakeups_;
+  std::size_t completions_;
+};
+
+class idle_connection
+{
+public:
+  idle_connection(asio::io_context& ioc,
+      wakeup_counter& counter, unsigned int seed)
+    : timer_(ioc),
+      counter_(counter),
+      seed_(seed)
+  {
+    start();
+  }
+
+  void stop()
+  {
+    timer_.cancel();
+  }
+
+private:
+  void start()
+  {
+    seed_ = seed_ * 1103515245 + 12345;
+    timer_.expires_after(
+        asio::chrono::milliseconds(1000 + (seed_ >> 8) % 1000));
+    timer_.async_wait(boost::bind(&idle_connection::handle_wait,
+          this, asio::placeholders::error));
+  }
+
+  void handle_wait(const asio::error_code& err)
+  {
+    if (!err && !counter_.stopped())
+    {
+      counter_.count_completion();
+      start();
+    }
+  }
+
+  idle_timer timer_;
+  wakeup_counter& counter_;
+  unsigned int seed_;
+};
+
+void stop_all(wakeup_counter* counter,
+    std::vector<idle_connection*>* connections)
+{
+  counter->stop();
+  for (std::size_t i = 0; i < connections->size(); ++i)
+    (*connections)[i]->stop();
+}
+
+int main(int argc, char* argv[])
+{
+  if (argc != 4)
+  {
+    std::cerr << "Usage: timer_slack <num_timers> <slack_msec> <seconds>\n";
+    return 1;
+  }
+
+  std::size_t num_timers = std::atoi(argv[1]);
+  idle_wait_traits::slack = asio::chrono::milliseconds(std::atoi(argv[2]));
+  int seconds = std::atoi(argv[3]);
+
+  asio::io_context ioc(1);
+  wakeup_counter counter(ioc);
+
+  std::vector<idle_connection*> connections;
+  for (std::size_t i = 0; i < num_timers; ++i)
+    connections.push_back(new idle_connection(ioc, counter, i));
+
+  asio::steady_timer stop_timer(ioc, asio::chrono::seconds(seconds));
+  stop_timer.async_wait(boost::bind(stop_all, &counter, &connections));
+
+  ioc.run();
+
+  std::cout << counter.completions() / seconds << " timer completions/sec, "
+    << counter.wakeups() / seconds << " wake-ups/sec\n";
+
+  for (std::size_t i = 0; i < connections.size(); ++i)
+    delete connections[i];
+
+  return 0;
+}
@@ -0,0 +1,130 @@
+//
+// basic_acceptor_group.cpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/basic_acceptor_group.hpp"
+
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "unit_test.hpp"
+
+#if defined(ASIO_HAS_REUSEPORT_CBPF)
+# include <sched.h>
+#endif // defined(ASIO_HAS_REUSEPORT_CBPF)
+
+//------------------------------------------------------------------------------
+
+// basic_acceptor_group_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that connections are steered to the acceptor
+// selected by the CPU on which they were received.
+
+namespace basic_acceptor_group_runtime {
+
+void test()
+{
+#if defined(ASIO_HAS_REUSEPORT_CBPF)
+  using namespace asio;
+  namespace ip = asio::ip;
+
+  io_context ioc1;
+  io_context ioc2;
+
+  basic_acceptor_group<ip::tcp> group(
+      ip::tcp::endpoint(ip::address_v4::loopback(), 0));
+  ASIO_CHECK(group.size() == 0);
+
+  asio::error_code ec;
+  group.listen(socket_base::max_listen_connections, ec);
+  ASIO_CHECK(ec == asio::error::invalid_argument);
+
+  group.add(ioc1);
+  group.add(ioc2.get_executor());
+  group.listen();
+
+  ASIO_CHECK(group.size() == 2);
+  ASIO_CHECK(group.local_endpoint().port() != 0);
+  ASIO_CHECK(group[0].local_endpoint() == group.local_endpoint());
+  ASIO_CHECK(group[1].local_endpoint() == group.local_endpoint());
+  ASIO_CHECK(group[0].get_executor() == ioc1.get_executor());
+  ASIO_CHECK(group[1].get_executor() == ioc2.get_executor());
+
+  group[0].non_blocking(true);
+  group[1].non_blocking(true);
+
+  // On loopback, a connection is received on the CPU of the connecting
+  // thread. Connect several times from each CPU in turn, where the affinity
+  // can be set, so that hashing across the group would be detected.
+  cpu_set_t original_cpus;
+  CPU_ZERO(&original_cpus);
+  bool has_affinity = ::sched_getaffinity(0,
+      sizeof(original_cpus), &original_cpus) == 0;
+
+  int connections = 0;
+  for (int attempt = 0; attempt < 32; ++attempt)
+  {
+    int cpu = attempt % 8;
+    if (has_affinity)
+    {
+      if (!CPU_ISSET(cpu, &original_cpus))
+        continue;
+      cpu_set_t cpus;
+      CPU_ZERO(&cpus);
+      CPU_SET(cpu, &cpus);
+      ::sched_setaffinity(0, sizeof(cpus), &cpus);
+    }
+
+    ip::tcp::socket client_socket(ioc1);
+    client_socket.connect(group.local_endpoint());
+
+    int accepted_on = -1;
+    for (std::size_t i = 0; i < group.size(); ++i)
+    {
+      ip::tcp::socket server_socket(ioc1);
+      group[i].accept(server_socket, ec);
+      if (!ec)
+      {
+        ASIO_CHECK(accepted_on == -1);
+        accepted_on = static_cast<int>(i);
+
+        socket_base::incoming_cpu incoming_cpu;
+        server_socket.get_option(incoming_cpu);
+        ASIO_CHECK(incoming_cpu.value() >= 0);
+        ASIO_CHECK(incoming_cpu.value() % 2 == accepted_on);
+      }
+      else
+      {
+        ASIO_CHECK(ec == asio::error::would_block);
+      }
+    }
+    ASIO_CHECK(accepted_on != -1);
+    ++connections;
+  }
+  ASIO_CHECK(connections > 0);
+
+  if (has_affinity)
+    ::sched_setaffinity(0, sizeof(original_cpus), &original_cpus);
+#endif // defined(ASIO_HAS_REUSEPORT_CBPF)
+}
+
+} // namespace basic_acceptor_group_runtime
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "basic_acceptor_group",
+  ASIO_TEST_CASE(basic_acceptor_group_runtime::test)
+)
@@ -0,0 +1,83 @@
+//
+// datagram_message.cpp
+// ~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/datagram_message.hpp"
+
+#include "asio/ip/udp.hpp"
+#include "unit_test.hpp"
+
+//------------------------------------------------------------------------------
+
+// datagram_message_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks the accessors of the datagram_message class.
+
+namespace datagram_message_runtime {
+
+using namespace asio;
+
+void test()
+{
+  char data[16] = "";
+  ip::udp::endpoint endpoint(ip::address_v4::loopback(), 1234);
+
+  datagram_message<ip::udp::endpoint> m1;
+  ASIO_CHECK(m1.buffer().data() == 0);
+  ASIO_CHECK(m1.buffer().size() == 0);
+  ASIO_CHECK(m1.endpoint() == ip::udp::endpoint());
+  ASIO_CHECK(m1.size() == 0);
+  ASIO_CHECK(m1.segment_size() == 0);
+  ASIO_CHECK(m1.timestamp() == 0);
+  ASIO_CHECK(m1.hardware_timestamp() == 0);
+
+  datagram_message<ip::udp::endpoint> m2(buffer(data));
+  ASIO_CHECK(m2.buffer().data() == data);
+  ASIO_CHECK(m2.buffer().size() == sizeof(data));
+  ASIO_CHECK(m2.size() == 0);
+
+  datagram_message<ip::udp::endpoint, const_buffer> m3(
+      buffer(data, 4), endpoint);
+  ASIO_CHECK(m3.buffer().data() == data);
+  ASIO_CHECK(m3.buffer().size() == 4);
+  ASIO_CHECK(m3.endpoint() == endpoint);
+
+  m1.buffer(buffer(data, 8));
+  m1.endpoint(endpoint);
+  m1.size(5);
+  m1.segment_size(2);
+  m1.timestamp(1000000001);
+  m1.hardware_timestamp(2000000002);
+  ASIO_CHECK(m1.buffer().data() == data);
+  ASIO_CHECK(m1.buffer().size() == 8);
+  ASIO_CHECK(m1.endpoint() == endpoint);
+  ASIO_CHECK(m1.size() == 5);
+  ASIO_CHECK(m1.segment_size() == 2);
+  ASIO_CHECK(m1.timestamp() == 1000000001);
+  ASIO_CHECK(m1.hardware_timestamp() == 2000000002);
+
+  m1.endpoint().port(4321);
+  ASIO_CHECK(m1.endpoint().port() == 4321);
+}
+
+} // namespace datagram_message_runtime
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "datagram_message",
+  ASIO_TEST_CASE(datagram_message_runtime::test)
+)
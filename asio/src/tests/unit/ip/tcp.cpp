@@ -20,8 +20,14 @@
 #include "asio/ip/tcp.hpp"
 
 #include <cstring>
+#include "asio/bind_cancellation_slot.hpp"
+#include "asio/buffer_registration.hpp"
+#include "asio/cancellation_signal.hpp"
 #include "asio/io_context.hpp"
+#include "asio/post.hpp"
 #include "asio/read.hpp"
+#include "asio/thread.hpp"
+#include "asio/use_future.hpp"
 #include "asio/write.hpp"
 #include "../unit_test.hpp"
 #include "../archetypes/async_result.hpp"
@@ -71,6 +77,29 @@ void test()
     (void)static_cast<bool>(!no_delay1);
     (void)static_cast<bool>(no_delay1.value());
 
+#if defined(ASIO_HAS_TCP_FAST_OPEN)
+    // fast_open class.
+
+    ip::tcp::acceptor acceptor(ioc);
+    ip::tcp::fast_open fast_open1(16);
+    acceptor.set_option(fast_open1);
+    ip::tcp::fast_open fast_open2;
+    acceptor.get_option(fast_open2);
+    fast_open1 = 16;
+    (void)static_cast<int>(fast_open1.value());
+
+    // fast_open_connect class.
+
+    ip::tcp::fast_open_connect fast_open_connect1(true);
+    sock.set_option(fast_open_connect1);
+    ip::tcp::fast_open_connect fast_open_connect2;
+    sock.get_option(fast_open_connect2);
+    fast_open_connect1 = true;
+    (void)static_cast<bool>(fast_open_connect1);
+    (void)static_cast<bool>(!fast_open_connect1);
+    (void)static_cast<bool>(fast_open_connect1.value());
+#endif // defined(ASIO_HAS_TCP_FAST_OPEN)
+
 #if defined(ASIO_HAS_STD_HASH)
     ip::tcp::endpoint ep;
     (void)static_cast<std::size_t>(std::hash<ip::tcp::endpoint>()(ep));
@@ -333,6 +362,15 @@ void test()
     std::size_t available2 = socket1.available(ec);
     (void)available2;
 
+#if defined(ASIO_HAS_SO_TIMESTAMPING)
+    asio::uint32_t send_id = 0;
+    asio::uint64_t send_time = 0;
+    bool timestamp1 = socket1.receive_send_timestamp(send_id, send_time);
+    (void)timestamp1;
+    bool timestamp2 = socket1.receive_send_timestamp(send_id, send_time, ec);
+    (void)timestamp2;
+#endif // defined(ASIO_HAS_SO_TIMESTAMPING)
+
     socket1.bind(ip::tcp::endpoint(ip::tcp::v4(), 0));
     socket1.bind(ip::tcp::endpoint(ip::tcp::v6(), 0));
     socket1.bind(ip::tcp::endpoint(ip::tcp::v4(), 0), ec);
@@ -461,6 +499,34 @@ void test()
     int i13 = socket1.async_send(null_buffers(), in_flags, lazy);
     (void)i13;
 
+    socket1.async_connect_and_send(ip::tcp::endpoint(ip::tcp::v4(), 0),
+        buffer(mutable_char_buffer), send_handler());
+    socket1.async_connect_and_send(ip::tcp::endpoint(ip::tcp::v4(), 0),
+        const_buffers, send_handler());
+    socket1.async_connect_and_send(ip::tcp::endpoint(ip::tcp::v4(), 0),
+        buffer(const_char_buffer), immediate);
+    int i13c = socket1.async_connect_and_send(
+        ip::tcp::endpoint(ip::tcp::v4(), 0), buffer(const_char_buffer), lazy);
+    (void)i13c;
+
+#if defined(ASIO_HAS_MSG_ZEROCOPY)
+    socket1.async_send_zero_copy(buffer(mutable_char_buffer), send_handler());
+    socket1.async_send_zero_copy(buffer(const_char_buffer), send_handler());
+    socket1.async_send_zero_copy(mutable_buffers, send_handler());
+    socket1.async_send_zero_copy(const_buffers, send_handler());
+    socket1.async_send_zero_copy(buffer(const_char_buffer), immediate);
+    int i13a = socket1.async_send_zero_copy(buffer(const_char_buffer), lazy);
+    (void)i13a;
+#endif // defined(ASIO_HAS_MSG_ZEROCOPY)
+
+#if defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+    zero_copy_receive_buffer zero_copy_buffer(65536);
+    socket1.async_receive_zero_copy(zero_copy_buffer, receive_handler());
+    socket1.async_receive_zero_copy(zero_copy_buffer, immediate);
+    int i13b = socket1.async_receive_zero_copy(zero_copy_buffer, lazy);
+    (void)i13b;
+#endif // defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+
     socket1.receive(buffer(mutable_char_buffer));
     socket1.receive(mutable_buffers);
     socket1.receive(null_buffers());
@@ -549,6 +615,25 @@ void test()
     (void)i26;
     int i27 = socket1.async_read_some(null_buffers(), lazy);
     (void)i27;
+
+#if defined(ASIO_HAS_CHRONO)
+    const chrono::steady_clock::time_point expiry
+      = chrono::steady_clock::now();
+
+    socket1.async_write_some(buffer(const_char_buffer),
+        expiry, write_some_handler());
+    socket1.async_write_some(const_buffers, expiry, write_some_handler());
+    socket1.async_write_some(buffer(const_char_buffer), expiry, immediate);
+    int i28 = socket1.async_write_some(const_buffers, expiry, lazy);
+    (void)i28;
+
+    socket1.async_read_some(buffer(mutable_char_buffer),
+        expiry, read_some_handler());
+    socket1.async_read_some(mutable_buffers, expiry, read_some_handler());
+    socket1.async_read_some(buffer(mutable_char_buffer), expiry, immediate);
+    int i29 = socket1.async_read_some(mutable_buffers, expiry, lazy);
+    (void)i29;
+#endif // defined(ASIO_HAS_CHRONO)
   }
   catch (std::exception&)
   {
@@ -616,6 +701,77 @@ void handle_read_eof(const asio::error_code& err,
   ASIO_CHECK(bytes_transferred == 0);
 }
 
+void handle_read_timeout(const asio::error_code& err,
+    size_t bytes_transferred, bool* called)
+{
+  *called = true;
+  ASIO_CHECK(err == asio::error::timed_out);
+  ASIO_CHECK(bytes_transferred == 0);
+}
+
+#if defined(ASIO_HAS_CHRONO)
+// Reads and then starts a second read with a deadline, which uses the same
+// cancellation slot as the first.
+class read_and_reuse_slot_handler
+{
+public:
+  read_and_reuse_slot_handler(asio::ip::tcp::socket* socket,
+      asio::cancellation_signal* signal, char* data, size_t length,
+      bool* first_called, bool* second_called)
+    : socket_(socket),
+      signal_(signal),
+      data_(data),
+      length_(length),
+      first_called_(first_called),
+      second_called_(second_called)
+  {
+  }
+
+  void operator()(const asio::error_code& err, size_t bytes_transferred)
+  {
+    if (!*first_called_)
+    {
+      *first_called_ = true;
+      ASIO_CHECK(!err);
+      ASIO_CHECK(bytes_transferred == sizeof(write_data));
+
+      socket_->async_read_some(asio::buffer(data_, length_),
+          asio::chrono::steady_clock::now() + asio::chrono::seconds(1),
+          asio::bind_cancellation_slot(signal_->slot(), *this));
+    }
+    else
+    {
+      handle_read_cancel(err, bytes_transferred, second_called_);
+    }
+  }
+
+private:
+  asio::ip::tcp::socket* socket_;
+  asio::cancellation_signal* signal_;
+  char* data_;
+  size_t length_;
+  bool* first_called_;
+  bool* second_called_;
+};
+#endif // defined(ASIO_HAS_CHRONO)
+
+#if defined(ASIO_HAS_THREADS) && defined(ASIO_HAS_STD_FUTURE_CLASS)
+void io_context_run(asio::io_context* ioc)
+{
+  ioc->run();
+}
+
+// Starts a read and blocks until it completes, which relies on another thread
+// running the io_context.
+void read_and_wait(asio::ip::tcp::socket* socket,
+    char* data, size_t length, size_t* bytes_transferred)
+{
+  std::future<size_t> result = socket->async_read_some(
+      asio::buffer(data, length), asio::use_future);
+  *bytes_transferred = result.get();
+}
+#endif // defined(ASIO_HAS_THREADS) && defined(ASIO_HAS_STD_FUTURE_CLASS)
+
 void test()
 {
   using namespace std; // For memcmp.
@@ -686,6 +842,106 @@ void test()
   ASIO_CHECK(write_completed);
   ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
 
+#if defined(ASIO_HAS_MOVE)
+  // Read and write using registered buffers.
+
+  char registered_data[2][sizeof(write_data)];
+  std::vector<asio::mutable_buffer> arena;
+  arena.push_back(asio::buffer(registered_data[0]));
+  arena.push_back(asio::buffer(registered_data[1]));
+  buffer_registration<std::vector<asio::mutable_buffer> >
+    registration = asio::register_buffers(ioc, arena);
+  memcpy(registered_data[0], write_data, sizeof(write_data));
+  memset(registered_data[1], 0, sizeof(write_data));
+
+  read_completed = false;
+  asio::async_read(client_side_socket, registration[1],
+      bindns::bind(handle_read,
+        _1, _2, &read_completed));
+
+  write_completed = false;
+  asio::async_write(server_side_socket,
+      asio::const_registered_buffer(registration[0]),
+      bindns::bind(handle_write,
+        _1, _2, &write_completed));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(read_completed);
+  ASIO_CHECK(write_completed);
+  ASIO_CHECK(memcmp(registered_data[1],
+        write_data, sizeof(write_data)) == 0);
+#endif // defined(ASIO_HAS_MOVE)
+
+#if defined(ASIO_HAS_MSG_ZEROCOPY)
+  // Zero-copy write. The kernel copies the data on loopback, but still
+  // notifies that the pages have been released.
+
+  memset(read_buffer, 0, sizeof(read_buffer));
+  read_completed = false;
+  asio::async_read(client_side_socket,
+      asio::buffer(read_buffer),
+      bindns::bind(handle_read,
+        _1, _2, &read_completed));
+
+  write_completed = false;
+  server_side_socket.async_send_zero_copy(
+      asio::buffer(write_data),
+      bindns::bind(handle_write,
+        _1, _2, &write_completed));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(read_completed);
+  ASIO_CHECK(write_completed);
+  ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+
+  // A second zero-copy write must wait for its own notification.
+
+  memset(read_buffer, 0, sizeof(read_buffer));
+  read_completed = false;
+  asio::async_read(client_side_socket,
+      asio::buffer(read_buffer),
+      bindns::bind(handle_read,
+        _1, _2, &read_completed));
+
+  write_completed = false;
+  server_side_socket.async_send_zero_copy(
+      asio::buffer(write_data),
+      bindns::bind(handle_write,
+        _1, _2, &write_completed));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(read_completed);
+  ASIO_CHECK(write_completed);
+  ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+#endif // defined(ASIO_HAS_MSG_ZEROCOPY)
+
+#if defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+  // Zero-copy read. Data that is not page aligned, as on loopback, is copied.
+
+  bool zero_copy_read_completed = false;
+  zero_copy_receive_buffer zero_copy_buffer(65536);
+  client_side_socket.async_receive_zero_copy(zero_copy_buffer,
+      bindns::bind(handle_read,
+        _1, _2, &zero_copy_read_completed));
+
+  write_completed = false;
+  asio::async_write(server_side_socket,
+      asio::buffer(write_data),
+      bindns::bind(handle_write,
+        _1, _2, &write_completed));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(zero_copy_read_completed);
+  ASIO_CHECK(write_completed);
+  ASIO_CHECK(zero_copy_buffer.size() == sizeof(write_data));
+  ASIO_CHECK(memcmp(zero_copy_buffer.data().data(),
+        write_data, sizeof(write_data)) == 0);
+#endif // defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+
   // Cancelled read.
 
   bool read_cancel_completed = false;
@@ -704,6 +960,73 @@ void test()
   ioc.run();
   ASIO_CHECK(read_cancel_completed);
 
+#if defined(ASIO_HAS_CHRONO)
+  // Read with a deadline that is met.
+
+  bool read_deadline_completed = false;
+  client_side_socket.async_read_some(
+      asio::buffer(read_buffer),
+      asio::chrono::steady_clock::now() + asio::chrono::hours(1),
+      bindns::bind(handle_read,
+        _1, _2, &read_deadline_completed));
+
+  write_completed = false;
+  asio::async_write(server_side_socket,
+      asio::buffer(write_data),
+      bindns::bind(handle_write,
+        _1, _2, &write_completed));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(read_deadline_completed);
+  ASIO_CHECK(write_completed);
+
+  // Read with a deadline that expires.
+
+  bool read_timeout_completed = false;
+  server_side_socket.async_read_some(
+      asio::buffer(read_buffer),
+      asio::chrono::steady_clock::now() + asio::chrono::milliseconds(10),
+      bindns::bind(handle_read_timeout,
+        _1, _2, &read_timeout_completed));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(read_timeout_completed);
+
+  // Read with a deadline and a cancellation slot, where the completion handler
+  // starts another read using the same slot. Cancellation through the slot
+  // must reach the second read.
+
+  asio::cancellation_signal slot_signal;
+  bool first_read_completed = false;
+  bool second_read_completed = false;
+  client_side_socket.async_read_some(
+      asio::buffer(read_buffer),
+      asio::chrono::steady_clock::now() + asio::chrono::hours(1),
+      asio::bind_cancellation_slot(slot_signal.slot(),
+        read_and_reuse_slot_handler(&client_side_socket, &slot_signal,
+          read_buffer, sizeof(read_buffer),
+          &first_read_completed, &second_read_completed)));
+
+  write_completed = false;
+  asio::async_write(server_side_socket,
+      asio::buffer(write_data),
+      bindns::bind(handle_write,
+        _1, _2, &write_completed));
+
+  ioc.restart();
+  while (!first_read_completed)
+    ioc.run_one();
+  ioc.poll();
+  ASIO_CHECK(!second_read_completed);
+
+  slot_signal.emit(asio::cancellation_type::terminal);
+  ioc.run();
+  ASIO_CHECK(write_completed);
+  ASIO_CHECK(second_read_completed);
+#endif // defined(ASIO_HAS_CHRONO)
+
   // A read when the peer closes socket should fail with eof.
 
   bool read_eof_completed = false;
@@ -717,6 +1040,32 @@ void test()
   ioc.restart();
   ioc.run();
   ASIO_CHECK(read_eof_completed);
+
+#if defined(ASIO_HAS_THREADS) && defined(ASIO_HAS_STD_FUTURE_CLASS)
+  // A handler may start an operation and block until it completes while
+  // another thread runs the io_context.
+
+  client_side_socket.close();
+  client_side_socket.connect(server_endpoint);
+  acceptor.accept(server_side_socket);
+
+  for (int i = 0; i < 10; ++i)
+  {
+    asio::write(server_side_socket, asio::buffer(write_data));
+
+    size_t bytes_transferred = 0;
+    asio::post(ioc, bindns::bind(read_and_wait, &client_side_socket,
+          read_buffer, sizeof(read_buffer), &bytes_transferred));
+
+    ioc.restart();
+    asio::thread th1(bindns::bind(io_context_run, &ioc));
+    asio::thread th2(bindns::bind(io_context_run, &ioc));
+    th1.join();
+    th2.join();
+
+    ASIO_CHECK(bytes_transferred == sizeof(write_data));
+  }
+#endif // defined(ASIO_HAS_THREADS) && defined(ASIO_HAS_STD_FUTURE_CLASS)
 }
 
 } // namespace ip_tcp_socket_runtime
@@ -752,6 +1101,17 @@ private:
 #endif // defined(ASIO_HAS_MOVE)
 };
 
+struct accept_some_handler
+{
+  accept_some_handler() {}
+  void operator()(const asio::error_code&, std::size_t) {}
+#if defined(ASIO_HAS_MOVE)
+  accept_some_handler(accept_some_handler&&) {}
+private:
+  accept_some_handler(const accept_some_handler&);
+#endif // defined(ASIO_HAS_MOVE)
+};
+
 #if defined(ASIO_HAS_MOVE)
 struct move_accept_handler
 {
@@ -960,6 +1320,23 @@ void test()
     int i5 = acceptor1.async_accept(peer_socket2, peer_endpoint, lazy);
     (void)i5;
 
+#if !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
+    ip::tcp::socket* peer_sockets = &peer_socket1;
+
+    std::size_t accept_some1 = acceptor1.accept_some(
+        peer_sockets, peer_sockets + 1);
+    (void)accept_some1;
+    std::size_t accept_some2 = acceptor1.accept_some(
+        peer_sockets, peer_sockets + 1, ec);
+    (void)accept_some2;
+
+    acceptor1.async_accept_some(peer_sockets, peer_sockets + 1,
+        accept_some_handler());
+    acceptor1.async_accept_some(peer_sockets, peer_sockets + 1, immediate);
+    int i6 = acceptor1.async_accept_some(peer_sockets, peer_sockets + 1, lazy);
+    (void)i6;
+#endif // !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
+
 #if defined(ASIO_HAS_MOVE)
     acceptor1.async_accept(move_accept_handler());
     acceptor1.async_accept(ioc, move_accept_handler());
@@ -1003,11 +1380,44 @@ void handle_connect(const asio::error_code& err)
   ASIO_CHECK(!err);
 }
 
+void handle_accept_some(const asio::error_code& err,
+    std::size_t sockets_accepted, std::size_t expected)
+{
+  ASIO_CHECK(!err);
+  ASIO_CHECK(sockets_accepted == expected);
+}
+
+static const char request_data[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+void handle_connect_and_send(const asio::error_code& err,
+    std::size_t bytes_transferred)
+{
+  ASIO_CHECK(!err);
+  ASIO_CHECK(bytes_transferred == sizeof(request_data));
+}
+
+void handle_connect_and_send_refused(const asio::error_code& err,
+    std::size_t bytes_transferred, asio::error_code* result)
+{
+  *result = err;
+  ASIO_CHECK(!err || err == asio::error::connection_refused);
+  ASIO_CHECK(!err || bytes_transferred == 0);
+}
+
 void test()
 {
+  using namespace std; // For memcmp.
   using namespace asio;
   namespace ip = asio::ip;
 
+#if defined(ASIO_HAS_BOOST_BIND)
+  namespace bindns = boost;
+#else // defined(ASIO_HAS_BOOST_BIND)
+  namespace bindns = std;
+#endif // defined(ASIO_HAS_BOOST_BIND)
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
   io_context ioc;
 
   ip::tcp::acceptor acceptor(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
@@ -1059,6 +1469,121 @@ void test()
   server_side_remote_endpoint = server_side_socket.remote_endpoint();
   ASIO_CHECK(server_side_remote_endpoint.port()
       == client_endpoint.port());
+
+  client_side_socket.close();
+  server_side_socket.close();
+
+#if !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME) \
+  && defined(ASIO_HAS_MOVE)
+  // Connections that are already queued are accepted together, up to the
+  // number of sockets provided.
+
+  ip::tcp::socket client_side_sockets[3] =
+  {
+    ip::tcp::socket(ioc), ip::tcp::socket(ioc), ip::tcp::socket(ioc)
+  };
+  ip::tcp::socket server_side_sockets[4] =
+  {
+    ip::tcp::socket(ioc), ip::tcp::socket(ioc),
+    ip::tcp::socket(ioc), ip::tcp::socket(ioc)
+  };
+
+  for (int i = 0; i < 3; ++i)
+    client_side_sockets[i].connect(server_endpoint);
+
+  acceptor.async_accept_some(server_side_sockets, server_side_sockets + 4,
+      bindns::bind(&handle_accept_some, _1, _2, 3));
+
+  ioc.restart();
+  ioc.run();
+
+  for (int i = 0; i < 3; ++i)
+  {
+    ASIO_CHECK(server_side_sockets[i].remote_endpoint()
+        == client_side_sockets[i].local_endpoint());
+  }
+  ASIO_CHECK(!server_side_sockets[3].is_open());
+
+  asio::error_code accept_ec;
+  std::size_t sockets_accepted = acceptor.accept_some(
+      server_side_sockets, server_side_sockets + 4, accept_ec);
+  ASIO_CHECK(accept_ec == asio::error::already_open);
+  ASIO_CHECK(sockets_accepted == 0);
+
+  for (int i = 0; i < 3; ++i)
+  {
+    client_side_sockets[i].close();
+    server_side_sockets[i].close();
+  }
+
+  for (int i = 0; i < 3; ++i)
+    client_side_sockets[i].connect(server_endpoint);
+
+  sockets_accepted = acceptor.accept_some(
+      server_side_sockets, server_side_sockets + 2);
+  ASIO_CHECK(sockets_accepted == 2);
+  sockets_accepted = acceptor.accept_some(
+      server_side_sockets + 2, server_side_sockets + 4);
+  ASIO_CHECK(sockets_accepted == 1);
+
+  for (int i = 0; i < 3; ++i)
+  {
+    ASIO_CHECK(server_side_sockets[i].remote_endpoint()
+        == client_side_sockets[i].local_endpoint());
+    client_side_sockets[i].close();
+    server_side_sockets[i].close();
+  }
+#endif // !defined(ASIO_HAS_IOCP) && !defined(ASIO_WINDOWS_RUNTIME)
+       //   && defined(ASIO_HAS_MOVE)
+
+  // Connect and send, using TCP Fast Open where it is supported. The second
+  // connection may carry its data in the SYN, if the kernel enables Fast Open
+  // for both clients and servers.
+
+  ip::tcp::acceptor fast_open_acceptor(ioc, ip::tcp::v4());
+#if defined(ASIO_HAS_TCP_FAST_OPEN)
+  fast_open_acceptor.set_option(ip::tcp::fast_open(16));
+#endif // defined(ASIO_HAS_TCP_FAST_OPEN)
+  fast_open_acceptor.bind(ip::tcp::endpoint(ip::address_v4::loopback(), 0));
+  fast_open_acceptor.listen();
+  server_endpoint = fast_open_acceptor.local_endpoint();
+
+  for (int i = 0; i < 2; ++i)
+  {
+    client_side_socket.async_connect_and_send(server_endpoint,
+        asio::buffer(request_data), &handle_connect_and_send);
+
+    ioc.restart();
+    ioc.run();
+
+    fast_open_acceptor.accept(server_side_socket);
+    char data[sizeof(request_data)];
+    asio::read(server_side_socket, asio::buffer(data));
+    ASIO_CHECK(memcmp(data, request_data, sizeof(request_data)) == 0);
+
+    client_side_socket.close();
+    server_side_socket.close();
+  }
+
+  // A failure to connect is reported by the completion handler or, when the
+  // data was sent in the SYN, by the next operation on the socket.
+
+  fast_open_acceptor.close();
+  asio::error_code connect_ec;
+  client_side_socket.async_connect_and_send(server_endpoint,
+      asio::buffer(request_data),
+      bindns::bind(&handle_connect_and_send_refused,
+        _1, _2, &connect_ec));
+
+  ioc.restart();
+  ioc.run();
+
+  if (!connect_ec)
+  {
+    char data[sizeof(request_data)];
+    client_side_socket.read_some(asio::buffer(data), connect_ec);
+  }
+  ASIO_CHECK(connect_ec == asio::error::connection_refused);
 }
 
 } // namespace ip_tcp_acceptor_runtime
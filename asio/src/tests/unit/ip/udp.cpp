@@ -32,6 +32,164 @@
 
 //------------------------------------------------------------------------------
 
+// ip_udp_compile test
+// ~~~~~~~~~~~~~~~~~~~
+// The following test checks that all nested classes, enums and constants in
+// ip::udp compile and link correctly. Runtime failures are ignored.
+
+namespace ip_udp_compile {
+
+void test()
+{
+  using namespace asio;
+  namespace ip = asio::ip;
+
+  try
+  {
+    io_context ioc;
+    ip::udp::socket sock(ioc);
+
+#if defined(ASIO_HAS_UDP_GSO)
+    // segment_size class.
+
+    ip::udp::segment_size segment_size1(1200);
+    sock.set_option(segment_size1);
+    ip::udp::segment_size segment_size2;
+    sock.get_option(segment_size2);
+    segment_size1 = 1400;
+    (void)static_cast<int>(segment_size1.value());
+
+    // receive_offload class.
+
+    ip::udp::receive_offload receive_offload1(true);
+    sock.set_option(receive_offload1);
+    ip::udp::receive_offload receive_offload2;
+    sock.get_option(receive_offload2);
+    receive_offload1 = true;
+    (void)static_cast<bool>(receive_offload1);
+    (void)static_cast<bool>(!receive_offload1);
+    (void)static_cast<bool>(receive_offload1.value());
+#endif // defined(ASIO_HAS_UDP_GSO)
+  }
+  catch (std::exception&)
+  {
+  }
+}
+
+} // namespace ip_udp_compile
+
+//------------------------------------------------------------------------------
+
+// ip_udp_runtime test
+// ~~~~~~~~~~~~~~~~~~~
+// The following test checks the runtime operation of the ip::udp class.
+
+namespace ip_udp_runtime {
+
+void test()
+{
+#if defined(ASIO_HAS_UDP_GSO)
+  using namespace std; // For memcmp.
+  using namespace asio;
+  namespace ip = asio::ip;
+
+  io_context ioc;
+  ip::udp::socket s1(ioc, ip::udp::endpoint(ip::address_v4::loopback(), 0));
+  ip::udp::socket s2(ioc, ip::udp::endpoint(ip::address_v4::loopback(), 0));
+  asio::error_code ec;
+
+  // segment_size class.
+
+  ip::udp::segment_size segment_size1(16);
+  ASIO_CHECK(segment_size1.value() == 16);
+  s2.set_option(segment_size1, ec);
+  if (ec == asio::error::no_protocol_option
+      || ec == asio::error::invalid_argument)
+    return; // Not supported by the running kernel.
+  ASIO_CHECK(!ec);
+
+  ip::udp::segment_size segment_size2;
+  s2.get_option(segment_size2, ec);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(segment_size2.value() == 16);
+
+  // A single send is split into datagrams of the segment size.
+
+  char send_msg[64];
+  for (size_t i = 0; i < sizeof(send_msg); ++i)
+    send_msg[i] = static_cast<char>(i);
+  size_t bytes_sent = s2.send_to(buffer(send_msg), s1.local_endpoint());
+  ASIO_CHECK(bytes_sent == sizeof(send_msg));
+
+  char recv_msg[sizeof(send_msg)];
+  for (size_t offset = 0; offset < sizeof(send_msg); offset += 16)
+  {
+    ip::udp::endpoint sender_endpoint;
+    size_t bytes_recvd = s1.receive_from(
+        buffer(recv_msg + offset, sizeof(recv_msg) - offset),
+        sender_endpoint);
+    ASIO_CHECK(bytes_recvd == 16);
+  }
+  ASIO_CHECK(memcmp(send_msg, recv_msg, sizeof(send_msg)) == 0);
+
+  ip::udp::segment_size segment_size3(0);
+  s2.set_option(segment_size3, ec);
+  ASIO_CHECK(!ec);
+
+  // receive_offload class.
+
+  ip::udp::receive_offload receive_offload1(true);
+  ASIO_CHECK(receive_offload1.value());
+  s1.set_option(receive_offload1, ec);
+  ASIO_CHECK(!ec);
+
+  ip::udp::receive_offload receive_offload2;
+  s1.get_option(receive_offload2, ec);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(receive_offload2.value());
+
+#if defined(ASIO_HAS_MMSG)
+  // A per-message segment size is carried with the message, and coalesced
+  // datagrams report the size of their segments.
+
+  ip::udp::socket::message_type send_message(
+      buffer(send_msg), s1.local_endpoint());
+  send_message.segment_size(16);
+  size_t messages_sent = s2.send_many(&send_message, &send_message + 1);
+  ASIO_CHECK(messages_sent == 1);
+  ASIO_CHECK(send_message.size() == sizeof(send_msg));
+
+  ip::udp::socket::message_type recv_messages[4];
+  char recv_msgs[4][sizeof(send_msg)];
+  for (size_t i = 0; i < 4; ++i)
+    recv_messages[i].buffer(buffer(recv_msgs[i]));
+
+  size_t bytes_recvd = 0;
+  while (bytes_recvd < sizeof(send_msg))
+  {
+    size_t messages_recvd = s1.receive_many(
+        recv_messages, recv_messages + 4, 0, ec);
+    ASIO_CHECK(!ec);
+    if (ec)
+      break;
+    for (size_t i = 0; i < messages_recvd; ++i)
+    {
+      ASIO_CHECK(memcmp(recv_msgs[i], send_msg + bytes_recvd,
+            recv_messages[i].size()) == 0);
+      if (recv_messages[i].size() > 16)
+        ASIO_CHECK(recv_messages[i].segment_size() == 16);
+      bytes_recvd += recv_messages[i].size();
+    }
+  }
+  ASIO_CHECK(bytes_recvd == sizeof(send_msg));
+#endif // defined(ASIO_HAS_MMSG)
+#endif // defined(ASIO_HAS_UDP_GSO)
+}
+
+} // namespace ip_udp_runtime
+
+//------------------------------------------------------------------------------
+
 // ip_udp_socket_compile test
 // ~~~~~~~~~~~~~~~~~~~~~~~~~~
 // The following test checks that all public member functions on the class
@@ -196,6 +354,15 @@ void test()
     std::size_t available2 = socket1.available(ec);
     (void)available2;
 
+#if defined(ASIO_HAS_SO_TIMESTAMPING)
+    asio::uint32_t send_id = 0;
+    asio::uint64_t send_time = 0;
+    bool timestamp1 = socket1.receive_send_timestamp(send_id, send_time);
+    (void)timestamp1;
+    bool timestamp2 = socket1.receive_send_timestamp(send_id, send_time, ec);
+    (void)timestamp2;
+#endif // defined(ASIO_HAS_SO_TIMESTAMPING)
+
     socket1.bind(ip::udp::endpoint(ip::udp::v4(), 0));
     socket1.bind(ip::udp::endpoint(ip::udp::v6(), 0));
     socket1.bind(ip::udp::endpoint(ip::udp::v4(), 0), ec);
@@ -486,6 +653,47 @@ void test()
     int i29 = socket1.async_receive_from(null_buffers(),
         endpoint, in_flags, lazy);
     (void)i29;
+
+#if defined(ASIO_HAS_MMSG)
+    ip::udp::socket::message_type messages[4];
+    datagram_message<ip::udp::endpoint, const_buffer> const_messages[4];
+
+    socket1.send_many(messages, messages + 4);
+    socket1.send_many(const_messages, const_messages + 4);
+    socket1.send_many(messages, messages + 4, in_flags);
+    socket1.send_many(const_messages, const_messages + 4, in_flags);
+    socket1.send_many(messages, messages + 4, in_flags, ec);
+    socket1.send_many(const_messages, const_messages + 4, in_flags, ec);
+
+    socket1.async_send_many(messages, messages + 4, send_handler());
+    socket1.async_send_many(const_messages, const_messages + 4,
+        send_handler());
+    socket1.async_send_many(messages, messages + 4, in_flags, send_handler());
+    socket1.async_send_many(const_messages, const_messages + 4,
+        in_flags, send_handler());
+    socket1.async_send_many(messages, messages + 4, immediate);
+    socket1.async_send_many(messages, messages + 4, in_flags, immediate);
+    int i30 = socket1.async_send_many(messages, messages + 4, lazy);
+    (void)i30;
+    int i31 = socket1.async_send_many(const_messages, const_messages + 4,
+        in_flags, lazy);
+    (void)i31;
+
+    socket1.receive_many(messages, messages + 4);
+    socket1.receive_many(messages, messages + 4, in_flags);
+    socket1.receive_many(messages, messages + 4, in_flags, ec);
+
+    socket1.async_receive_many(messages, messages + 4, receive_handler());
+    socket1.async_receive_many(messages, messages + 4,
+        in_flags, receive_handler());
+    socket1.async_receive_many(messages, messages + 4, immediate);
+    socket1.async_receive_many(messages, messages + 4, in_flags, immediate);
+    int i32 = socket1.async_receive_many(messages, messages + 4, lazy);
+    (void)i32;
+    int i33 = socket1.async_receive_many(messages, messages + 4,
+        in_flags, lazy);
+    (void)i33;
+#endif // defined(ASIO_HAS_MMSG)
   }
   catch (std::exception&)
   {
@@ -561,6 +769,94 @@ void test()
   ioc.run();
 
   ASIO_CHECK(memcmp(send_msg, recv_msg, sizeof(send_msg)) == 0);
+
+#if defined(ASIO_HAS_MMSG)
+  ip::udp::endpoint s1_endpoint = s1.local_endpoint();
+  s1_endpoint.address(ip::address_v4::loopback());
+
+  ip::udp::socket::message_type send_messages[4];
+  for (size_t i = 0; i < 4; ++i)
+  {
+    send_messages[i].buffer(buffer(send_msg + i, i + 1));
+    send_messages[i].endpoint(s1_endpoint);
+  }
+
+  size_t messages_sent = s2.send_many(send_messages, send_messages + 2);
+  ASIO_CHECK(messages_sent == 2);
+  ASIO_CHECK(send_messages[0].size() == 1);
+  ASIO_CHECK(send_messages[1].size() == 2);
+
+  s2.async_send_many(send_messages + 2, send_messages + 4,
+      bindns::bind(handle_send, 2, _1, _2));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(send_messages[2].size() == 3);
+  ASIO_CHECK(send_messages[3].size() == 4);
+
+  char recv_msgs[6][sizeof(send_msg)];
+  ip::udp::socket::message_type recv_messages[6];
+  for (size_t i = 0; i < 6; ++i)
+    recv_messages[i].buffer(buffer(recv_msgs[i]));
+
+  // All four datagrams are already queued, so they are received together.
+  s1.async_receive_many(recv_messages, recv_messages + 6,
+      bindns::bind(handle_recv, 4, _1, _2));
+
+  ioc.restart();
+  ioc.run();
+
+  for (size_t i = 0; i < 4; ++i)
+  {
+    ASIO_CHECK(recv_messages[i].size() == i + 1);
+    ASIO_CHECK(memcmp(recv_msgs[i], send_msg + i, i + 1) == 0);
+    ASIO_CHECK(recv_messages[i].endpoint() == target_endpoint);
+  }
+
+  messages_sent = s2.send_many(send_messages, send_messages + 2);
+  ASIO_CHECK(messages_sent == 2);
+
+  size_t messages_recvd = s1.receive_many(recv_messages, recv_messages + 6);
+  ASIO_CHECK(messages_recvd == 2);
+  ASIO_CHECK(recv_messages[0].size() == 1);
+  ASIO_CHECK(recv_messages[1].size() == 2);
+
+#if defined(ASIO_HAS_SO_TIMESTAMPING)
+  // Received datagrams carry their kernel timestamps once enabled, and the
+  // times at which sent datagrams left the kernel are queued on the sending
+  // socket's error queue.
+  s1.set_option(socket_base::receive_timestamps(true));
+  s2.set_option(socket_base::timestamping(
+        socket_base::timestamp_tx_software
+        | socket_base::timestamp_software
+        | socket_base::timestamp_opt_id
+        | socket_base::timestamp_opt_tsonly));
+
+  messages_sent = s2.send_many(send_messages, send_messages + 2);
+  ASIO_CHECK(messages_sent == 2);
+
+  messages_recvd = s1.receive_many(recv_messages, recv_messages + 6);
+  ASIO_CHECK(messages_recvd == 2);
+  ASIO_CHECK(recv_messages[0].timestamp() != 0);
+  ASIO_CHECK(recv_messages[1].timestamp() >= recv_messages[0].timestamp());
+  ASIO_CHECK(recv_messages[0].hardware_timestamp() == 0);
+
+  asio::uint32_t send_id = 0;
+  asio::uint64_t send_time = 0;
+  for (asio::uint32_t i = 0; i < 2; ++i)
+  {
+    ASIO_CHECK(s2.receive_send_timestamp(send_id, send_time));
+    ASIO_CHECK(send_id == i);
+    ASIO_CHECK(send_time != 0);
+    ASIO_CHECK(send_time <= recv_messages[i].timestamp());
+  }
+
+  asio::error_code ec;
+  ASIO_CHECK(!s2.receive_send_timestamp(send_id, send_time, ec));
+  ASIO_CHECK(!ec);
+#endif // defined(ASIO_HAS_SO_TIMESTAMPING)
+#endif // defined(ASIO_HAS_MMSG)
 }
 
 } // namespace ip_udp_socket_runtime
@@ -713,6 +1009,8 @@ void test()
 ASIO_TEST_SUITE
 (
   "ip/udp",
+  ASIO_COMPILE_TEST_CASE(ip_udp_compile::test)
+  ASIO_TEST_CASE(ip_udp_runtime::test)
   ASIO_COMPILE_TEST_CASE(ip_udp_socket_compile::test)
   ASIO_TEST_CASE(ip_udp_socket_runtime::test)
   ASIO_COMPILE_TEST_CASE(ip_udp_resolver_compile::test)
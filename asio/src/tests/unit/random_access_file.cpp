@@ -49,6 +49,28 @@ private:
 #endif // defined(ASIO_HAS_MOVE)
 };
 
+struct file_handler
+{
+  file_handler() {}
+  void operator()(const asio::error_code&) {}
+#if defined(ASIO_HAS_MOVE)
+  file_handler(file_handler&&) {}
+private:
+  file_handler(const file_handler&);
+#endif // defined(ASIO_HAS_MOVE)
+};
+
+struct size_handler
+{
+  size_handler() {}
+  void operator()(const asio::error_code&, asio::uint64_t) {}
+#if defined(ASIO_HAS_MOVE)
+  size_handler(size_handler&&) {}
+private:
+  size_handler(const size_handler&);
+#endif // defined(ASIO_HAS_MOVE)
+};
+
 void test()
 {
 #if defined(ASIO_HAS_FILE)
@@ -106,6 +128,11 @@ void test()
     file1.open(path, random_access_file::read_only);
     file1.open(path, random_access_file::read_only, ec);
 
+    file1.async_open("", random_access_file::read_only, file_handler());
+    file1.async_open(path, random_access_file::read_only, file_handler());
+    int i4 = file1.async_open(path, random_access_file::read_only, lazy);
+    (void)i4;
+
     random_access_file::native_handle_type native_file3 = file1.native_handle();
     file1.assign(native_file3);
     random_access_file::native_handle_type native_file4 = file1.native_handle();
@@ -117,6 +144,10 @@ void test()
     file1.close();
     file1.close(ec);
 
+    file1.async_close(file_handler());
+    int i5 = file1.async_close(lazy);
+    (void)i5;
+
     random_access_file::native_handle_type native_file5 = file1.native_handle();
     (void)native_file5;
 
@@ -133,15 +164,31 @@ void test()
     asio::uint64_t s2 = file1.size(ec);
     (void)s2;
 
+    file1.async_size(size_handler());
+    int i6 = file1.async_size(lazy);
+    (void)i6;
+
     file1.resize(asio::uint64_t(0));
     file1.resize(asio::uint64_t(0), ec);
 
+    file1.async_resize(asio::uint64_t(0), file_handler());
+    int i7 = file1.async_resize(asio::uint64_t(0), lazy);
+    (void)i7;
+
     file1.sync_all();
     file1.sync_all(ec);
 
+    file1.async_sync_all(file_handler());
+    int i8 = file1.async_sync_all(lazy);
+    (void)i8;
+
     file1.sync_data();
     file1.sync_data(ec);
 
+    file1.async_sync_data(file_handler());
+    int i9 = file1.async_sync_data(lazy);
+    (void)i9;
+
     file1.write_some_at(0, buffer(mutable_char_buffer));
     file1.write_some_at(0, buffer(const_char_buffer));
     file1.write_some_at(0, buffer(mutable_char_buffer), ec);
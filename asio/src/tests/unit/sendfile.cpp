@@ -0,0 +1,251 @@
+//
+// sendfile.cpp
+// ~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/sendfile.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/random_access_file.hpp"
+#include "asio/read.hpp"
+#include "asio/stream_file.hpp"
+#include "unit_test.hpp"
+
+#if defined(ASIO_HAS_BOOST_BIND)
+# include <boost/bind/bind.hpp>
+#else // defined(ASIO_HAS_BOOST_BIND)
+# include <functional>
+#endif // defined(ASIO_HAS_BOOST_BIND)
+
+//------------------------------------------------------------------------------
+
+// sendfile_compile test
+// ~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that all sendfile functions compile and link
+// correctly. Runtime failures are ignored.
+
+namespace sendfile_compile {
+
+void sendfile_handler(const asio::error_code&, std::size_t)
+{
+}
+
+void test()
+{
+#if defined(ASIO_HAS_SENDFILE) && defined(ASIO_HAS_FILE)
+  using namespace asio;
+
+  try
+  {
+    io_context ioc;
+
+    ip::tcp::socket socket1(ioc);
+    random_access_file file1(ioc);
+    stream_file file2(ioc);
+
+    async_sendfile(socket1, file1, 0, 1024, &sendfile_handler);
+    async_sendfile(socket1, file2, 0, 1024, &sendfile_handler);
+  }
+  catch (std::exception&)
+  {
+  }
+#endif // defined(ASIO_HAS_SENDFILE) && defined(ASIO_HAS_FILE)
+}
+
+} // namespace sendfile_compile
+
+//------------------------------------------------------------------------------
+
+// sendfile_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that sendfile operates correctly at runtime.
+
+namespace sendfile_runtime {
+
+#if defined(ASIO_HAS_SENDFILE)
+
+// A file type that only provides the native handle of a descriptor.
+class native_file
+{
+public:
+  explicit native_file(int fd)
+    : fd_(fd)
+  {
+  }
+
+  int native_handle() const
+  {
+    return fd_;
+  }
+
+private:
+  int fd_;
+};
+
+void handle_sendfile(const asio::error_code& err,
+    std::size_t bytes_transferred, asio::error_code* out_err,
+    std::size_t* out_bytes, bool* called)
+{
+  *called = true;
+  *out_err = err;
+  *out_bytes = bytes_transferred;
+}
+
+#endif // defined(ASIO_HAS_SENDFILE)
+
+void test()
+{
+#if defined(ASIO_HAS_SENDFILE)
+  using namespace std; // For memcmp.
+  using namespace asio;
+  namespace ip = asio::ip;
+
+#if defined(ASIO_HAS_BOOST_BIND)
+  namespace bindns = boost;
+#else // defined(ASIO_HAS_BOOST_BIND)
+  namespace bindns = std;
+#endif // defined(ASIO_HAS_BOOST_BIND)
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  // Create a file that is larger than the socket's send buffer, so that the
+  // transfer has to be resumed.
+
+  char path[] = "/tmp/asio_sendfile_XXXXXX";
+  int fd = ::mkstemp(path);
+  ASIO_CHECK(fd != -1);
+  if (fd == -1)
+    return;
+
+  std::vector<char> file_data(4 * 1024 * 1024);
+  for (std::size_t i = 0; i < file_data.size(); ++i)
+    file_data[i] = static_cast<char>(i % 251);
+  ASIO_CHECK(::write(fd, &file_data[0], file_data.size())
+      == static_cast<ssize_t>(file_data.size()));
+
+  io_context ioc;
+
+  ip::tcp::acceptor acceptor(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+
+  ip::tcp::socket client_side_socket(ioc);
+  ip::tcp::socket server_side_socket(ioc);
+  client_side_socket.connect(server_endpoint);
+  acceptor.accept(server_side_socket);
+
+  // Send part of the file, starting at an offset.
+
+  native_file file1(fd);
+  const std::size_t offset = 1000;
+  const std::size_t count = file_data.size() - 2 * offset;
+
+  asio::error_code ec;
+  std::size_t bytes = 0;
+  bool called = false;
+  async_sendfile(server_side_socket, file1, offset, count,
+      bindns::bind(handle_sendfile, _1, _2, &ec, &bytes, &called));
+  ASIO_CHECK(!called);
+
+  std::vector<char> read_data(count);
+  asio::error_code read_ec;
+  std::size_t read_bytes = 0;
+  bool read_called = false;
+  asio::async_read(client_side_socket, asio::buffer(read_data),
+      bindns::bind(handle_sendfile, _1, _2,
+        &read_ec, &read_bytes, &read_called));
+
+  ioc.run();
+
+  ASIO_CHECK(called);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(bytes == count);
+  ASIO_CHECK(read_called);
+  ASIO_CHECK(read_bytes == count);
+  ASIO_CHECK(memcmp(&read_data[0], &file_data[offset], count) == 0);
+
+  // The end of the file is reached before the requested number of bytes.
+
+  called = false;
+  async_sendfile(server_side_socket, file1, file_data.size() - 10, 1024,
+      bindns::bind(handle_sendfile, _1, _2, &ec, &bytes, &called));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(called);
+  ASIO_CHECK(ec == asio::error::eof);
+  ASIO_CHECK(bytes == 10);
+
+  char tail[10];
+  asio::read(client_side_socket, asio::buffer(tail));
+  ASIO_CHECK(memcmp(tail, &file_data[file_data.size() - 10], 10) == 0);
+
+  // Zero-length transfers complete immediately.
+
+  called = false;
+  async_sendfile(server_side_socket, file1, 0, 0,
+      bindns::bind(handle_sendfile, _1, _2, &ec, &bytes, &called));
+  ASIO_CHECK(!called);
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(called);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(bytes == 0);
+
+#if defined(ASIO_HAS_FILE)
+  // Send from a random access file.
+
+  random_access_file file2(ioc, path, random_access_file::read_only);
+
+  called = false;
+  async_sendfile(server_side_socket, file2, 0, 1024,
+      bindns::bind(handle_sendfile, _1, _2, &ec, &bytes, &called));
+
+  read_called = false;
+  asio::async_read(client_side_socket, asio::buffer(read_data, 1024),
+      bindns::bind(handle_sendfile, _1, _2,
+        &read_ec, &read_bytes, &read_called));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(called);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(bytes == 1024);
+  ASIO_CHECK(read_called);
+  ASIO_CHECK(memcmp(&read_data[0], &file_data[0], 1024) == 0);
+#endif // defined(ASIO_HAS_FILE)
+
+  ::close(fd);
+  ::unlink(path);
+#endif // defined(ASIO_HAS_SENDFILE)
+}
+
+} // namespace sendfile_runtime
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "sendfile",
+  ASIO_COMPILE_TEST_CASE(sendfile_compile::test)
+  ASIO_TEST_CASE(sendfile_runtime::test)
+)
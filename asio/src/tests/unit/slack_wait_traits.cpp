@@ -0,0 +1,126 @@
+//
+// slack_wait_traits.cpp
+// ~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Prevent link dependency on the Boost.System library.
+#if !defined(BOOST_SYSTEM_NO_DEPRECATED)
+#define BOOST_SYSTEM_NO_DEPRECATED
+#endif // !defined(BOOST_SYSTEM_NO_DEPRECATED)
+
+// Test that header file is self-contained.
+#include "asio/slack_wait_traits.hpp"
+
+#include "unit_test.hpp"
+
+#if defined(ASIO_HAS_STD_CHRONO)
+
+#include <vector>
+#include "asio/basic_waitable_timer.hpp"
+#include "asio/io_context.hpp"
+#include "asio/post.hpp"
+
+#if defined(ASIO_HAS_BOOST_BIND)
+# include <boost/bind/bind.hpp>
+#else // defined(ASIO_HAS_BOOST_BIND)
+# include <functional>
+#endif // defined(ASIO_HAS_BOOST_BIND)
+
+#if defined(ASIO_HAS_BOOST_BIND)
+namespace bindns = boost;
+#else // defined(ASIO_HAS_BOOST_BIND)
+namespace bindns = std;
+#endif // defined(ASIO_HAS_BOOST_BIND)
+
+typedef asio::slack_wait_traits<asio::chrono::steady_clock,
+    asio::chrono::duration<asio::chrono::steady_clock::rep,
+      std::ratio<1, 5> > > slack_traits;
+
+typedef asio::basic_waitable_timer<
+    asio::chrono::steady_clock, slack_traits> slack_timer;
+
+struct batch_counter
+{
+  asio::io_context* ioc;
+  bool in_batch;
+  int batches;
+  int count;
+};
+
+void end_batch(batch_counter* c)
+{
+  c->in_batch = false;
+}
+
+void check_expiry(slack_timer* t, batch_counter* c,
+    const asio::error_code& ec)
+{
+  asio::chrono::steady_clock::time_point now
+    = asio::chrono::steady_clock::now();
+
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(now >= t->expiry());
+  ASIO_CHECK(now <= t->expiry() + slack_traits::timer_slack()
+      + asio::chrono::milliseconds(100));
+
+  // Count the number of separate wake-ups that complete the timers.
+  if (!c->in_batch)
+  {
+    c->in_batch = true;
+    ++c->batches;
+    asio::post(*c->ioc, bindns::bind(end_batch, c));
+  }
+
+  ++c->count;
+}
+
+void slack_timer_coalesce_test()
+{
+  asio::io_context ioc;
+  batch_counter c = { &ioc, false, 0, 0 };
+
+  // The timers expire within 50ms of each other, which fits inside a window
+  // of 200ms slack at most twice.
+  std::vector<slack_timer*> timers;
+  const asio::chrono::steady_clock::time_point start
+    = asio::chrono::steady_clock::now();
+  for (int i = 0; i < 20; ++i)
+  {
+    slack_timer* t = new slack_timer(ioc,
+        start + asio::chrono::milliseconds(10 + (i * 7) % 50));
+    t->async_wait(bindns::bind(check_expiry,
+          t, &c, bindns::placeholders::_1));
+    timers.push_back(t);
+  }
+
+  ioc.run();
+
+  ASIO_CHECK(c.count == 20);
+  ASIO_CHECK(c.batches >= 1 && c.batches <= 2);
+
+  for (std::size_t i = 0; i < timers.size(); ++i)
+    delete timers[i];
+}
+
+ASIO_TEST_SUITE
+(
+  "slack_wait_traits",
+  ASIO_TEST_CASE(slack_timer_coalesce_test)
+)
+#else // defined(ASIO_HAS_STD_CHRONO)
+ASIO_TEST_SUITE
+(
+  "slack_wait_traits",
+  ASIO_TEST_CASE(null_test)
+)
+#endif // defined(ASIO_HAS_STD_CHRONO)
@@ -144,6 +144,53 @@ void test()
     (void)static_cast<bool>(!reuse_address1);
     (void)static_cast<bool>(reuse_address1.value());
 
+#if defined(ASIO_HAS_REUSEPORT_CBPF)
+    // reuse_port class.
+
+    socket_base::reuse_port reuse_port1(true);
+    sock.set_option(reuse_port1);
+    socket_base::reuse_port reuse_port2;
+    sock.get_option(reuse_port2);
+    reuse_port1 = true;
+    (void)static_cast<bool>(reuse_port1);
+    (void)static_cast<bool>(!reuse_port1);
+    (void)static_cast<bool>(reuse_port1.value());
+
+    // incoming_cpu class.
+
+    socket_base::incoming_cpu incoming_cpu1;
+    sock.get_option(incoming_cpu1);
+    (void)static_cast<int>(incoming_cpu1.value());
+#endif // defined(ASIO_HAS_REUSEPORT_CBPF)
+
+#if defined(ASIO_HAS_SO_TIMESTAMPING)
+    // receive_timestamps class.
+
+    socket_base::receive_timestamps receive_timestamps1(true);
+    sock.set_option(receive_timestamps1);
+    socket_base::receive_timestamps receive_timestamps2;
+    sock.get_option(receive_timestamps2);
+    receive_timestamps1 = true;
+    (void)static_cast<bool>(receive_timestamps1);
+    (void)static_cast<bool>(!receive_timestamps1);
+    (void)static_cast<bool>(receive_timestamps1.value());
+
+    // timestamping class.
+
+    socket_base::timestamping timestamping1(
+        socket_base::timestamp_rx_software | socket_base::timestamp_software);
+    sock.set_option(timestamping1);
+    socket_base::timestamping timestamping2;
+    sock.get_option(timestamping2);
+    timestamping1 = socket_base::timestamp_tx_software
+      | socket_base::timestamp_tx_hardware
+      | socket_base::timestamp_rx_hardware
+      | socket_base::timestamp_raw_hardware
+      | socket_base::timestamp_opt_id
+      | socket_base::timestamp_opt_tsonly;
+    (void)static_cast<int>(timestamping1.value());
+#endif // defined(ASIO_HAS_SO_TIMESTAMPING)
+
     // linger class.
 
     socket_base::linger linger1(true, 30);
@@ -576,6 +623,82 @@ void test()
   ASIO_CHECK(!static_cast<bool>(reuse_address4));
   ASIO_CHECK(!reuse_address4);
 
+#if defined(ASIO_HAS_REUSEPORT_CBPF)
+  // reuse_port class.
+
+  socket_base::reuse_port reuse_port1(true);
+  ASIO_CHECK(reuse_port1.value());
+  tcp_sock.set_option(reuse_port1, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::reuse_port reuse_port2;
+  tcp_sock.get_option(reuse_port2, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  ASIO_CHECK(reuse_port2.value());
+
+  socket_base::reuse_port reuse_port3(false);
+  ASIO_CHECK(!reuse_port3.value());
+  tcp_sock.set_option(reuse_port3, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::reuse_port reuse_port4;
+  tcp_sock.get_option(reuse_port4, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  ASIO_CHECK(!reuse_port4.value());
+
+  // incoming_cpu class.
+
+  socket_base::incoming_cpu incoming_cpu1;
+  tcp_sock.get_option(incoming_cpu1, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  ASIO_CHECK(incoming_cpu1.value() == -1);
+#endif // defined(ASIO_HAS_REUSEPORT_CBPF)
+
+#if defined(ASIO_HAS_SO_TIMESTAMPING)
+  // receive_timestamps class.
+
+  socket_base::receive_timestamps receive_timestamps1(true);
+  ASIO_CHECK(receive_timestamps1.value());
+  udp_sock.set_option(receive_timestamps1, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::receive_timestamps receive_timestamps2;
+  udp_sock.get_option(receive_timestamps2, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  ASIO_CHECK(receive_timestamps2.value());
+
+  socket_base::receive_timestamps receive_timestamps3(false);
+  ASIO_CHECK(!receive_timestamps3.value());
+  udp_sock.set_option(receive_timestamps3, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::receive_timestamps receive_timestamps4;
+  udp_sock.get_option(receive_timestamps4, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  ASIO_CHECK(!receive_timestamps4.value());
+
+  // timestamping class.
+
+  socket_base::timestamping timestamping1(
+      socket_base::timestamp_rx_software | socket_base::timestamp_software);
+  udp_sock.set_option(timestamping1, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::timestamping timestamping2;
+  udp_sock.get_option(timestamping2, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  ASIO_CHECK(timestamping2.value() == timestamping1.value());
+
+  socket_base::timestamping timestamping3(0);
+  udp_sock.set_option(timestamping3, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+
+  socket_base::timestamping timestamping4;
+  udp_sock.get_option(timestamping4, ec);
+  ASIO_CHECK_MESSAGE(!ec, ec.value() << ", " << ec.message());
+  ASIO_CHECK(timestamping4.value() == 0);
+#endif // defined(ASIO_HAS_SO_TIMESTAMPING)
+
   // linger class.
 
   socket_base::linger linger1(true, 60);
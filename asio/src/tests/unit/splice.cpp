@@ -0,0 +1,389 @@
+//
+// splice.cpp
+// ~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/splice.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include "asio/connect_pipe.hpp"
+#include "asio/io_context.hpp"
+#include "asio/ip/tcp.hpp"
+#include "asio/local/connect_pair.hpp"
+#include "asio/local/stream_protocol.hpp"
+#include "asio/read.hpp"
+#include "asio/readable_pipe.hpp"
+#include "asio/stream_file.hpp"
+#include "asio/writable_pipe.hpp"
+#include "asio/write.hpp"
+#include "unit_test.hpp"
+
+#if defined(ASIO_HAS_SPLICE)
+# include <fcntl.h>
+#endif // defined(ASIO_HAS_SPLICE)
+
+#if defined(ASIO_HAS_BOOST_BIND)
+# include <boost/bind/bind.hpp>
+#else // defined(ASIO_HAS_BOOST_BIND)
+# include <functional>
+#endif // defined(ASIO_HAS_BOOST_BIND)
+
+//------------------------------------------------------------------------------
+
+// splice_compile test
+// ~~~~~~~~~~~~~~~~~~~
+// The following test checks that all splice functions compile and link
+// correctly. Runtime failures are ignored.
+
+namespace splice_compile {
+
+void splice_handler(const asio::error_code&, std::size_t)
+{
+}
+
+void test()
+{
+#if defined(ASIO_HAS_SPLICE)
+  using namespace asio;
+
+  try
+  {
+    io_context ioc;
+
+    ip::tcp::socket socket1(ioc);
+    ip::tcp::socket socket2(ioc);
+    readable_pipe pipe1(ioc);
+    writable_pipe pipe2(ioc);
+
+    async_splice(socket1, socket2, 1024, &splice_handler);
+    async_splice(socket1, pipe2, 1024, &splice_handler);
+    async_splice(pipe1, socket2, 1024, &splice_handler);
+    async_splice(pipe1, pipe2, 1024, &splice_handler);
+    async_tee(pipe1, pipe2, 1024, &splice_handler);
+  }
+  catch (std::exception&)
+  {
+  }
+#endif // defined(ASIO_HAS_SPLICE)
+}
+
+} // namespace splice_compile
+
+//------------------------------------------------------------------------------
+
+// splice_runtime test
+// ~~~~~~~~~~~~~~~~~~~
+// The following test checks that splice and tee operate correctly at runtime.
+
+namespace splice_runtime {
+
+static const char write_data[]
+  = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+void handle_splice(const asio::error_code& err,
+    std::size_t bytes_transferred, asio::error_code* out_err,
+    std::size_t* out_bytes, bool* called)
+{
+  *called = true;
+  *out_err = err;
+  *out_bytes = bytes_transferred;
+}
+
+void test()
+{
+#if defined(ASIO_HAS_SPLICE)
+  using namespace std; // For memcmp.
+  using namespace asio;
+  namespace ip = asio::ip;
+
+#if defined(ASIO_HAS_BOOST_BIND)
+  namespace bindns = boost;
+#else // defined(ASIO_HAS_BOOST_BIND)
+  namespace bindns = std;
+#endif // defined(ASIO_HAS_BOOST_BIND)
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  io_context ioc;
+
+  ip::tcp::acceptor acceptor(ioc, ip::tcp::endpoint(ip::tcp::v4(), 0));
+  ip::tcp::endpoint server_endpoint = acceptor.local_endpoint();
+  server_endpoint.address(ip::address_v4::loopback());
+
+  // Socket to socket, relaying through an internal pipe.
+
+  ip::tcp::socket client1(ioc);
+  ip::tcp::socket server1(ioc);
+  client1.connect(server_endpoint);
+  acceptor.accept(server1);
+
+  ip::tcp::socket client2(ioc);
+  ip::tcp::socket server2(ioc);
+  client2.connect(server_endpoint);
+  acceptor.accept(server2);
+
+  asio::error_code ec;
+  std::size_t bytes = 0;
+  bool called = false;
+  async_splice(server1, client2, sizeof(write_data),
+      bindns::bind(handle_splice, _1, _2, &ec, &bytes, &called));
+
+  asio::write(client1, asio::buffer(write_data));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(called);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(bytes == sizeof(write_data));
+
+  char read_buffer[sizeof(write_data)];
+  asio::read(server2, asio::buffer(read_buffer));
+  ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+
+  // Sockets are switched to non-blocking mode through their own state.
+
+  ASIO_CHECK(server1.native_non_blocking());
+  ASIO_CHECK(client2.native_non_blocking());
+  ASIO_CHECK(!server1.non_blocking());
+  ASIO_CHECK(!client2.non_blocking());
+
+  // End of file before the requested number of bytes.
+
+  called = false;
+  async_splice(server1, client2, 1024 * 1024,
+      bindns::bind(handle_splice, _1, _2, &ec, &bytes, &called));
+
+  asio::write(client1, asio::buffer(write_data));
+  client1.shutdown(ip::tcp::socket::shutdown_send);
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(called);
+  ASIO_CHECK(ec == asio::error::eof);
+  ASIO_CHECK(bytes == sizeof(write_data));
+
+  memset(read_buffer, 0, sizeof(read_buffer));
+  asio::read(server2, asio::buffer(read_buffer));
+  ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+
+  // Pipe to socket, without an internal pipe.
+
+  readable_pipe pipe1(ioc);
+  writable_pipe pipe2(ioc);
+  connect_pipe(pipe1, pipe2);
+
+  int pipe1_flags = ::fcntl(pipe1.native_handle(), F_GETFL);
+
+  called = false;
+  async_splice(pipe1, client2, sizeof(write_data),
+      bindns::bind(handle_splice, _1, _2, &ec, &bytes, &called));
+
+  asio::write(pipe2, asio::buffer(write_data));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(called);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(bytes == sizeof(write_data));
+
+  // The pipe's original mode is restored on completion.
+  ASIO_CHECK(::fcntl(pipe1.native_handle(), F_GETFL) == pipe1_flags);
+
+  memset(read_buffer, 0, sizeof(read_buffer));
+  asio::read(server2, asio::buffer(read_buffer));
+  ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+
+  // Tee between pipes leaves the data in the source.
+
+  readable_pipe pipe3(ioc);
+  writable_pipe pipe4(ioc);
+  connect_pipe(pipe3, pipe4);
+
+  asio::write(pipe2, asio::buffer(write_data));
+
+  called = false;
+  async_tee(pipe1, pipe4, 1024,
+      bindns::bind(handle_splice, _1, _2, &ec, &bytes, &called));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(called);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(bytes == sizeof(write_data));
+
+  memset(read_buffer, 0, sizeof(read_buffer));
+  asio::read(pipe3, asio::buffer(read_buffer));
+  ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+
+  memset(read_buffer, 0, sizeof(read_buffer));
+  asio::read(pipe1, asio::buffer(read_buffer));
+  ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+
+  // Zero-length transfers complete immediately.
+
+  called = false;
+  async_splice(server1, client2, 0,
+      bindns::bind(handle_splice, _1, _2, &ec, &bytes, &called));
+  ASIO_CHECK(!called);
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(called);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(bytes == 0);
+
+#if defined(ASIO_HAS_LOCAL_SOCKETS)
+  // Cancellation while data is held in the internal pipe. The sink cannot
+  // accept any more data, so the data is discarded and is not counted.
+
+  local::stream_protocol::socket local1(ioc);
+  local::stream_protocol::socket local2(ioc);
+  local::connect_pair(local1, local2);
+
+  local::stream_protocol::socket local3(ioc);
+  local::stream_protocol::socket local4(ioc);
+  local::connect_pair(local3, local4);
+
+  local3.non_blocking(true);
+  std::size_t unread_bytes = 0;
+  char fill_buffer[4096] = "";
+  for (;;)
+  {
+    std::size_t n = local3.write_some(asio::buffer(fill_buffer), ec);
+    if (ec)
+      break;
+    unread_bytes += n;
+  }
+  ASIO_CHECK(ec == asio::error::would_block);
+  local3.non_blocking(false);
+
+  called = false;
+  async_splice(local2, local3, 1024 * 1024,
+      bindns::bind(handle_splice, _1, _2, &ec, &bytes, &called));
+
+  asio::write(local1, asio::buffer(write_data));
+
+  ioc.restart();
+  ioc.poll();
+  ASIO_CHECK(!called);
+
+  local3.cancel();
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(called);
+  ASIO_CHECK(ec == asio::error::operation_aborted);
+  ASIO_CHECK(bytes == 0);
+  ASIO_CHECK(local2.available() == 0);
+
+  // Once the sink is drained, a new operation delivers new data in full.
+
+  while (unread_bytes > 0)
+    unread_bytes -= local4.read_some(asio::buffer(fill_buffer));
+
+  called = false;
+  async_splice(local2, local3, sizeof(write_data),
+      bindns::bind(handle_splice, _1, _2, &ec, &bytes, &called));
+
+  asio::write(local1, asio::buffer(write_data));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(called);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(bytes == sizeof(write_data));
+
+  memset(read_buffer, 0, sizeof(read_buffer));
+  asio::read(local4, asio::buffer(read_buffer));
+  ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+#endif // defined(ASIO_HAS_LOCAL_SOCKETS)
+
+#if defined(ASIO_HAS_FILE)
+  // Socket to file, relaying through an internal pipe. The first source has
+  // already been shut down, so a new connection is used.
+
+  ip::tcp::socket client3(ioc);
+  ip::tcp::socket server3(ioc);
+  client3.connect(server_endpoint);
+  acceptor.accept(server3);
+
+  const char* file_name = "splice_runtime.tmp";
+
+  stream_file file1(ioc, file_name, stream_file::write_only
+      | stream_file::create | stream_file::truncate);
+  int file1_flags = ::fcntl(file1.native_handle(), F_GETFL);
+
+  called = false;
+  async_splice(server3, file1, sizeof(write_data),
+      bindns::bind(handle_splice, _1, _2, &ec, &bytes, &called));
+
+  asio::write(client3, asio::buffer(write_data));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(called);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(bytes == sizeof(write_data));
+  ASIO_CHECK(::fcntl(file1.native_handle(), F_GETFL) == file1_flags);
+
+  file1.close();
+
+  // File to socket, relaying through an internal pipe. The source reaches
+  // end of file before the requested number of bytes.
+
+  stream_file file2(ioc, file_name, stream_file::read_only);
+  int file2_flags = ::fcntl(file2.native_handle(), F_GETFL);
+
+  called = false;
+  async_splice(file2, client2, 1024 * 1024,
+      bindns::bind(handle_splice, _1, _2, &ec, &bytes, &called));
+
+  ioc.restart();
+  ioc.run();
+
+  ASIO_CHECK(called);
+  ASIO_CHECK(ec == asio::error::eof);
+  ASIO_CHECK(bytes == sizeof(write_data));
+  ASIO_CHECK(::fcntl(file2.native_handle(), F_GETFL) == file2_flags);
+
+  memset(read_buffer, 0, sizeof(read_buffer));
+  asio::read(server2, asio::buffer(read_buffer));
+  ASIO_CHECK(memcmp(read_buffer, write_data, sizeof(write_data)) == 0);
+
+  file2.close();
+  std::remove(file_name);
+#endif // defined(ASIO_HAS_FILE)
+#endif // defined(ASIO_HAS_SPLICE)
+}
+
+} // namespace splice_runtime
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "splice",
+  ASIO_COMPILE_TEST_CASE(splice_compile::test)
+  ASIO_TEST_CASE(splice_runtime::test)
+)
@@ -0,0 +1,168 @@
+//
+// datagram_stream.cpp
+// ~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/ssl/datagram_stream.hpp"
+
+#include "asio.hpp"
+#include "asio/ssl.hpp"
+#include "../archetypes/async_result.hpp"
+#include "../unit_test.hpp"
+
+//------------------------------------------------------------------------------
+
+// ssl_datagram_stream_compile test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks that all public member functions on the class
+// ssl::datagram_stream compile and link correctly. Runtime failures are
+// ignored.
+
+namespace ssl_datagram_stream_compile {
+
+#if defined(ASIO_HAS_SSL_DTLS)
+
+bool verify_callback(bool, asio::ssl::verify_context&)
+{
+  return false;
+}
+
+void handshake_handler(const asio::error_code&)
+{
+}
+
+void shutdown_handler(const asio::error_code&)
+{
+}
+
+void send_handler(const asio::error_code&, std::size_t)
+{
+}
+
+void receive_handler(const asio::error_code&, std::size_t)
+{
+}
+
+#endif // defined(ASIO_HAS_SSL_DTLS)
+
+void test()
+{
+#if defined(ASIO_HAS_SSL_DTLS)
+  using namespace asio;
+  namespace ip = asio::ip;
+
+  try
+  {
+    io_context ioc;
+    char mutable_char_buffer[128] = "";
+    const char const_char_buffer[128] = "";
+    asio::ssl::context context(asio::ssl::context::dtls);
+    archetypes::lazy_handler lazy;
+    asio::error_code ec;
+
+    // ssl::datagram_stream constructors.
+
+    ssl::datagram_stream<ip::udp::socket> stream1(ioc, context);
+    ip::udp::socket socket1(ioc, ip::udp::v4());
+    ssl::datagram_stream<ip::udp::socket&> stream2(socket1, context);
+
+    // basic_io_object functions.
+
+    ssl::datagram_stream<ip::udp::socket>::executor_type ex
+      = stream1.get_executor();
+    (void)ex;
+
+    // ssl::datagram_stream functions.
+
+    SSL* ssl1 = stream1.native_handle();
+    (void)ssl1;
+
+    ssl::datagram_stream<ip::udp::socket>::next_layer_type& next_layer
+      = stream1.next_layer();
+    (void)next_layer;
+
+    ssl::datagram_stream<ip::udp::socket>::lowest_layer_type& lowest_layer
+      = stream1.lowest_layer();
+    (void)lowest_layer;
+
+    const ssl::datagram_stream<ip::udp::socket>& stream3 = stream1;
+    const ssl::datagram_stream<ip::udp::socket>::lowest_layer_type&
+      lowest_layer2 = stream3.lowest_layer();
+    (void)lowest_layer2;
+
+    stream1.set_verify_mode(ssl::verify_none);
+    stream1.set_verify_mode(ssl::verify_none, ec);
+
+    stream1.set_verify_depth(1);
+    stream1.set_verify_depth(1, ec);
+
+    stream1.set_verify_callback(verify_callback);
+    stream1.set_verify_callback(verify_callback, ec);
+
+    stream1.set_mtu(1200);
+    stream1.set_mtu(1200, ec);
+
+    stream1.handshake(ssl::stream_base::client);
+    stream1.handshake(ssl::stream_base::server);
+    stream1.handshake(ssl::stream_base::client, ec);
+    stream1.handshake(ssl::stream_base::server, ec);
+
+    stream1.async_handshake(ssl::stream_base::client, handshake_handler);
+    stream1.async_handshake(ssl::stream_base::server, handshake_handler);
+    int i1 = stream1.async_handshake(ssl::stream_base::client, lazy);
+    (void)i1;
+    int i2 = stream1.async_handshake(ssl::stream_base::server, lazy);
+    (void)i2;
+
+    stream1.shutdown();
+    stream1.shutdown(ec);
+
+    stream1.async_shutdown(shutdown_handler);
+    int i3 = stream1.async_shutdown(lazy);
+    (void)i3;
+
+    stream1.send(buffer(mutable_char_buffer));
+    stream1.send(buffer(const_char_buffer));
+    stream1.send(buffer(mutable_char_buffer), ec);
+    stream1.send(buffer(const_char_buffer), ec);
+
+    stream1.async_send(buffer(mutable_char_buffer), send_handler);
+    stream1.async_send(buffer(const_char_buffer), send_handler);
+    int i4 = stream1.async_send(buffer(mutable_char_buffer), lazy);
+    (void)i4;
+    int i5 = stream1.async_send(buffer(const_char_buffer), lazy);
+    (void)i5;
+
+    stream1.receive(buffer(mutable_char_buffer));
+    stream1.receive(buffer(mutable_char_buffer), ec);
+
+    stream1.async_receive(buffer(mutable_char_buffer), receive_handler);
+    int i6 = stream1.async_receive(buffer(mutable_char_buffer), lazy);
+    (void)i6;
+  }
+  catch (std::exception&)
+  {
+  }
+#endif // defined(ASIO_HAS_SSL_DTLS)
+}
+
+} // namespace ssl_datagram_stream_compile
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "ssl/datagram_stream",
+  ASIO_COMPILE_TEST_CASE(ssl_datagram_stream_compile::test)
+)
@@ -16,10 +16,19 @@
 // Test that header file is self-contained.
 #include "asio/stream_file.hpp"
 
+#include <cstdio>
+#include <utility>
 #include "archetypes/async_result.hpp"
 #include "asio/io_context.hpp"
+#include "asio/write.hpp"
 #include "unit_test.hpp"
 
+#if defined(ASIO_HAS_BOOST_BIND)
+# include <boost/bind/bind.hpp>
+#else // defined(ASIO_HAS_BOOST_BIND)
+# include <functional>
+#endif // defined(ASIO_HAS_BOOST_BIND)
+
 // stream_file_compile test
 // ~~~~~~~~~~~~~~~~~~~~~~~~
 // The following test checks that all public member functions on the class
@@ -49,6 +58,28 @@ private:
 #endif // defined(ASIO_HAS_MOVE)
 };
 
+struct file_handler
+{
+  file_handler() {}
+  void operator()(const asio::error_code&) {}
+#if defined(ASIO_HAS_MOVE)
+  file_handler(file_handler&&) {}
+private:
+  file_handler(const file_handler&);
+#endif // defined(ASIO_HAS_MOVE)
+};
+
+struct size_handler
+{
+  size_handler() {}
+  void operator()(const asio::error_code&, asio::uint64_t) {}
+#if defined(ASIO_HAS_MOVE)
+  size_handler(size_handler&&) {}
+private:
+  size_handler(const size_handler&);
+#endif // defined(ASIO_HAS_MOVE)
+};
+
 void test()
 {
 #if defined(ASIO_HAS_FILE)
@@ -106,6 +137,11 @@ void test()
     file1.open(path, stream_file::read_only);
     file1.open(path, stream_file::read_only, ec);
 
+    file1.async_open("", stream_file::read_only, file_handler());
+    file1.async_open(path, stream_file::read_only, file_handler());
+    int i4 = file1.async_open(path, stream_file::read_only, lazy);
+    (void)i4;
+
     stream_file::native_handle_type native_file3 = file1.native_handle();
     file1.assign(native_file3);
     stream_file::native_handle_type native_file4 = file1.native_handle();
@@ -117,6 +153,10 @@ void test()
     file1.close();
     file1.close(ec);
 
+    file1.async_close(file_handler());
+    int i5 = file1.async_close(lazy);
+    (void)i5;
+
     stream_file::native_handle_type native_file5 = file1.native_handle();
     (void)native_file5;
 
@@ -133,15 +173,31 @@ void test()
     asio::uint64_t s2 = file1.size(ec);
     (void)s2;
 
+    file1.async_size(size_handler());
+    int i6 = file1.async_size(lazy);
+    (void)i6;
+
     file1.resize(asio::uint64_t(0));
     file1.resize(asio::uint64_t(0), ec);
 
+    file1.async_resize(asio::uint64_t(0), file_handler());
+    int i7 = file1.async_resize(asio::uint64_t(0), lazy);
+    (void)i7;
+
     file1.sync_all();
     file1.sync_all(ec);
 
+    file1.async_sync_all(file_handler());
+    int i8 = file1.async_sync_all(lazy);
+    (void)i8;
+
     file1.sync_data();
     file1.sync_data(ec);
 
+    file1.async_sync_data(file_handler());
+    int i9 = file1.async_sync_data(lazy);
+    (void)i9;
+
     asio::uint64_t s3 = file1.seek(0, stream_file::seek_set);
     (void)s3;
     asio::uint64_t s4 = file1.seek(0, stream_file::seek_set, ec);
@@ -174,8 +230,209 @@ void test()
 
 } // namespace stream_file_compile
 
+//------------------------------------------------------------------------------
+
+// stream_file_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks the runtime operation of the asynchronous open,
+// close, size, resize and sync operations of the stream_file class.
+
+namespace stream_file_runtime {
+
+#if defined(ASIO_HAS_FILE)
+
+static const char write_data[]
+  = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+
+void handle_file(const asio::error_code& err,
+    asio::error_code* out_err, bool* called)
+{
+  *called = true;
+  *out_err = err;
+}
+
+void handle_open_check(const asio::error_code& err,
+    asio::stream_file* file, bool* called)
+{
+  *called = true;
+  ASIO_CHECK(!err);
+  ASIO_CHECK(file->is_open());
+}
+
+void handle_size(const asio::error_code& err, asio::uint64_t size,
+    asio::uint64_t* out_size, bool* called)
+{
+  *called = true;
+  ASIO_CHECK(!err);
+  *out_size = size;
+}
+
+#endif // defined(ASIO_HAS_FILE)
+
+void test()
+{
+#if defined(ASIO_HAS_FILE)
+  using namespace asio;
+
+#if defined(ASIO_HAS_BOOST_BIND)
+  namespace bindns = boost;
+#else // defined(ASIO_HAS_BOOST_BIND)
+  namespace bindns = std;
+#endif // defined(ASIO_HAS_BOOST_BIND)
+  using bindns::placeholders::_1;
+  using bindns::placeholders::_2;
+
+  const char* path = "stream_file_runtime.tmp";
+
+  io_context ioc;
+  stream_file file1(ioc);
+
+  // The file object is updated when the handler is invoked.
+
+  bool called = false;
+  file1.async_open(path, stream_file::write_only
+      | stream_file::create | stream_file::truncate,
+      bindns::bind(handle_open_check, _1, &file1, &called));
+  ASIO_CHECK(!file1.is_open());
+
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(file1.is_open());
+
+  asio::write(file1, asio::buffer(write_data));
+
+  // Size, resize and sync.
+
+  asio::uint64_t size = 0;
+  called = false;
+  file1.async_size(bindns::bind(handle_size, _1, _2, &size, &called));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(size == sizeof(write_data));
+
+  asio::error_code ec;
+  called = false;
+  file1.async_resize(asio::uint64_t(10),
+      bindns::bind(handle_file, _1, &ec, &called));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(file1.size() == 10);
+
+  called = false;
+  file1.async_sync_all(bindns::bind(handle_file, _1, &ec, &called));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(!ec);
+
+  called = false;
+  file1.async_sync_data(bindns::bind(handle_file, _1, &ec, &called));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(!ec);
+
+  // The file is detached from the file object when the close starts.
+
+  called = false;
+  file1.async_close(bindns::bind(handle_file, _1, &ec, &called));
+  ASIO_CHECK(!file1.is_open());
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(!ec);
+
+  // Opening a file that does not exist fails.
+
+  called = false;
+  file1.async_open("stream_file_runtime.missing", stream_file::read_only,
+      bindns::bind(handle_file, _1, &ec, &called));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(!!ec);
+  ASIO_CHECK(!file1.is_open());
+
+  // Opening a file that is already open fails.
+
+  file1.open(path, stream_file::read_only);
+
+  called = false;
+  file1.async_open(path, stream_file::read_only,
+      bindns::bind(handle_file, _1, &ec, &called));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(ec == asio::error::already_open);
+  ASIO_CHECK(file1.is_open());
+
+  file1.close();
+
+  // Cancelling abandons the open.
+
+  called = false;
+  file1.async_open(path, stream_file::read_only,
+      bindns::bind(handle_file, _1, &ec, &called));
+  file1.cancel();
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(ec == asio::error::operation_aborted);
+  ASIO_CHECK(!file1.is_open());
+
+#if defined(ASIO_HAS_MOVE)
+  // A moved file object receives the result of the open.
+
+  called = false;
+  file1.async_open(path, stream_file::read_only,
+      bindns::bind(handle_file, _1, &ec, &called));
+  stream_file file2(std::move(file1));
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(!file1.is_open());
+  ASIO_CHECK(file2.is_open());
+
+  file2.close();
+#endif // defined(ASIO_HAS_MOVE)
+
+  // Destroying the file object abandons the open.
+
+  stream_file* file3 = new stream_file(ioc);
+  called = false;
+  file3->async_open(path, stream_file::read_only,
+      bindns::bind(handle_file, _1, &ec, &called));
+  delete file3;
+
+  ioc.restart();
+  ioc.run();
+  ASIO_CHECK(called);
+  ASIO_CHECK(ec == asio::error::operation_aborted);
+
+  std::remove(path);
+#endif // defined(ASIO_HAS_FILE)
+}
+
+} // namespace stream_file_runtime
+
+//------------------------------------------------------------------------------
+
 ASIO_TEST_SUITE
 (
   "stream_file",
   ASIO_COMPILE_TEST_CASE(stream_file_compile::test)
+  ASIO_TEST_CASE(stream_file_runtime::test)
 )
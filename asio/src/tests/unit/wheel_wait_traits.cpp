@@ -0,0 +1,226 @@
+//
+// wheel_wait_traits.cpp
+// ~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Prevent link dependency on the Boost.System library.
+#if !defined(BOOST_SYSTEM_NO_DEPRECATED)
+#define BOOST_SYSTEM_NO_DEPRECATED
+#endif // !defined(BOOST_SYSTEM_NO_DEPRECATED)
+
+// Test that header file is self-contained.
+#include "asio/wheel_wait_traits.hpp"
+
+#include "unit_test.hpp"
+
+#if defined(ASIO_HAS_STD_CHRONO)
+
+#include <vector>
+#include "asio/basic_waitable_timer.hpp"
+#include "asio/bind_cancellation_slot.hpp"
+#include "asio/cancellation_signal.hpp"
+#include "asio/io_context.hpp"
+
+#if defined(ASIO_HAS_BOOST_BIND)
+# include <boost/bind/bind.hpp>
+#else // defined(ASIO_HAS_BOOST_BIND)
+# include <functional>
+#endif // defined(ASIO_HAS_BOOST_BIND)
+
+#if defined(ASIO_HAS_BOOST_BIND)
+namespace bindns = boost;
+#else // defined(ASIO_HAS_BOOST_BIND)
+namespace bindns = std;
+#endif // defined(ASIO_HAS_BOOST_BIND)
+
+typedef asio::basic_waitable_timer<asio::chrono::steady_clock,
+    asio::wheel_wait_traits<asio::chrono::steady_clock> > wheel_timer;
+
+typedef asio::basic_waitable_timer<asio::chrono::steady_clock,
+    asio::wheel_wait_traits<asio::chrono::steady_clock,
+      asio::chrono::duration<asio::chrono::steady_clock::rep,
+        std::ratio<1, 100> > > > coarse_wheel_timer;
+
+void increment(int* count)
+{
+  ++(*count);
+}
+
+void increment_if_not_cancelled(int* count,
+    const asio::error_code& ec)
+{
+  if (!ec)
+    ++(*count);
+}
+
+void increment_if_cancelled(int* count,
+    const asio::error_code& ec)
+{
+  if (ec == asio::error::operation_aborted)
+    ++(*count);
+}
+
+template <typename Timer>
+void check_expiry(Timer* t, int* count, const asio::error_code& ec)
+{
+  ASIO_CHECK(!ec);
+  ASIO_CHECK(Timer::clock_type::now() >= t->expiry());
+  ++(*count);
+}
+
+template <typename Timer>
+void test_expiry_order()
+{
+  asio::io_context ioc;
+  int count = 0;
+
+  // Spread the timers across the first two levels of the wheel, with some
+  // already expired and some sharing an expiry time.
+  std::vector<Timer*> timers;
+  const asio::chrono::steady_clock::time_point start
+    = asio::chrono::steady_clock::now();
+  for (int i = 0; i < 200; ++i)
+  {
+    Timer* t = new Timer(ioc,
+        start + asio::chrono::milliseconds((i * 37) % 300 - 20));
+    t->async_wait(bindns::bind(check_expiry<Timer>,
+          t, &count, bindns::placeholders::_1));
+    timers.push_back(t);
+  }
+
+  ioc.run();
+
+  ASIO_CHECK(count == 200);
+
+  for (std::size_t i = 0; i < timers.size(); ++i)
+    delete timers[i];
+}
+
+void wheel_timer_expiry_test()
+{
+  test_expiry_order<wheel_timer>();
+  test_expiry_order<coarse_wheel_timer>();
+}
+
+void wheel_timer_cancel_test()
+{
+  asio::io_context ioc;
+  int count = 0;
+
+  wheel_timer t1(ioc, asio::chrono::milliseconds(50));
+  t1.async_wait(bindns::bind(increment_if_not_cancelled,
+        &count, bindns::placeholders::_1));
+
+  // Far enough away to need several levels of the wheel.
+  wheel_timer t2(ioc, asio::chrono::hours(24 * 365));
+  t2.async_wait(bindns::bind(increment_if_cancelled,
+        &count, bindns::placeholders::_1));
+
+  // Too far away for the wheel at all.
+  wheel_timer t3(ioc, (wheel_timer::time_point::max)());
+  t3.async_wait(bindns::bind(increment_if_cancelled,
+        &count, bindns::placeholders::_1));
+
+  // Cancelled before it expires.
+  wheel_timer t4(ioc, asio::chrono::milliseconds(20));
+  t4.async_wait(bindns::bind(increment_if_not_cancelled,
+        &count, bindns::placeholders::_1));
+  ASIO_CHECK(t4.cancel() == 1);
+
+  ioc.run_one();
+  ASIO_CHECK(count == 0);
+
+  ioc.run_one();
+  ASIO_CHECK(count == 1);
+
+  ASIO_CHECK(t2.cancel() == 1);
+  ASIO_CHECK(t3.cancel() == 1);
+  ioc.run();
+  ASIO_CHECK(count == 3);
+}
+
+void wheel_timer_op_cancel_test()
+{
+  asio::cancellation_signal cancel_signal;
+  asio::io_context ioc;
+  int count = 0;
+
+  wheel_timer timer(ioc, asio::chrono::seconds(10));
+
+  timer.async_wait(bindns::bind(increment, &count));
+
+  timer.async_wait(
+      asio::bind_cancellation_slot(
+        cancel_signal.slot(),
+        bindns::bind(increment, &count)));
+
+  timer.async_wait(bindns::bind(increment, &count));
+
+  ioc.poll();
+
+  ASIO_CHECK(count == 0);
+  ASIO_CHECK(!ioc.stopped());
+
+  cancel_signal.emit(asio::cancellation_type::all);
+
+  ioc.run_one();
+  ioc.poll();
+
+  ASIO_CHECK(count == 1);
+  ASIO_CHECK(!ioc.stopped());
+
+  timer.cancel();
+
+  ioc.run();
+
+  ASIO_CHECK(count == 3);
+  ASIO_CHECK(ioc.stopped());
+}
+
+void wheel_timer_move_test()
+{
+#if defined(ASIO_HAS_MOVE)
+  asio::io_context ioc;
+  int count = 0;
+
+  wheel_timer t1(ioc, asio::chrono::milliseconds(20));
+  t1.async_wait(bindns::bind(increment_if_not_cancelled,
+        &count, bindns::placeholders::_1));
+  wheel_timer t2(ioc, asio::chrono::milliseconds(10));
+  t2.async_wait(bindns::bind(increment_if_not_cancelled,
+        &count, bindns::placeholders::_1));
+
+  wheel_timer t3(std::move(t1));
+  wheel_timer t4(std::move(t2));
+
+  ioc.run();
+
+  ASIO_CHECK(count == 2);
+#endif // defined(ASIO_HAS_MOVE)
+}
+
+ASIO_TEST_SUITE
+(
+  "wheel_wait_traits",
+  ASIO_TEST_CASE(wheel_timer_expiry_test)
+  ASIO_TEST_CASE(wheel_timer_cancel_test)
+  ASIO_TEST_CASE(wheel_timer_op_cancel_test)
+  ASIO_TEST_CASE(wheel_timer_move_test)
+)
+#else // defined(ASIO_HAS_STD_CHRONO)
+ASIO_TEST_SUITE
+(
+  "wheel_wait_traits",
+  ASIO_TEST_CASE(null_test)
+)
+#endif // defined(ASIO_HAS_STD_CHRONO)
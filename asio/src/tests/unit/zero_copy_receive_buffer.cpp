@@ -0,0 +1,55 @@
+//
+// zero_copy_receive_buffer.cpp
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+//
+// Copyright (c) 2003-2023 Christopher M. Kohlhoff (chris at kohlhoff dot com)
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+
+// Disable autolinking for unit tests.
+#if !defined(BOOST_ALL_NO_LIB)
+#define BOOST_ALL_NO_LIB 1
+#endif // !defined(BOOST_ALL_NO_LIB)
+
+// Test that header file is self-contained.
+#include "asio/zero_copy_receive_buffer.hpp"
+
+#include "unit_test.hpp"
+
+//------------------------------------------------------------------------------
+
+// zero_copy_receive_buffer_runtime test
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The following test checks the initial state of the zero_copy_receive_buffer
+// class.
+
+namespace zero_copy_receive_buffer_runtime {
+
+void test()
+{
+#if defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+  using namespace asio;
+
+  zero_copy_receive_buffer b1(1);
+  ASIO_CHECK(b1.data().data() == 0);
+  ASIO_CHECK(b1.data().size() == 0);
+  ASIO_CHECK(b1.size() == 0);
+  ASIO_CHECK(!b1.mapped());
+
+  zero_copy_receive_buffer b2(2 * 1024 * 1024, 4096);
+  ASIO_CHECK(b2.size() == 0);
+  ASIO_CHECK(!b2.mapped());
+#endif // defined(ASIO_HAS_TCP_ZEROCOPY_RECEIVE)
+}
+
+} // namespace zero_copy_receive_buffer_runtime
+
+//------------------------------------------------------------------------------
+
+ASIO_TEST_SUITE
+(
+  "zero_copy_receive_buffer",
+  ASIO_TEST_CASE(zero_copy_receive_buffer_runtime::test)
+)